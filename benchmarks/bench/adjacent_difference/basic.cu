@@ -41,7 +41,7 @@ struct basic
     template <typename T, typename Policy>
     float64_t run(thrust::device_vector<T>& input, thrust::device_vector<T>& output, Policy policy)
     {
-        bench_utils::gpu_timer d_timer;
+        bench_utils::device_timer d_timer;
 
         d_timer.start(0);
         thrust::adjacent_difference(policy, input.cbegin(), input.cend(), output.begin());
@@ -119,6 +119,7 @@ int main(int argc, char* argv[])
     parser.set_optional<std::string>(
         "name_format", "name_format", "human", "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    bench_utils::add_run_options(parser);
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -144,7 +145,7 @@ int main(int argc, char* argv[])
     }
 
     // Run benchmarks
-    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+    bench_utils::run_benchmarks(parser);
 
     // Finish
     benchmark::Shutdown();
@@ -41,7 +41,7 @@ struct in_place
     template <typename T, typename Policy>
     float64_t run(thrust::device_vector<T>& input, Policy policy)
     {
-        bench_utils::gpu_timer d_timer;
+        bench_utils::device_timer d_timer;
 
         d_timer.start(0);
         thrust::adjacent_difference(policy, input.cbegin(), input.cend(), input.begin());
@@ -116,6 +116,7 @@ int main(int argc, char* argv[])
     parser.set_optional<std::string>(
         "name_format", "name_format", "human", "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    bench_utils::add_run_options(parser);
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -141,7 +142,7 @@ int main(int argc, char* argv[])
     }
 
     // Run benchmarks
-    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+    bench_utils::run_benchmarks(parser);
 
     // Finish
     benchmark::Shutdown();
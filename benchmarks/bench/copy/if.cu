@@ -56,7 +56,7 @@ struct _if
                   less_then_t<T>            select_op,
                   Policy                    policy)
     {
-        bench_utils::gpu_timer d_timer;
+        bench_utils::device_timer d_timer;
 
         d_timer.start(0);
         thrust::copy_if(policy, input.cbegin(), input.cend(), output.begin(), select_op);
@@ -150,6 +150,7 @@ int main(int argc, char* argv[])
     parser.set_optional<std::string>(
         "name_format", "name_format", "human", "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    bench_utils::add_run_options(parser);
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -175,7 +176,7 @@ int main(int argc, char* argv[])
     }
 
     // Run benchmarks
-    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+    bench_utils::run_benchmarks(parser);
 
     // Finish
     benchmark::Shutdown();
@@ -39,7 +39,7 @@
 template <class T>
 struct square_t
 {
-    __device__ void operator()(T& x) const
+    __host__ __device__ void operator()(T& x) const
     {
         x = x * x;
     }
@@ -50,7 +50,7 @@ struct basic
     template <typename T, typename Policy>
     float64_t run(thrust::device_vector<T>& input, square_t<T> op, Policy policy)
     {
-        bench_utils::gpu_timer d_timer;
+        bench_utils::device_timer d_timer;
 
         d_timer.start(0);
         thrust::for_each(policy, input.begin(), input.end(), op);
@@ -127,6 +127,7 @@ int main(int argc, char* argv[])
     parser.set_optional<std::string>(
         "name_format", "name_format", "human", "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    bench_utils::add_run_options(parser);
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -152,7 +153,7 @@ int main(int argc, char* argv[])
     }
 
     // Run benchmarks
-    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+    bench_utils::run_benchmarks(parser);
 
     // Finish
     benchmark::Shutdown();
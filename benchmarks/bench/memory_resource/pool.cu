@@ -0,0 +1,587 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Benchmark utils
+#include "../../bench_utils/bench_utils.hpp"
+
+// rocThrust
+#include <thrust/mr/disjoint_pool.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool.h>
+#include <thrust/mr/sharded_pool.h>
+#include <thrust/mr/sync_pool.h>
+#include <thrust/mr/tls_pool.h>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// STL
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The host memory resources are compared with each other, so all of them are used through the
+// memory_resource interface, and all of the pools allocate from the same upstream resource
+using upstream_t = thrust::mr::new_delete_resource;
+using resource_t = thrust::mr::memory_resource<>;
+
+// Resets the peak resident set size of the process, where the kernel allows it, so that the peak
+// reported by a benchmark isn't the one of a benchmark run before it
+void reset_peak_rss()
+{
+#if defined(__linux__)
+    if(std::FILE* clear_refs = std::fopen("/proc/self/clear_refs", "w"))
+    {
+        std::fputs("5", clear_refs);
+        std::fclose(clear_refs);
+    }
+#endif
+}
+
+// Returns the peak resident set size of the process in bytes, or 0 where it is not known
+double peak_rss()
+{
+    unsigned long kib = 0;
+#if defined(__linux__)
+    if(std::FILE* status = std::fopen("/proc/self/status", "r"))
+    {
+        char line[128];
+        while(std::fgets(line, sizeof(line), status))
+        {
+            if(std::sscanf(line, "VmHWM: %lu kB", &kib) == 1)
+            {
+                break;
+            }
+        }
+        std::fclose(status);
+    }
+#endif
+    return 1024. * kib;
+}
+
+// Writes to every page of a block, as the users of the memory would, so that the resident set
+// size of the process includes it; faulting the pages in is part of the cost of an allocation
+// that doesn't reuse memory
+void touch(void* p, std::size_t bytes)
+{
+    volatile char* bytes_ptr = static_cast<char*>(p);
+    for(std::size_t offset = 0; offset < bytes; offset += 4096)
+    {
+        bytes_ptr[offset] = 1;
+    }
+}
+
+template <class Resource>
+std::unique_ptr<Resource> make_resource(const thrust::mr::pool_options& options)
+{
+    return std::unique_ptr<Resource>(new Resource(options));
+}
+
+template <>
+std::unique_ptr<upstream_t> make_resource<upstream_t>(const thrust::mr::pool_options&)
+{
+    return std::unique_ptr<upstream_t>(new upstream_t());
+}
+
+template <class Resource>
+void release_resource(Resource& resource)
+{
+    resource.release();
+}
+
+template <>
+void release_resource<upstream_t>(upstream_t&)
+{}
+
+// The ways the threads of a benchmark get to a resource. Thread safe resources are shared by all
+// of them, and a block may be deallocated on another thread than the one that allocated it. The
+// others are given one resource per thread. release is called by every thread after it is done
+// with the resource, once all of them are done.
+template <class Resource>
+struct shared_resource
+{
+    static constexpr bool cross_thread_frees = true;
+
+    shared_resource(const thrust::mr::pool_options& options, int)
+        : resource(make_resource<Resource>(options))
+    {}
+
+    resource_t& get(int)
+    {
+        return *resource;
+    }
+
+    void release(int thread_index)
+    {
+        if(thread_index == 0)
+        {
+            release_resource(*resource);
+        }
+    }
+
+    std::unique_ptr<Resource> resource;
+};
+
+template <class Resource>
+struct per_thread_resource
+{
+    static constexpr bool cross_thread_frees = false;
+
+    per_thread_resource(const thrust::mr::pool_options& options, int threads)
+    {
+        for(int i = 0; i < threads; i++)
+        {
+            resources.push_back(make_resource<Resource>(options));
+        }
+    }
+
+    resource_t& get(int thread_index)
+    {
+        return *resources[thread_index];
+    }
+
+    void release(int thread_index)
+    {
+        resources[thread_index]->release();
+    }
+
+    std::vector<std::unique_ptr<Resource>> resources;
+};
+
+// The thread-local pool of each thread, which always has the default options
+struct thread_local_resource
+{
+    static constexpr bool cross_thread_frees = false;
+
+    thread_local_resource(const thrust::mr::pool_options&, int) {}
+
+    resource_t& get(int)
+    {
+        return pool();
+    }
+
+    void release(int)
+    {
+        pool().release();
+    }
+
+    static thrust::mr::unsynchronized_pool_resource<upstream_t>& pool()
+    {
+        return thrust::mr::tls_pool<upstream_t, upstream_t>(
+            thrust::mr::get_global_resource<upstream_t>());
+    }
+};
+
+// A block handed over from a producer thread to a consumer thread
+struct block
+{
+    void*       pointer;
+    std::size_t bytes;
+};
+
+// Bounded single-producer, single-consumer queue; the threads spin while it is full or empty,
+// yielding, since there may be more threads than cores
+class block_queue
+{
+public:
+    static constexpr std::size_t capacity = 1024;
+
+    void push(const block& b)
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        while(tail - head_.load(std::memory_order_acquire) == capacity)
+        {
+            std::this_thread::yield();
+        }
+        blocks_[tail % capacity] = b;
+        tail_.store(tail + 1, std::memory_order_release);
+    }
+
+    block pop()
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        while(tail_.load(std::memory_order_acquire) == head)
+        {
+            std::this_thread::yield();
+        }
+        const block b = blocks_[head % capacity];
+        head_.store(head + 1, std::memory_order_release);
+        return b;
+    }
+
+private:
+    alignas(64) std::atomic<std::size_t> head_ {0};
+    alignas(64) std::atomic<std::size_t> tail_ {0};
+    block blocks_[capacity];
+};
+
+// Everything the threads of one benchmark share
+template <class Resources>
+struct shared_state
+{
+    shared_state(const thrust::mr::pool_options& options, int threads)
+        : resources(options, threads)
+    {
+        for(int i = 0; i < threads / 2; i++)
+        {
+            queues.emplace_back(new block_queue());
+        }
+    }
+
+    Resources                                 resources;
+    std::vector<std::unique_ptr<block_queue>> queues;
+};
+
+// Sizes of the pooled size classes, from 8 bytes to 64 KiB: the exponent is drawn from a
+// geometric distribution, so that small blocks are the most common, like in typical programs
+std::vector<std::size_t> size_class_sizes(std::size_t count, std::mt19937_64& engine)
+{
+    std::geometric_distribution<int>           exponent(0.35);
+    std::uniform_int_distribution<std::size_t> fraction(1, 1024);
+
+    std::vector<std::size_t> sizes(count);
+    for(auto& size : sizes)
+    {
+        const std::size_t half = std::size_t(4) << std::min(exponent(engine), 13);
+        size                   = half + half * fraction(engine) / 1024;
+    }
+    return sizes;
+}
+
+// All blocks of an iteration are live at once, and they are deallocated in a random order
+struct size_class_mix
+{
+    static constexpr bool        cross_thread = false;
+    static constexpr std::size_t ops          = 4096;
+
+    static const char* name()
+    {
+        return "size_class_mix";
+    }
+
+    size_class_mix(const thrust::mr::pool_options&, std::mt19937_64& engine)
+        : sizes(size_class_sizes(ops, engine))
+        , order(ops)
+        , pointers(ops)
+    {
+        for(std::size_t i = 0; i < ops; i++)
+        {
+            order[i] = i;
+        }
+        std::shuffle(order.begin(), order.end(), engine);
+    }
+
+    template <class State>
+    void run(State& shared, int thread_index)
+    {
+        resource_t& resource = shared.resources.get(thread_index);
+        for(std::size_t i = 0; i < ops; i++)
+        {
+            pointers[i] = resource.allocate(sizes[i]);
+            touch(pointers[i], sizes[i]);
+        }
+        for(std::size_t i : order)
+        {
+            resource.deallocate(pointers[i], sizes[i]);
+        }
+    }
+
+    std::vector<std::size_t> sizes;
+    std::vector<std::size_t> order;
+    std::vector<void*>       pointers;
+};
+
+// Blocks larger than the largest pooled size, which the pools allocate from upstream one by one,
+// each deallocated a few allocations after it was allocated
+struct oversized_churn
+{
+    static constexpr bool        cross_thread = false;
+    static constexpr std::size_t ops          = 64;
+    static constexpr std::size_t live         = 4;
+
+    static const char* name()
+    {
+        return "oversized_churn";
+    }
+
+    oversized_churn(const thrust::mr::pool_options& options, std::mt19937_64& engine)
+        : sizes(ops)
+        , pointers(ops)
+    {
+        std::uniform_int_distribution<std::size_t> multiple(1, 4);
+        for(auto& size : sizes)
+        {
+            size = options.largest_block_size * multiple(engine) + 4096;
+        }
+    }
+
+    template <class State>
+    void run(State& shared, int thread_index)
+    {
+        resource_t& resource = shared.resources.get(thread_index);
+        for(std::size_t i = 0; i < ops; i++)
+        {
+            pointers[i] = resource.allocate(sizes[i]);
+            touch(pointers[i], sizes[i]);
+            if(i >= live)
+            {
+                resource.deallocate(pointers[i - live], sizes[i - live]);
+            }
+        }
+        for(std::size_t i = ops - live; i < ops; i++)
+        {
+            resource.deallocate(pointers[i], sizes[i]);
+        }
+    }
+
+    std::vector<std::size_t> sizes;
+    std::vector<void*>       pointers;
+};
+
+// The threads are paired: the even one of each pair allocates the blocks, and hands them over to
+// the odd one, which deallocates them
+struct producer_consumer
+{
+    static constexpr bool        cross_thread = true;
+    static constexpr std::size_t ops          = 4096;
+
+    static const char* name()
+    {
+        return "producer_consumer";
+    }
+
+    producer_consumer(const thrust::mr::pool_options&, std::mt19937_64& engine)
+        : sizes(size_class_sizes(ops, engine))
+    {}
+
+    template <class State>
+    void run(State& shared, int thread_index)
+    {
+        resource_t&  resource = shared.resources.get(thread_index);
+        block_queue& queue    = *shared.queues[thread_index / 2];
+        if(thread_index % 2 == 0)
+        {
+            for(std::size_t i = 0; i < ops; i++)
+            {
+                void* p = resource.allocate(sizes[i]);
+                touch(p, sizes[i]);
+                queue.push(block {p, sizes[i]});
+            }
+        }
+        else
+        {
+            for(std::size_t i = 0; i < ops; i++)
+            {
+                const block b = queue.pop();
+                resource.deallocate(b.pointer, b.bytes);
+            }
+        }
+    }
+
+    std::vector<std::size_t> sizes;
+};
+
+template <class Workload, class Resources>
+void run_benchmark(benchmark::State&                         state,
+                   std::shared_ptr<shared_state<Resources>> shared,
+                   const thrust::mr::pool_options            options,
+                   const std::string                         seed_type)
+{
+    const int thread_index = static_cast<int>(state.thread_index());
+
+    // Every thread has its own sequence of sizes
+    std::mt19937_64 engine(bench_utils::managed_seed(seed_type).get_0() + thread_index);
+    Workload        workload(options, engine);
+
+    if(thread_index == 0)
+    {
+        reset_peak_rss();
+    }
+
+    for(auto _ : state)
+    {
+        workload.run(*shared, thread_index);
+    }
+
+    // Every thread has finished its iterations here
+    if(thread_index == 0)
+    {
+        state.counters["peak_rss"] = peak_rss();
+    }
+    shared->resources.release(thread_index);
+
+    // An operation is the allocation and the deallocation of one block; the counter is the time of
+    // an operation as seen by each thread, in nanoseconds, which stays the same with the number of
+    // threads when the resource scales perfectly
+    const double ops = static_cast<double>(state.iterations() * Workload::ops);
+    state.counters["ns_per_op"]
+        = benchmark::Counter(ops * 1e-9,
+                             benchmark::Counter::kIsRate | benchmark::Counter::kAvgThreads
+                                 | benchmark::Counter::kInvert);
+
+    std::size_t bytes = 0;
+    for(std::size_t i = 0; i < Workload::ops; i++)
+    {
+        bytes += workload.sizes[i];
+    }
+
+    // With the producers and consumers, the blocks are counted once, by the producers
+    if(!Workload::cross_thread || thread_index % 2 == 0)
+    {
+        state.SetBytesProcessed(state.iterations() * bytes);
+        state.SetItemsProcessed(state.iterations() * Workload::ops);
+    }
+}
+
+template <class Workload, class Resources>
+void add_benchmarks(const std::string&                            name,
+                    std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                    const thrust::mr::pool_options&               options,
+                    const std::string                             seed_type)
+{
+    // Handing blocks over to other threads needs a resource that allows it, and pairs of threads
+    if(Workload::cross_thread && !Resources::cross_thread_frees)
+    {
+        return;
+    }
+
+    for(int threads = Workload::cross_thread ? 2 : 1; threads <= 64; threads *= 2)
+    {
+        auto shared = std::make_shared<shared_state<Resources>>(options, threads);
+        benchmarks.push_back(
+            benchmark::RegisterBenchmark(
+                bench_utils::bench_naming::format_name(
+                    "{algo:memory_resource,subalgo:" + name + ",input_type:"
+                    + Workload::name() + ",elements:" + std::to_string(Workload::ops))
+                    .c_str(),
+                run_benchmark<Workload, Resources>,
+                shared,
+                options,
+                seed_type)
+                ->Threads(threads));
+    }
+}
+
+template <class Workload>
+void add_resources(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                   const thrust::mr::pool_options&               options,
+                   const std::string                             seed_type)
+{
+    using namespace thrust::mr;
+
+    add_benchmarks<Workload, shared_resource<upstream_t>>(
+        "new_delete_resource", benchmarks, options, seed_type);
+    add_benchmarks<Workload, per_thread_resource<unsynchronized_pool_resource<upstream_t>>>(
+        "unsynchronized_pool_resource", benchmarks, options, seed_type);
+    add_benchmarks<Workload,
+                   per_thread_resource<disjoint_unsynchronized_pool_resource<upstream_t, upstream_t>>>(
+        "disjoint_unsynchronized_pool_resource", benchmarks, options, seed_type);
+    add_benchmarks<Workload, thread_local_resource>("tls_pool", benchmarks, options, seed_type);
+    add_benchmarks<Workload, shared_resource<synchronized_pool_resource<upstream_t>>>(
+        "synchronized_pool_resource", benchmarks, options, seed_type);
+    add_benchmarks<Workload, shared_resource<sharded_pool_resource<upstream_t>>>(
+        "sharded_pool_resource", benchmarks, options, seed_type);
+}
+
+int main(int argc, char* argv[])
+{
+    const thrust::mr::pool_options defaults
+        = thrust::mr::unsynchronized_pool_resource<upstream_t>::get_default_options();
+
+    cli::Parser parser(argc, argv);
+    parser.set_optional<std::string>(
+        "name_format", "name_format", "human", "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    parser.set_optional<unsigned long>("largest_block_size",
+                                       "largest_block_size",
+                                       defaults.largest_block_size,
+                                       "pool_options::largest_block_size of the pools");
+    parser.set_optional<unsigned long>("min_blocks_per_chunk",
+                                       "min_blocks_per_chunk",
+                                       defaults.min_blocks_per_chunk,
+                                       "pool_options::min_blocks_per_chunk of the pools");
+    parser.set_optional<unsigned long>("max_bytes_per_chunk",
+                                       "max_bytes_per_chunk",
+                                       defaults.max_bytes_per_chunk,
+                                       "pool_options::max_bytes_per_chunk of the pools");
+    parser.set_optional<unsigned long>("high_watermark",
+                                       "high_watermark",
+                                       defaults.high_watermark,
+                                       "pool_options::high_watermark of the pools");
+    bench_utils::add_run_options(parser);
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    bench_utils::bench_naming::set_format(
+        parser.get<std::string>("name_format")); /* either: json,human,txt */
+    const std::string seed_type = parser.get<std::string>("seed");
+
+    // The options of all pools but the thread-local ones, which always use the defaults
+    thrust::mr::pool_options options = defaults;
+    options.largest_block_size       = parser.get<unsigned long>("largest_block_size");
+    options.min_blocks_per_chunk     = parser.get<unsigned long>("min_blocks_per_chunk");
+    options.max_bytes_per_chunk      = parser.get<unsigned long>("max_bytes_per_chunk");
+    options.high_watermark           = parser.get<unsigned long>("high_watermark");
+    if(!options.validate())
+    {
+        std::cerr << "invalid pool options" << std::endl;
+        return 1;
+    }
+
+    // Benchmark info
+    bench_utils::add_common_benchmark_info();
+    benchmark::AddCustomContext("seed", seed_type);
+    benchmark::AddCustomContext("largest_block_size", std::to_string(options.largest_block_size));
+    benchmark::AddCustomContext("min_blocks_per_chunk",
+                                std::to_string(options.min_blocks_per_chunk));
+    benchmark::AddCustomContext("max_bytes_per_chunk", std::to_string(options.max_bytes_per_chunk));
+    benchmark::AddCustomContext("high_watermark", std::to_string(options.high_watermark));
+
+    // Add benchmark
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_resources<size_class_mix>(benchmarks, options, seed_type);
+    add_resources<oversized_churn>(benchmarks, options, seed_type);
+    add_resources<producer_consumer>(benchmarks, options, seed_type);
+
+    // The threads of a benchmark run at once, so the wall time is measured
+    for(auto& b : benchmarks)
+    {
+        b->UseRealTime();
+        b->Unit(benchmark::kMicrosecond);
+        b->MinTime(0.4); // in seconds
+    }
+
+    // Run benchmarks
+    bench_utils::run_benchmarks(parser);
+
+    // Finish
+    benchmark::Shutdown();
+    return 0;
+}
@@ -46,7 +46,7 @@ struct by_key
                   thrust::device_vector<ValueT>& output_vals,
                   Policy                         policy)
     {
-        bench_utils::gpu_timer d_timer;
+        bench_utils::device_timer d_timer;
 
         d_timer.start(0);
         thrust::reduce_by_key(policy,
@@ -62,10 +62,11 @@ struct by_key
 };
 
 template <class Benchmark, class KeyT, class ValueT>
-void run_benchmark(benchmark::State& state,
-                   const std::size_t elements,
-                   const std::string seed_type,
-                   const std::size_t max_segment_size)
+void run_benchmark(benchmark::State&                            state,
+                   const std::size_t                            elements,
+                   const std::string                            seed_type,
+                   const std::size_t                            max_segment_size,
+                   const bench_utils::segment_size_distribution segment_sizes)
 {
     // Benchmark object
     Benchmark benchmark {};
@@ -76,8 +77,8 @@ void run_benchmark(benchmark::State& state,
     // Generate input
     constexpr std::size_t min_segment_size = 1;
 
-    thrust::device_vector<KeyT> input_keys = bench_utils::generate.uniform.key_segments(
-        elements, seed_type, min_segment_size, max_segment_size);
+    thrust::device_vector<KeyT> input_keys = bench_utils::generate.key_segments(
+        elements, seed_type, min_segment_size, max_segment_size, segment_sizes);
     thrust::device_vector<ValueT> input_vals(elements);
 
     // Output
@@ -116,7 +117,21 @@ void run_benchmark(benchmark::State& state,
         run_benchmark<Benchmark, KeyT, ValueT>,                                                    \
         Elements,                                                                                  \
         seed_type,                                                                                 \
-        MaxSegmentSize)
+        MaxSegmentSize,                                                                            \
+        bench_utils::segment_size_distribution::uniform)
+
+#define CREATE_POWER_LAW_BENCHMARK(KeyT, ValueT, Elements, MaxSegmentSize)                         \
+    benchmark::RegisterBenchmark(                                                                  \
+        bench_utils::bench_naming::format_name("{algo:reduce,subalgo:" + name + ",key_type:" #KeyT \
+                                               + ",value_type:" #ValueT + ",elements:" #Elements   \
+                                               + ",max_segment_size:" #MaxSegmentSize              \
+                                               + ",segment_sizes:power_law")                       \
+            .c_str(),                                                                              \
+        run_benchmark<Benchmark, KeyT, ValueT>,                                                    \
+        Elements,                                                                                  \
+        seed_type,                                                                                 \
+        MaxSegmentSize,                                                                            \
+        bench_utils::segment_size_distribution::power_law)
 
 #define BENCHMARK_ELEMENTS(key_type, value_type, elements)   \
     CREATE_BENCHMARK(key_type, value_type, elements, 1),     \
@@ -143,6 +158,13 @@ void run_benchmark(benchmark::State& state,
         BENCHMARK_VALUE_TYPE(key_type, double)
 #endif
 
+// Mostly short segments with a few very long ones
+#define BENCHMARK_POWER_LAW_KEY_TYPE(key_type)                         \
+    CREATE_POWER_LAW_BENCHMARK(key_type, int32_t, 1 << 16, 4096),     \
+        CREATE_POWER_LAW_BENCHMARK(key_type, int32_t, 1 << 20, 4096), \
+        CREATE_POWER_LAW_BENCHMARK(key_type, int32_t, 1 << 24, 4096), \
+        CREATE_POWER_LAW_BENCHMARK(key_type, int32_t, 1 << 28, 4096)
+
 template <class Benchmark>
 void add_benchmarks(const std::string&                            name,
                     std::vector<benchmark::internal::Benchmark*>& benchmarks,
@@ -159,7 +181,9 @@ void add_benchmarks(const std::string&                            name,
 #endif
                 ,
             BENCHMARK_KEY_TYPE(float32_t),
-            BENCHMARK_KEY_TYPE(float64_t) };
+            BENCHMARK_KEY_TYPE(float64_t),
+            BENCHMARK_POWER_LAW_KEY_TYPE(int32_t),
+            BENCHMARK_POWER_LAW_KEY_TYPE(int64_t) };
     benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
 }
 
@@ -169,6 +193,7 @@ int main(int argc, char* argv[])
     parser.set_optional<std::string>(
         "name_format", "name_format", "human", "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    bench_utils::add_run_options(parser);
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -194,7 +219,7 @@ int main(int argc, char* argv[])
     }
 
     // Run benchmarks
-    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+    bench_utils::run_benchmarks(parser);
 
     // Finish
     benchmark::Shutdown();
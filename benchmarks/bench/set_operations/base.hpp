@@ -49,7 +49,7 @@ struct basic
                   const OpT                 op,
                   Policy                    policy)
     {
-        bench_utils::gpu_timer d_timer;
+        bench_utils::device_timer d_timer;
 
         d_timer.start(0);
         op(policy,
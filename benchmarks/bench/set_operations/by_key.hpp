@@ -51,7 +51,7 @@ struct by_key
                   const OpT                      op,
                   Policy                         policy)
     {
-        bench_utils::gpu_timer d_timer;
+        bench_utils::device_timer d_timer;
 
         d_timer.start(0);
         op(policy,
@@ -45,7 +45,7 @@ struct basic
     float64_t run(thrust::device_vector<T>& data, const std::string rng_engine, Policy policy)
     {
         auto do_engine = [&](auto&& engine_constructor) {
-            bench_utils::gpu_timer d_timer;
+            bench_utils::device_timer d_timer;
 
             d_timer.start(0);
             thrust::shuffle(policy, data.begin(), data.end(), engine_constructor());
@@ -152,6 +152,7 @@ int main(int argc, char* argv[])
     parser.set_optional<std::string>(
         "name_format", "name_format", "human", "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    bench_utils::add_run_options(parser);
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -177,7 +178,7 @@ int main(int argc, char* argv[])
     }
 
     // Run benchmarks
-    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+    bench_utils::run_benchmarks(parser);
 
     // Finish
     benchmark::Shutdown();
@@ -43,7 +43,7 @@ struct keys
     {
         thrust::device_vector<T> vec = input;
 
-        bench_utils::gpu_timer d_timer;
+        bench_utils::device_timer d_timer;
 
         d_timer.start(0);
         thrust::sort(policy, input.begin(), input.end());
@@ -54,10 +54,10 @@ struct keys
 };
 
 template <class Benchmark, class T>
-void run_benchmark(benchmark::State& state,
-                   const std::size_t elements,
-                   const std::string seed_type,
-                   const int         entropy_reduction)
+void run_benchmark(benchmark::State&                      state,
+                   const std::size_t                      elements,
+                   const std::string                      seed_type,
+                   const bench_utils::input_distribution distribution)
 {
     // Benchmark object
     Benchmark benchmark {};
@@ -66,8 +66,7 @@ void run_benchmark(benchmark::State& state,
     std::vector<double> gpu_times;
 
     // Generate input
-    const auto entropy = bench_utils::get_entropy_percentage(entropy_reduction) / 100.0f;
-    thrust::device_vector<T> input = bench_utils::generate(elements, seed_type, entropy);
+    thrust::device_vector<T> input = bench_utils::generate(elements, seed_type, distribution);
 
     bench_utils::caching_allocator_t alloc {};
     thrust::detail::device_t         policy {};
@@ -97,12 +96,29 @@ void run_benchmark(benchmark::State& state,
         run_benchmark<Benchmark, T>,                                                               \
         Elements,                                                                                  \
         seed_type,                                                                                 \
-        EntropyReduction)
+        bench_utils::uniform_distribution(EntropyReduction))
+
+#define CREATE_DISTRIBUTION_BENCHMARK(T, Elements, Distribution)                            \
+    benchmark::RegisterBenchmark(                                                           \
+        bench_utils::bench_naming::format_name("{algo:sort,subalgo:" + name                 \
+                                               + ",input_type:" #T + ",elements:" #Elements \
+                                               + ",distribution:" + Distribution.name())    \
+            .c_str(),                                                                       \
+        run_benchmark<Benchmark, T>,                                                        \
+        Elements,                                                                           \
+        seed_type,                                                                          \
+        Distribution)
 
 #define BENCHMARK_TYPE_ENTROPY(type, entropy)                                           \
     CREATE_BENCHMARK(type, 1 << 16, entropy), CREATE_BENCHMARK(type, 1 << 20, entropy), \
         CREATE_BENCHMARK(type, 1 << 24, entropy), CREATE_BENCHMARK(type, 1 << 28, entropy)
 
+#define BENCHMARK_TYPE_DISTRIBUTION(type, distribution)             \
+    CREATE_DISTRIBUTION_BENCHMARK(type, 1 << 16, distribution),     \
+        CREATE_DISTRIBUTION_BENCHMARK(type, 1 << 20, distribution), \
+        CREATE_DISTRIBUTION_BENCHMARK(type, 1 << 24, distribution), \
+        CREATE_DISTRIBUTION_BENCHMARK(type, 1 << 28, distribution)
+
 template <class Benchmark>
 void add_benchmarks(const std::string&                            name,
                     std::vector<benchmark::internal::Benchmark*>& benchmarks,
@@ -126,6 +142,16 @@ void add_benchmarks(const std::string&                            name,
                 BENCHMARK_TYPE_ENTROPY(double, entropy_reduction) };
         benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
     }
+
+    // Skewed and presorted inputs
+    for(const auto& distribution : bench_utils::skewed_distributions())
+    {
+        std::vector<benchmark::internal::Benchmark*> bs
+            = {BENCHMARK_TYPE_DISTRIBUTION(int32_t, distribution),
+               BENCHMARK_TYPE_DISTRIBUTION(int64_t, distribution),
+               BENCHMARK_TYPE_DISTRIBUTION(double, distribution)};
+        benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+    }
 }
 
 int main(int argc, char* argv[])
@@ -134,6 +160,7 @@ int main(int argc, char* argv[])
     parser.set_optional<std::string>(
         "name_format", "name_format", "human", "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    bench_utils::add_run_options(parser);
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -159,7 +186,7 @@ int main(int argc, char* argv[])
     }
 
     // Run benchmarks
-    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+    bench_utils::run_benchmarks(parser);
 
     // Finish
     benchmark::Shutdown();
@@ -42,7 +42,7 @@ struct pairs
     float64_t
     run(thrust::device_vector<KeyT>& keys, thrust::device_vector<ValueT>& vals, Policy policy)
     {
-        bench_utils::gpu_timer d_timer;
+        bench_utils::device_timer d_timer;
 
         d_timer.start(0);
         thrust::sort_by_key(policy, keys.begin(), keys.end(), vals.begin());
@@ -53,10 +53,10 @@ struct pairs
 };
 
 template <class Benchmark, class KeyT, class ValueT>
-void run_benchmark(benchmark::State& state,
-                   const std::size_t elements,
-                   const std::string seed_type,
-                   const int         entropy_reduction)
+void run_benchmark(benchmark::State&                      state,
+                   const std::size_t                      elements,
+                   const std::string                      seed_type,
+                   const bench_utils::input_distribution distribution)
 {
     // Benchmark object
     Benchmark benchmark {};
@@ -65,8 +65,7 @@ void run_benchmark(benchmark::State& state,
     std::vector<double> gpu_times;
 
     // Generate input
-    const auto entropy = bench_utils::get_entropy_percentage(entropy_reduction) / 100.0f;
-    thrust::device_vector<KeyT>   keys = bench_utils::generate(elements, seed_type, entropy);
+    thrust::device_vector<KeyT>   keys = bench_utils::generate(elements, seed_type, distribution);
     thrust::device_vector<ValueT> vals = bench_utils::generate(elements, seed_type);
 
     bench_utils::caching_allocator_t alloc {};
@@ -98,7 +97,18 @@ void run_benchmark(benchmark::State& state,
         run_benchmark<Benchmark, KeyT, ValueT>,                                                    \
         Elements,                                                                                  \
         seed_type,                                                                                 \
-        EntropyReduction)
+        bench_utils::uniform_distribution(EntropyReduction))
+
+#define CREATE_DISTRIBUTION_BENCHMARK(KeyT, ValueT, Elements, Distribution)                  \
+    benchmark::RegisterBenchmark(                                                            \
+        bench_utils::bench_naming::format_name(                                              \
+            "{algo:sort,subalgo:" + name + ",key_type:" #KeyT + ",value_type:" #ValueT       \
+            + ",elements:" #Elements + ",distribution:" + Distribution.name())               \
+            .c_str(),                                                                        \
+        run_benchmark<Benchmark, KeyT, ValueT>,                                              \
+        Elements,                                                                            \
+        seed_type,                                                                           \
+        Distribution)
 
 #define BENCHMARK_VALUE_TYPE(key_type, value_type, entropy)       \
     CREATE_BENCHMARK(key_type, value_type, 1 << 16, entropy),     \
@@ -112,6 +122,12 @@ void run_benchmark(benchmark::State& state,
         BENCHMARK_VALUE_TYPE(key_type, int32_t, entropy), \
         BENCHMARK_VALUE_TYPE(key_type, int64_t, entropy)
 
+#define BENCHMARK_KEY_TYPE_DISTRIBUTION(key_type, value_type, distribution)         \
+    CREATE_DISTRIBUTION_BENCHMARK(key_type, value_type, 1 << 16, distribution),     \
+        CREATE_DISTRIBUTION_BENCHMARK(key_type, value_type, 1 << 20, distribution), \
+        CREATE_DISTRIBUTION_BENCHMARK(key_type, value_type, 1 << 24, distribution), \
+        CREATE_DISTRIBUTION_BENCHMARK(key_type, value_type, 1 << 28, distribution)
+
 template <class Benchmark>
 void add_benchmarks(const std::string&                            name,
                     std::vector<benchmark::internal::Benchmark*>& benchmarks,
@@ -128,6 +144,15 @@ void add_benchmarks(const std::string&                            name,
                BENCHMARK_KEY_TYPE_ENTROPY(int64_t, entropy_reduction)};
         benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
     }
+
+    // Skewed and presorted keys
+    for(const auto& distribution : bench_utils::skewed_distributions())
+    {
+        std::vector<benchmark::internal::Benchmark*> bs
+            = {BENCHMARK_KEY_TYPE_DISTRIBUTION(int32_t, int32_t, distribution),
+               BENCHMARK_KEY_TYPE_DISTRIBUTION(int64_t, int64_t, distribution)};
+        benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+    }
 }
 
 int main(int argc, char* argv[])
@@ -136,6 +161,7 @@ int main(int argc, char* argv[])
     parser.set_optional<std::string>(
         "name_format", "name_format", "human", "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    bench_utils::add_run_options(parser);
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -161,7 +187,7 @@ int main(int argc, char* argv[])
     }
 
     // Run benchmarks
-    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+    bench_utils::run_benchmarks(parser);
 
     // Finish
     benchmark::Shutdown();
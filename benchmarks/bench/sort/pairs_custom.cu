@@ -42,7 +42,7 @@ struct pairs_custom
     float64_t
     run(thrust::device_vector<KeyT>& keys, thrust::device_vector<ValueT>& vals, Policy policy)
     {
-        bench_utils::gpu_timer           d_timer;
+        bench_utils::device_timer d_timer;
 
         d_timer.start(0);
         thrust::sort_by_key(policy, keys.begin(), keys.end(), vals.begin(), bench_utils::less_t {});
@@ -136,6 +136,7 @@ int main(int argc, char* argv[])
     parser.set_optional<std::string>(
         "name_format", "name_format", "human", "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    bench_utils::add_run_options(parser);
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -161,7 +162,7 @@ int main(int argc, char* argv[])
     }
 
     // Run benchmarks
-    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+    bench_utils::run_benchmarks(parser);
 
     // Finish
     benchmark::Shutdown();
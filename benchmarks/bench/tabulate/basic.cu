@@ -42,7 +42,7 @@ struct seg_size_t
     T* d_offsets {};
 
     template <class OffsetT>
-    __device__ T operator()(OffsetT i)
+    __host__ __device__ T operator()(OffsetT i)
     {
         return d_offsets[i + 1] - d_offsets[i];
     }
@@ -53,7 +53,7 @@ struct basic
     template <typename T, typename Policy>
     float64_t run(thrust::device_vector<T>& output, seg_size_t<T> op, Policy policy)
     {
-        bench_utils::gpu_timer d_timer;
+        bench_utils::device_timer d_timer;
 
         d_timer.start(0);
         thrust::tabulate(policy, output.begin(), output.end(), op);
@@ -129,6 +129,7 @@ int main(int argc, char* argv[])
     parser.set_optional<std::string>(
         "name_format", "name_format", "human", "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    bench_utils::add_run_options(parser);
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -154,7 +155,7 @@ int main(int argc, char* argv[])
     }
 
     // Run benchmarks
-    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+    bench_utils::run_benchmarks(parser);
 
     // Finish
     benchmark::Shutdown();
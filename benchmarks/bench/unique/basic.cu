@@ -42,7 +42,7 @@ struct basic
     template <typename T, typename Policy>
     float64_t run(thrust::device_vector<T>& input, thrust::device_vector<T>& output, Policy policy)
     {
-        bench_utils::gpu_timer d_timer;
+        bench_utils::device_timer d_timer;
 
         d_timer.start(0);
         thrust::unique_copy(policy, input.cbegin(), input.cend(), output.begin());
@@ -53,10 +53,11 @@ struct basic
 };
 
 template <class Benchmark, class T>
-void run_benchmark(benchmark::State& state,
-                   const std::size_t elements,
-                   const std::string seed_type,
-                   const std::size_t max_segment_size)
+void run_benchmark(benchmark::State&                            state,
+                   const std::size_t                            elements,
+                   const std::string                            seed_type,
+                   const std::size_t                            max_segment_size,
+                   const bench_utils::segment_size_distribution segment_sizes)
 {
     // Benchmark object
     Benchmark benchmark {};
@@ -66,8 +67,8 @@ void run_benchmark(benchmark::State& state,
 
     // Generate input
     constexpr std::size_t    min_segment_size = 1;
-    thrust::device_vector<T> input            = bench_utils::generate.uniform.key_segments(
-        elements, seed_type, min_segment_size, max_segment_size);
+    thrust::device_vector<T> input            = bench_utils::generate.key_segments(
+        elements, seed_type, min_segment_size, max_segment_size, segment_sizes);
 
     // Output
     thrust::device_vector<T> output(elements);
@@ -105,7 +106,21 @@ void run_benchmark(benchmark::State& state,
         run_benchmark<Benchmark, T>,                                                              \
         Elements,                                                                                 \
         seed_type,                                                                                \
-        MaxSegmentSize)
+        MaxSegmentSize,                                                                           \
+        bench_utils::segment_size_distribution::uniform)
+
+#define CREATE_POWER_LAW_BENCHMARK(T, Elements, MaxSegmentSize)                                   \
+    benchmark::RegisterBenchmark(                                                                 \
+        bench_utils::bench_naming::format_name("{algo:unique,subalgo:" + name + ",input_type:" #T \
+                                               + ",elements:" #Elements                           \
+                                               + ",max_segment_size:" #MaxSegmentSize             \
+                                               + ",segment_sizes:power_law")                      \
+            .c_str(),                                                                             \
+        run_benchmark<Benchmark, T>,                                                              \
+        Elements,                                                                                 \
+        seed_type,                                                                                \
+        MaxSegmentSize,                                                                           \
+        bench_utils::segment_size_distribution::power_law)
 
 #define BENCHMARK_ELEMENTS(type, elements)                                    \
     CREATE_BENCHMARK(type, elements, 1), CREATE_BENCHMARK(type, elements, 4), \
@@ -115,6 +130,13 @@ void run_benchmark(benchmark::State& state,
     BENCHMARK_ELEMENTS(type, 1 << 16), BENCHMARK_ELEMENTS(type, 1 << 20), \
         BENCHMARK_ELEMENTS(type, 1 << 24), BENCHMARK_ELEMENTS(type, 1 << 28)
 
+// Mostly short segments with a few very long ones
+#define BENCHMARK_POWER_LAW_TYPE(type)                   \
+    CREATE_POWER_LAW_BENCHMARK(type, 1 << 16, 4096),     \
+        CREATE_POWER_LAW_BENCHMARK(type, 1 << 20, 4096), \
+        CREATE_POWER_LAW_BENCHMARK(type, 1 << 24, 4096), \
+        CREATE_POWER_LAW_BENCHMARK(type, 1 << 28, 4096)
+
 template <class Benchmark>
 void add_benchmarks(const std::string&                            name,
                     std::vector<benchmark::internal::Benchmark*>& benchmarks,
@@ -131,7 +153,9 @@ void add_benchmarks(const std::string&                            name,
 #endif
                 ,
             BENCHMARK_TYPE(float32_t),
-            BENCHMARK_TYPE(float64_t) };
+            BENCHMARK_TYPE(float64_t),
+            BENCHMARK_POWER_LAW_TYPE(int32_t),
+            BENCHMARK_POWER_LAW_TYPE(int64_t) };
     benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
 }
 
@@ -141,6 +165,7 @@ int main(int argc, char* argv[])
     parser.set_optional<std::string>(
         "name_format", "name_format", "human", "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", bench_utils::get_seed_message());
+    bench_utils::add_run_options(parser);
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -166,7 +191,7 @@ int main(int argc, char* argv[])
     }
 
     // Run benchmarks
-    benchmark::RunSpecifiedBenchmarks(bench_utils::ChooseCustomReporter());
+    bench_utils::run_benchmarks(parser);
 
     // Finish
     benchmark::Shutdown();
@@ -28,6 +28,8 @@
 #include "common/types.hpp"
 #include "custom_reporter.hpp"
 #include "generation_utils.hpp"
+#include "perf_counters.hpp"
+#include "thread_scaling.hpp"
 
 #include <thrust/execution_policy.h>
 
@@ -54,11 +56,14 @@
 
 #include <cmath>
 #include <cstddef>
+#include <cstdlib>
+#include <map>
 #include <numeric>
+#include <thread>
 
 namespace bench_utils
 {
-#if(THRUST_DEVICE_COMPILER == THRUST_DEVICE_COMPILER_HIP)
+#if(THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_HIP)
 
 #define HIP_CHECK(condition)                                                           \
     {                                                                                  \
@@ -126,7 +131,7 @@ public:
         return elapsed_time / 1000.0;
     }
 };
-#elif(THRUST_DEVICE_COMPILER == THRUST_DEVICE_COMPILER_NVCC)
+#elif(THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA)
 
 #define CUDA_SAFE_CALL_NO_SYNC(call)                              \
     do                                                            \
@@ -217,6 +222,52 @@ public:
 
 #endif
 
+/// \brief Timer for measuring time from the host's side, for the host backends (CPP, OMP and
+/// TBB), whose algorithms have completed when they return. The stream is ignored.
+class cpu_timer
+{
+    using clock = std::chrono::steady_clock;
+
+    clock::time_point m_start;
+    clock::time_point m_stop;
+
+public:
+    template <typename Stream>
+    void start(Stream)
+    {
+        perf_counters::instance().start();
+        m_start = clock::now();
+    }
+
+    template <typename Stream>
+    void stop(Stream)
+    {
+        m_stop = clock::now();
+        perf_counters::instance().stop();
+    }
+
+    [[nodiscard]] bool ready() const
+    {
+        return true;
+    }
+
+    // In seconds:
+    [[nodiscard]] float64_t get_duration() const
+    {
+        return std::chrono::duration<float64_t>(m_stop - m_start).count();
+    }
+};
+
+/// \brief Timer for the system the benchmarks are built for, selected with THRUST_DEVICE_SYSTEM
+#if(THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_HIP) \
+    || (THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA)
+using device_timer = gpu_timer;
+#else
+using device_timer = cpu_timer;
+#endif
+
+#if(THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_HIP)
+
 //// \brief Gets the peak global memory bus bandwidth in bytes/sec.
 std::size_t get_global_memory_bus_bandwidth(int device_id)
 {
@@ -338,6 +389,27 @@ inline void add_common_benchmark_info()
     num("hdp_arch_has_dynamic_parallelism", arch.hasDynamicParallelism);
 }
 
+#else
+
+/// \brief Adds the host backend and its number of threads to the Google benchmark info
+inline void add_common_benchmark_info()
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+    const char* system = "omp";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+    const char* system = "tbb";
+#else
+    const char* system = "cpp";
+#endif
+
+    benchmark::AddCustomContext("host_system", system);
+    benchmark::AddCustomContext("host_threads", std::to_string(host_max_threads()));
+    benchmark::AddCustomContext("host_hardware_concurrency",
+                                std::to_string(std::thread::hardware_concurrency()));
+}
+
+#endif
+
 // Binary operators
 struct less_t
 {
@@ -658,7 +730,7 @@ struct caching_allocator_t
         }
         else
         {
-            HIP_CHECK(hipMalloc(&result, num_bytes));
+            result = allocate_block(num_bytes);
         }
 
         allocated_blocks.emplace(result, num_bytes);
@@ -685,16 +757,37 @@ private:
     FreeBlocksType      free_blocks;
     AllocatedBlocksType allocated_blocks;
 
+    // the memory of the host backends is ordinary host memory
+    static value_type* allocate_block(std::ptrdiff_t num_bytes)
+    {
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_HIP
+        value_type* result {};
+        HIP_CHECK(hipMalloc(&result, num_bytes));
+        return result;
+#else
+        return static_cast<value_type*>(std::malloc(num_bytes));
+#endif
+    }
+
+    static void release_block(value_type* ptr)
+    {
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_HIP
+        HIP_CHECK(hipFree(ptr));
+#else
+        std::free(ptr);
+#endif
+    }
+
     void free_all()
     {
         for(auto free_block : free_blocks)
         {
-            HIP_CHECK(hipFree(free_block.second));
+            release_block(free_block.second);
         }
 
         for(auto allocated_block : allocated_blocks)
         {
-            HIP_CHECK(hipFree(allocated_block.first));
+            release_block(allocated_block.first);
         }
     }
 };
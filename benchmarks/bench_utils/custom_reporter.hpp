@@ -25,12 +25,14 @@
 
 // Utils
 #include "common/types.hpp"
+#include "perf_counters.hpp"
 
 // Google Benchmark
 #include <benchmark/benchmark.h>
 
 // STL
 #include <algorithm>
+#include <cmath>
 #include <cstdarg>
 #include <cstdint>
 #include <cstring>
@@ -109,6 +111,12 @@ std::string get_complexity(const benchmark::BigO& complexity)
     }
 }
 
+// Counters added by the thread-scaling sweep, reported in their own columns
+inline bool is_scaling_counter(const std::string& name)
+{
+    return name == "host_threads" || name == "speedup" || name == "parallel_efficiency";
+}
+
 template <class Run>
 double calculate_bw_utils(const Run& result)
 {
@@ -142,6 +150,8 @@ double calculate_bw_utils(const Run& result)
 /// - Elements/s: number of G elements (G = 10**6) processed by second of execution.
 /// - Labels: for extra labels. For instance, labels are used by the benchmarks generating random
 ///            input values to report the seed used.
+/// - Threads, Speedup, Efficiency: with the thread-scaling sweep, the number of host threads and
+///            the speedup and parallel efficiency relative to a single thread.
 ///
 /// Additionally, when the number of \p repetitions  is greater than one, each benchmark run is
 /// repeated \p repetitions times to measure the stability of results. In this case, the mean,
@@ -204,7 +214,7 @@ private:
     }
 
 public:
-    void PrintHeader(const Run& /*run*/)
+    void PrintHeader(const Run& run)
     {
         // Assume run.counters (with elements processed and global mem reads/writes)
         // will not be empty
@@ -218,6 +228,10 @@ public:
                                        "BW util",
                                        "GPU Noise",
                                        "Elements/s");
+        if(run.counters.find("host_threads") != run.counters.end())
+        {
+            str += FormatString(" %8s %10s %11s", "Threads", "Speedup", "Efficiency");
+        }
         std::string line = std::string(str.length(), '-');
         GetOutputStream() << line << "\n" << str << "\n" << line << "\n";
     }
@@ -311,6 +325,12 @@ public:
         const char* unit = "";
         for(auto& c : result.counters)
         {
+            // Only reported in JSON
+            if(is_scaling_counter(c.first) || is_perf_counter(c.first))
+            {
+                continue;
+            }
+
             std::size_t cNameLen = std::max(std::string::size_type(10), c.first.length());
             if(c.first == "items_per_second")
             {
@@ -404,6 +424,25 @@ public:
             PrintColoredString(sout, get_log_color(COLOR_DEFAULT), " %13s%s", s.c_str(), unit);
         }
 
+        // Print the number of threads, speedup and efficiency of the thread-scaling sweep
+        const auto threads = result.counters.find("host_threads");
+        if(threads != result.counters.end())
+        {
+            PrintColoredString(
+                sout, get_log_color(COLOR_CYAN), " %8.0f", threads->second.value);
+
+            const auto speedup    = result.counters.find("speedup");
+            const auto efficiency = result.counters.find("parallel_efficiency");
+            if(speedup != result.counters.end() && efficiency != result.counters.end())
+            {
+                PrintColoredString(sout,
+                                   get_log_color(COLOR_DEFAULT),
+                                   " %9.2fx %10.2f%%",
+                                   speedup->second.value,
+                                   100. * efficiency->second.value);
+            }
+        }
+
         PrintColoredString(sout, get_log_color(COLOR_DEFAULT), "\n");
     }
 
@@ -690,6 +729,7 @@ class CustomCSVReporter : public benchmark::CSVReporter
 {
     private:
     bool printed_header_ = false;
+    bool scaling_        = false;
 
     std::vector<std::string> elements = {
                                         "name",
@@ -723,9 +763,18 @@ class CustomCSVReporter : public benchmark::CSVReporter
         return '"' + tmp + '"';
     }
 
+    // Columns of the thread-scaling sweep, only present when it is run
+    std::vector<std::string> scaling_elements = {"host_threads", "speedup", "parallel_efficiency"};
+
     public:
-    void PrintHeader(const Run& /*run*/)
+    void PrintHeader(const Run& run)
     {
+        scaling_ = run.counters.find("host_threads") != run.counters.end();
+        if(scaling_)
+        {
+            elements.insert(elements.end(), scaling_elements.begin(), scaling_elements.end());
+        }
+
         std::string str = "";
         bool first = true;
         for (auto element : elements)
@@ -750,9 +799,11 @@ class CustomCSVReporter : public benchmark::CSVReporter
 
         if (result.skipped)
         {
-            sout << std::string(elements.size()-3, ',');
+            const std::size_t trailing = scaling_ ? scaling_elements.size() : 0;
+            sout << std::string(elements.size() - trailing - 3, ',');
             sout << std::boolalpha << (benchmark::internal::SkippedWithError == result.skipped) << ",";
-            sout << CsvEscape(result.skip_message) << "\n";
+            sout << CsvEscape(result.skip_message);
+            sout << std::string(trailing, ',') << "\n";
             return;
         }
 
@@ -810,7 +861,20 @@ class CustomCSVReporter : public benchmark::CSVReporter
             sout << CsvEscape(result.report_label);
         }
 
-        sout << ",,\n";
+        sout << ",,";
+
+        if (scaling_)
+        {
+            for (const auto& element : scaling_elements)
+            {
+                sout << ",";
+                if (result.counters.find(element) != result.counters.end())
+                {
+                    sout << result.counters.at(element);
+                }
+            }
+        }
+        sout << "\n";
     }
     
     void ReportRuns(const std::vector<Run>& reports)
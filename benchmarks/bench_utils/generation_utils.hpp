@@ -35,32 +35,45 @@
 #include <thrust/execution_policy.h>
 #include <thrust/fill.h>
 #include <thrust/find.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
 #include <thrust/generate.h>
 #include <thrust/host_vector.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_output_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/random.h>
 #include <thrust/scan.h>
+#include <thrust/scatter.h>
 #include <thrust/sequence.h>
+#include <thrust/shuffle.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
 #include <thrust/tuple.h>
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_HIP
 // rocPRIM
 #include <rocprim/rocprim.hpp>
 
 // rocRAND
 #include <rocrand/rocrand.h>
+#endif
 
 // Google Benchmark
 #include <benchmark/benchmark.h>
 
 // STL
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <random>
+#include <sstream>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 namespace bench_utils
 {
@@ -143,6 +156,128 @@ T value_from_entropy(float64_t percentage)
 
 const int entropy_reductions[] = {0, 2, 4, 6};
 
+enum class distribution_kind
+{
+    uniform,
+    zipfian,
+    sorted,
+    reverse_sorted,
+    nearly_sorted,
+    sorted_runs,
+    few_unique
+};
+
+/// \brief Distribution of the generated input values and of their order. The meaning of
+/// \p parameter depends on the kind of distribution, see the functions creating them below.
+struct input_distribution
+{
+    distribution_kind kind {distribution_kind::uniform};
+    double            parameter {0};
+
+    /// \brief Name of the distribution, for the names of the benchmarks
+    std::string name() const
+    {
+        std::ostringstream result;
+        switch(kind)
+        {
+        case distribution_kind::uniform:
+            result << "uniform";
+            break;
+        case distribution_kind::zipfian:
+            result << "zipfian_" << parameter;
+            break;
+        case distribution_kind::sorted:
+            result << "sorted";
+            break;
+        case distribution_kind::reverse_sorted:
+            result << "reverse_sorted";
+            break;
+        case distribution_kind::nearly_sorted:
+            result << "nearly_sorted_" << parameter;
+            break;
+        case distribution_kind::sorted_runs:
+            result << "sorted_runs_" << parameter;
+            break;
+        case distribution_kind::few_unique:
+            result << "few_unique_" << parameter;
+            break;
+        }
+        return result.str();
+    }
+};
+
+/// \brief Uniformly distributed values, with their entropy reduced by \p entropy_reduction
+/// bitwise ANDs of uniform values.
+inline input_distribution uniform_distribution(int entropy_reduction = 0)
+{
+    return {distribution_kind::uniform, static_cast<double>(entropy_reduction)};
+}
+
+/// \brief Values drawn from the ranks 0 ... n - 1, with rank \p k drawn with probability
+/// proportional to 1 / (k + 1)^exponent, and each rank mapped to a random value.
+inline input_distribution zipfian_distribution(double exponent = 1.0)
+{
+    return {distribution_kind::zipfian, exponent};
+}
+
+/// \brief Uniform values in ascending order.
+inline input_distribution sorted_distribution()
+{
+    return {distribution_kind::sorted, 0};
+}
+
+/// \brief Uniform values in descending order.
+inline input_distribution reverse_sorted_distribution()
+{
+    return {distribution_kind::reverse_sorted, 0};
+}
+
+/// \brief Uniform values in ascending order, except for about \p percent_displaced percent of
+/// them, which are shuffled among their positions.
+inline input_distribution nearly_sorted_distribution(double percent_displaced = 1.0)
+{
+    return {distribution_kind::nearly_sorted, percent_displaced};
+}
+
+/// \brief Uniform values in ascending runs of \p run_length values.
+inline input_distribution sorted_runs_distribution(std::size_t run_length = 1024)
+{
+    return {distribution_kind::sorted_runs, static_cast<double>(run_length)};
+}
+
+/// \brief Values drawn uniformly from \p unique_values random values.
+inline input_distribution few_unique_distribution(std::size_t unique_values = 16)
+{
+    return {distribution_kind::few_unique, static_cast<double>(unique_values)};
+}
+
+/// \brief The distributions benchmarked next to the uniform ones, which model the skew of real
+/// data.
+inline std::vector<input_distribution> skewed_distributions()
+{
+    return {zipfian_distribution(),
+            sorted_distribution(),
+            reverse_sorted_distribution(),
+            nearly_sorted_distribution(),
+            sorted_runs_distribution(),
+            few_unique_distribution()};
+}
+
+/// \brief Distribution of the lengths of generated key segments.
+enum class segment_size_distribution
+{
+    /// Uniform between the minimum and the maximum length
+    uniform,
+    /// Between the minimum and the maximum length with a probability inversely proportional to
+    /// the length, so that most segments are short and a few are very long
+    power_law
+};
+
+inline std::string to_string(segment_size_distribution sizes)
+{
+    return sizes == segment_size_distribution::uniform ? "uniform" : "power_law";
+}
+
 namespace detail
 {
     // std::uniform_int_distribution is undefined for anything other than:
@@ -222,16 +357,26 @@ namespace detail
 
         __host__ __device__ float operator()(float a, float b) const
         {
-            const std::uint32_t result
-                = reinterpret_cast<std::uint32_t&>(a) & reinterpret_cast<std::uint32_t&>(b);
-            return reinterpret_cast<const float&>(result);
+            std::uint32_t a_bits;
+            std::uint32_t b_bits;
+            float         result;
+            std::memcpy(&a_bits, &a, sizeof(a));
+            std::memcpy(&b_bits, &b, sizeof(b));
+            const std::uint32_t result_bits = a_bits & b_bits;
+            std::memcpy(&result, &result_bits, sizeof(result));
+            return result;
         }
 
         __host__ __device__ double operator()(double a, double b) const
         {
-            const std::uint64_t result
-                = reinterpret_cast<std::uint64_t&>(a) & reinterpret_cast<std::uint64_t&>(b);
-            return reinterpret_cast<const double&>(result);
+            std::uint64_t a_bits;
+            std::uint64_t b_bits;
+            double        result;
+            std::memcpy(&a_bits, &a, sizeof(a));
+            std::memcpy(&b_bits, &b, sizeof(b));
+            const std::uint64_t result_bits = a_bits & b_bits;
+            std::memcpy(&result, &result_bits, sizeof(result));
+            return result;
         }
     };
 
@@ -269,6 +414,105 @@ namespace detail
         }
     };
 
+    // A uniform double in [0, 1) computed from a seed and an index with SplitMix64, so that
+    // the values can be generated in parallel in any order.
+    __host__ __device__ inline double hash_to_unit(unsigned long long int seed,
+                                                   unsigned long long int i)
+    {
+        unsigned long long int z = seed + 0x9E3779B97F4A7C15ull * (i + 1);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        z = z ^ (z >> 31);
+        // the 53 most significant bits, scaled by 2^-53
+        return static_cast<double>(z >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+#if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_HIP
+    // Uniform doubles in [0, 1) for the host backends, which don't depend on the number of
+    // threads.
+    struct host_uniform_t
+    {
+        unsigned long long int seed;
+
+        __host__ __device__ double operator()(std::size_t i) const
+        {
+            return hash_to_unit(seed, i);
+        }
+    };
+#endif
+
+    // Turns a uniform double into one of 'ranks' ranks, drawn with a probability proportional
+    // to 1 / (rank + 1)^exponent, by inverting the distribution function of the continuous
+    // power law on [1, ranks + 1]. Each rank is then mapped to a random item, so that the
+    // frequent items are not also the smallest ones.
+    template <class T>
+    struct ranked_item_t
+    {
+        double                 ranks;
+        double                 exponent;
+        unsigned long long int seed;
+        random_to_item_t<T>    to_item;
+
+        __host__ __device__ T operator()(double random_value) const
+        {
+            double rank;
+            if(exponent == 0.0)
+            {
+                rank = floor(random_value * ranks);
+            }
+            else if(exponent == 1.0)
+            {
+                rank = floor(exp(random_value * log(ranks + 1))) - 1;
+            }
+            else
+            {
+                const double a = 1.0 - exponent;
+                rank = floor(pow(random_value * (pow(ranks + 1, a) - 1) + 1, 1 / a)) - 1;
+            }
+            rank = rank < 0 ? 0 : (rank > ranks - 1 ? ranks - 1 : rank);
+
+            return static_cast<T>(
+                to_item(hash_to_unit(seed, static_cast<unsigned long long int>(rank))));
+        }
+    };
+
+    // Selects the positions whose values are displaced in nearly sorted input
+    struct is_displaced_t
+    {
+        unsigned long long int seed;
+        double                 fraction;
+
+        __host__ __device__ bool operator()(std::size_t i) const
+        {
+            return hash_to_unit(seed, i) < fraction;
+        }
+    };
+
+    struct run_index_t
+    {
+        std::size_t run_length;
+
+        __host__ __device__ std::size_t operator()(std::size_t i) const
+        {
+            return i / run_length;
+        }
+    };
+
+    // Turns a uniform double into a segment size in [min, max], with a probability inversely
+    // proportional to the size
+    template <class T>
+    struct power_law_size_t
+    {
+        double m_min;
+        double m_max;
+
+        __host__ __device__ T operator()(double random_value) const
+        {
+            const double size = floor(m_min * exp(random_value * log((m_max + 1) / m_min)));
+            return static_cast<T>(size > m_max ? m_max : size);
+        }
+    };
+
     class seed_t : public value_wrapper_t<unsigned long long int>
     {
     public:
@@ -295,14 +539,18 @@ namespace detail
             , seed_type(m_seed_type)
             , entropy_reduction(m_entropy_reduction)
         {
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_HIP
             rocrand_create_generator(&gen, ROCRAND_RNG_PSEUDO_DEFAULT);
+#endif
             const managed_seed managed_seed {seed_type};
             seed = seed_t {managed_seed.get_0()};
         }
 
         ~device_generator_base_t()
         {
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_HIP
             rocrand_destroy_generator(gen);
+#endif
         }
 
         template <typename T>
@@ -363,11 +611,101 @@ namespace detail
             }
         }
 
+        template <typename T>
+        thrust::device_vector<T> generate(T min, T max, const input_distribution& distribution)
+        {
+            const thrust::detail::device_t policy {};
+            const std::size_t              n = elements;
+
+            switch(distribution.kind)
+            {
+            case distribution_kind::uniform:
+                return generate(min, max);
+            case distribution_kind::zipfian:
+            case distribution_kind::few_unique:
+            {
+                const bool   zipfian = distribution.kind == distribution_kind::zipfian;
+                const double ranks   = zipfian ? static_cast<double>(n) : distribution.parameter;
+
+                const double* uniform_distribution = this->new_uniform_distribution(seed, n);
+                ++seed;
+
+                thrust::device_vector<T> data(n);
+                thrust::transform(policy,
+                                  uniform_distribution,
+                                  uniform_distribution + n,
+                                  data.data(),
+                                  ranked_item_t<T> {ranks > 1 ? ranks : 1,
+                                                    zipfian ? distribution.parameter : 0.0,
+                                                    seed.get(),
+                                                    random_to_item_t<T>(min, max)});
+                return data;
+            }
+            case distribution_kind::sorted:
+            {
+                thrust::device_vector<T> data = generate(min, max);
+                thrust::sort(policy, data.begin(), data.end());
+                return data;
+            }
+            case distribution_kind::reverse_sorted:
+            {
+                thrust::device_vector<T> data = generate(min, max);
+                thrust::sort(policy, data.begin(), data.end(), thrust::greater<T>());
+                return data;
+            }
+            case distribution_kind::nearly_sorted:
+            {
+                thrust::device_vector<T> data = generate(min, max);
+                thrust::sort(policy, data.begin(), data.end());
+
+                // shuffle the values at the displaced positions among themselves
+                ++seed;
+                thrust::device_vector<std::size_t> positions(n);
+                positions.erase(thrust::copy_if(policy,
+                                                thrust::counting_iterator<std::size_t>(0),
+                                                thrust::counting_iterator<std::size_t>(n),
+                                                positions.begin(),
+                                                is_displaced_t {seed.get(),
+                                                                distribution.parameter / 100.0}),
+                                positions.end());
+                ++seed;
+
+                thrust::device_vector<T> displaced(positions.size());
+                thrust::gather(
+                    policy, positions.begin(), positions.end(), data.begin(), displaced.begin());
+                thrust::shuffle(policy,
+                                displaced.begin(),
+                                displaced.end(),
+                                thrust::default_random_engine(
+                                    static_cast<thrust::default_random_engine::result_type>(
+                                        seed.get())));
+                thrust::scatter(
+                    policy, displaced.begin(), displaced.end(), positions.begin(), data.begin());
+                return data;
+            }
+            case distribution_kind::sorted_runs:
+            {
+                thrust::device_vector<T> data = generate(min, max);
+
+                // sort by value, and then stably by run, which sorts each run
+                const std::size_t run_length = static_cast<std::size_t>(distribution.parameter);
+                thrust::device_vector<std::size_t> runs(n);
+                thrust::tabulate(
+                    policy, runs.begin(), runs.end(), run_index_t {run_length ? run_length : 1});
+                thrust::sort_by_key(policy, data.begin(), data.end(), runs.begin());
+                thrust::stable_sort_by_key(policy, runs.begin(), runs.end(), data.begin());
+                return data;
+            }
+            }
+            return generate(min, max);
+        }
+
         const double* new_uniform_distribution(seed_t seed, std::size_t num_items)
         {
             distribution.resize(num_items);
             double* d_distribution = thrust::raw_pointer_cast(distribution.data());
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_HIP
             rocrand_set_seed(gen, seed.get());
             rocrand_generate_uniform_double(gen, d_distribution, num_items);
 
@@ -377,13 +715,21 @@ namespace detail
                 std::cout << "HIP error: " << hipGetErrorString(error) << " file: " << __FILE__
                         << " line: " << __LINE__ << std::endl;
                 exit(error);
-            }   
+            }
+#else
+            thrust::tabulate(thrust::detail::device_t {},
+                             distribution.begin(),
+                             distribution.end(),
+                             host_uniform_t {seed.get()});
+#endif
 
             return d_distribution;
         }
 
     private:
-        rocrand_generator             gen;
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_HIP
+        rocrand_generator gen;
+#endif
         thrust::device_vector<double> distribution;
 
         template <typename T, typename Policy = thrust::detail::device_t>
@@ -441,21 +787,70 @@ namespace detail
         }
     };
 
+    struct device_distribution_generator_t : device_generator_base_t
+    {
+        const input_distribution distribution;
+
+        device_distribution_generator_t(std::size_t               m_elements,
+                                        const std::string&        m_seed_type,
+                                        const input_distribution& m_distribution)
+            : device_generator_base_t(m_elements,
+                                      m_seed_type,
+                                      m_distribution.kind == distribution_kind::uniform
+                                          ? static_cast<int>(m_distribution.parameter)
+                                          : 0)
+            , distribution(m_distribution)
+        {
+        }
+
+        template <typename T>
+        operator thrust::device_vector<T>()
+        {
+            return device_generator_base_t::generate(std::numeric_limits<T>::min(),
+                                                     std::numeric_limits<T>::max(),
+                                                     distribution);
+        }
+
+        template <typename T>
+        operator thrust::host_vector<T>()
+        {
+            return thrust::host_vector<T>(static_cast<thrust::device_vector<T>>(*this));
+        }
+    };
+
     template <typename T>
-    std::size_t gen_uniform_offsets(const std::string         seed_type,
-                                    thrust::device_vector<T>& segment_offsets,
-                                    const std::size_t         min_segment_size,
-                                    const std::size_t         max_segment_size)
+    std::size_t gen_segment_offsets(const std::string               seed_type,
+                                    thrust::device_vector<T>&       segment_offsets,
+                                    const std::size_t               min_segment_size,
+                                    const std::size_t               max_segment_size,
+                                    const segment_size_distribution sizes)
     {
-        const T elements = segment_offsets.size() - 2;
+        const T                        elements = segment_offsets.size() - 2;
+        const thrust::detail::device_t policy {};
 
-        segment_offsets
-            = device_generator_base_t(segment_offsets.size(), seed_type, 0 /*bit_entropy::_1_000*/)
-                  .generate(static_cast<T>(min_segment_size), static_cast<T>(max_segment_size));
+        device_generator_base_t generator(segment_offsets.size(),
+                                          seed_type,
+                                          0 /*bit_entropy::_1_000*/);
+        if(sizes == segment_size_distribution::uniform)
+        {
+            segment_offsets = generator.generate(static_cast<T>(min_segment_size),
+                                                 static_cast<T>(max_segment_size));
+        }
+        else
+        {
+            const double* uniform_distribution
+                = generator.new_uniform_distribution(generator.seed, segment_offsets.size());
+            thrust::transform(policy,
+                              uniform_distribution,
+                              uniform_distribution + segment_offsets.size(),
+                              segment_offsets.data(),
+                              power_law_size_t<T> {
+                                  static_cast<double>(min_segment_size ? min_segment_size : 1),
+                                  static_cast<double>(max_segment_size)});
+        }
 
         // Find the range of contiguous offsets starting from index 0 which sum is greater or
         // equal than 'elements'.
-        const thrust::detail::device_t policy {};
 
         // Add the offset 'elements + 1' to the array of segment offsets to make sure that
         // there is at least one offset greater than 'elements'.
@@ -489,7 +884,7 @@ namespace detail
     {
         std::size_t val;
 
-        __device__ __forceinline__ T operator()(const T& /*key*/) const
+        __host__ __device__ T operator()(const T& /*key*/) const
         {
             return static_cast<T>(val);
         }
@@ -501,11 +896,12 @@ namespace detail
         T*           keys            = nullptr;
         std::size_t* segment_offsets = nullptr;
 
-        __device__ __forceinline__ std::size_t operator()(std::size_t i)
+        __host__ __device__ std::size_t operator()(std::size_t i)
         {
             const std::size_t init_offset = segment_offsets[i];
             const std::size_t end_offset  = segment_offsets[i + 1];
-            thrust::transform(thrust::device,
+            // the segments are already processed in parallel
+            thrust::transform(thrust::seq,
                               keys + init_offset,
                               keys + end_offset,
                               keys + init_offset,
@@ -601,21 +997,24 @@ namespace detail
     //     hipDeviceSynchronize();
     // }
 
-    struct device_uniform_key_segments_generator_t
+    struct device_key_segments_generator_t
     {
-        const std::size_t elements {0};
-        const std::string seed_type {"random"};
-        const std::size_t min_segment_size {0};
-        const std::size_t max_segment_size {0};
-
-        device_uniform_key_segments_generator_t(std::size_t       m_elements,
-                                                const std::string m_seed_type,
-                                                const std::size_t m_min_segment_size,
-                                                const std::size_t m_max_segment_size)
+        const std::size_t               elements {0};
+        const std::string               seed_type {"random"};
+        const std::size_t               min_segment_size {0};
+        const std::size_t               max_segment_size {0};
+        const segment_size_distribution sizes {segment_size_distribution::uniform};
+
+        device_key_segments_generator_t(std::size_t                     m_elements,
+                                        const std::string               m_seed_type,
+                                        const std::size_t               m_min_segment_size,
+                                        const std::size_t               m_max_segment_size,
+                                        const segment_size_distribution m_sizes)
             : elements(m_elements)
             , seed_type(m_seed_type)
             , min_segment_size(m_min_segment_size)
             , max_segment_size(m_max_segment_size)
+            , sizes(m_sizes)
         {
         }
 
@@ -625,30 +1024,42 @@ namespace detail
             thrust::device_vector<KeyT> keys(elements);
 
             thrust::device_vector<std::size_t> segment_offsets(keys.size() + 2);
-            const std::size_t                  offsets_size = gen_uniform_offsets(
-                seed_type, segment_offsets, min_segment_size, max_segment_size);
+            const std::size_t                  offsets_size = gen_segment_offsets(
+                seed_type, segment_offsets, min_segment_size, max_segment_size, sizes);
             segment_offsets.resize(offsets_size);
 
             gen_key_segments(keys, segment_offsets);
 
             return keys;
         }
+
+        template <class KeyT>
+        operator thrust::host_vector<KeyT>()
+        {
+            return thrust::host_vector<KeyT>(static_cast<thrust::device_vector<KeyT>>(*this));
+        }
     };
 
-    struct gen_uniform_key_segments_t
+    template <segment_size_distribution Sizes>
+    struct gen_key_segments_t
     {
-        device_uniform_key_segments_generator_t operator()(const std::size_t elements,
-                                                           const std::string seed_type,
-                                                           const std::size_t min_segment_size,
-                                                           const std::size_t max_segment_size) const
+        device_key_segments_generator_t operator()(const std::size_t elements,
+                                                   const std::string seed_type,
+                                                   const std::size_t min_segment_size,
+                                                   const std::size_t max_segment_size) const
         {
-            return {elements, seed_type, min_segment_size, max_segment_size};
+            return {elements, seed_type, min_segment_size, max_segment_size, Sizes};
         }
     };
 
     struct gen_uniform_t
     {
-        gen_uniform_key_segments_t key_segments {};
+        gen_key_segments_t<segment_size_distribution::uniform> key_segments {};
+    };
+
+    struct gen_power_law_t
+    {
+        gen_key_segments_t<segment_size_distribution::power_law> key_segments {};
     };
 
     struct gen_t
@@ -670,7 +1081,25 @@ namespace detail
             return {elements, seed_type, entropy};
         }
 
-        gen_uniform_t uniform {};
+        device_distribution_generator_t operator()(std::size_t               elements,
+                                                   const std::string         seed_type,
+                                                   const input_distribution& distribution) const
+        {
+            return {elements, seed_type, distribution};
+        }
+
+        device_key_segments_generator_t
+            key_segments(const std::size_t               elements,
+                         const std::string               seed_type,
+                         const std::size_t               min_segment_size,
+                         const std::size_t               max_segment_size,
+                         const segment_size_distribution sizes) const
+        {
+            return {elements, seed_type, min_segment_size, max_segment_size, sizes};
+        }
+
+        gen_uniform_t   uniform {};
+        gen_power_law_t power_law {};
     };
 } // namespace detail
 
@@ -0,0 +1,308 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef ROCTHRUST_BENCHMARKS_BENCH_UTILS_PERF_COUNTERS_HPP_
+#define ROCTHRUST_BENCHMARKS_BENCH_UTILS_PERF_COUNTERS_HPP_
+
+// Linux perf events
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define ROCTHRUST_BENCHMARKS_HAVE_PERF_EVENTS 1
+#else
+#define ROCTHRUST_BENCHMARKS_HAVE_PERF_EVENTS 0
+#endif
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// STL
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace bench_utils
+{
+
+/// \brief Collects hardware performance counters of the host with \p perf_event_open over the
+/// regions timed by \p cpu_timer.
+///
+/// The counters are opened once, with \p enable(), before the host backend starts its threads,
+/// and are inherited by every thread started afterwards, so that they count the work of all the
+/// threads of the backend. Only user space is counted, which unprivileged processes are allowed
+/// to do with the default \p perf_event_paranoid setting. Events that can't be opened, because
+/// the hardware doesn't have them or because perf events are not permitted, as is usual in
+/// containers, are left out, and the collector does nothing if none can be opened.
+///
+/// The values are accumulated over all timed regions until \p take(), which returns their
+/// averages per region: per iteration of the benchmark.
+class perf_counters
+{
+public:
+    struct event
+    {
+        const char*   name;
+        std::uint32_t type;
+        std::uint64_t config;
+    };
+
+    static perf_counters& instance()
+    {
+        static perf_counters counters;
+        return counters;
+    }
+
+    /// \brief Opens the counters; returns whether at least one of them could be opened. Otherwise,
+    /// \p error() tells why.
+    bool enable()
+    {
+        if(!fds_.empty())
+        {
+            return true;
+        }
+
+#if ROCTHRUST_BENCHMARKS_HAVE_PERF_EVENTS
+        for(const event& e : events())
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size           = sizeof(attr);
+            attr.type           = e.type;
+            attr.config         = e.config;
+            attr.inherit        = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC);
+            if(fd < 0)
+            {
+                error_ = std::string("perf_event_open failed for ") + e.name + ": "
+                         + std::strerror(errno);
+                continue;
+            }
+
+            fds_.push_back(static_cast<int>(fd));
+            names_.push_back(e.name);
+        }
+        start_.resize(fds_.size());
+        totals_.assign(fds_.size(), 0.0);
+#else
+        error_ = "perf events are only available on Linux";
+#endif
+        return !fds_.empty();
+    }
+
+    bool enabled() const
+    {
+        return !fds_.empty();
+    }
+
+    const std::string& error() const
+    {
+        return error_;
+    }
+
+    /// \brief Names of the counters that could be opened
+    const std::vector<std::string>& names() const
+    {
+        return names_;
+    }
+
+    void start()
+    {
+        for(std::size_t i = 0; i < fds_.size(); ++i)
+        {
+            start_[i] = read_value(fds_[i]);
+        }
+    }
+
+    void stop()
+    {
+        if(fds_.empty())
+        {
+            return;
+        }
+
+        for(std::size_t i = 0; i < fds_.size(); ++i)
+        {
+            const value stop = read_value(fds_[i]);
+
+            // Scale the count up when the counter was multiplexed with others
+            const double enabled = static_cast<double>(stop.enabled - start_[i].enabled);
+            const double running = static_cast<double>(stop.running - start_[i].running);
+            const double count   = static_cast<double>(stop.count - start_[i].count);
+            totals_[i] += running > 0 ? count * enabled / running : 0.0;
+        }
+        ++regions_;
+    }
+
+    /// \brief Returns the averages per timed region since the previous call, by counter name,
+    /// together with the instructions per cycle when both were counted.
+    std::map<std::string, double> take()
+    {
+        std::map<std::string, double> result;
+        if(regions_ == 0)
+        {
+            return result;
+        }
+
+        for(std::size_t i = 0; i < fds_.size(); ++i)
+        {
+            result[names_[i]] = totals_[i] / static_cast<double>(regions_);
+            totals_[i]        = 0.0;
+        }
+        regions_ = 0;
+
+        if(result.count("cycles") && result.count("instructions") && result["cycles"] > 0)
+        {
+            result["ipc"] = result["instructions"] / result["cycles"];
+        }
+        return result;
+    }
+
+    ~perf_counters()
+    {
+#if ROCTHRUST_BENCHMARKS_HAVE_PERF_EVENTS
+        for(int fd : fds_)
+        {
+            close(fd);
+        }
+#endif
+    }
+
+    perf_counters(const perf_counters&)            = delete;
+    perf_counters& operator=(const perf_counters&) = delete;
+
+private:
+    struct value
+    {
+        std::uint64_t count;
+        std::uint64_t enabled;
+        std::uint64_t running;
+    };
+
+    std::vector<int>         fds_;
+    std::vector<std::string> names_;
+    std::vector<value>       start_;
+    std::vector<double>      totals_;
+    std::size_t              regions_ = 0;
+    std::string              error_;
+
+    perf_counters() = default;
+
+    static value read_value(int fd)
+    {
+        value v {0, 0, 0};
+#if ROCTHRUST_BENCHMARKS_HAVE_PERF_EVENTS
+        if(read(fd, &v, sizeof(v)) != static_cast<ssize_t>(sizeof(v)))
+        {
+            v = value {0, 0, 0};
+        }
+#else
+        (void)fd;
+#endif
+        return v;
+    }
+
+    static std::vector<event> events()
+    {
+#if ROCTHRUST_BENCHMARKS_HAVE_PERF_EVENTS
+        const std::uint64_t read_miss
+            = (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        return {
+            {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            // Usually the misses of the last level cache
+            {"llc_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {"dtlb_misses", PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | read_miss},
+            {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        };
+#else
+        return {};
+#endif
+    }
+};
+
+/// \brief Returns whether a counter of a benchmark run comes from \p perf_counters
+inline bool is_perf_counter(const std::string& name)
+{
+    return name == "cycles" || name == "instructions" || name == "llc_misses"
+           || name == "dtlb_misses" || name == "branch_misses" || name == "ipc";
+}
+
+/// \brief Reporter adding the counters collected by \p perf_counters during the runs of each
+/// benchmark to its results, before forwarding them to another reporter. The counters are averages
+/// over all runs of the benchmark, and are added to single runs and to the mean and median of
+/// repetitions.
+class PerfCountersReporter : public benchmark::BenchmarkReporter
+{
+private:
+    benchmark::BenchmarkReporter* reporter_;
+
+public:
+    explicit PerfCountersReporter(benchmark::BenchmarkReporter* reporter)
+        : reporter_(reporter)
+    {}
+
+    bool ReportContext(const Context& context) override
+    {
+        return reporter_->ReportContext(context);
+    }
+
+    void ReportRuns(const std::vector<Run>& reports) override
+    {
+        const std::map<std::string, double> values = perf_counters::instance().take();
+
+        std::vector<Run> runs(reports);
+        for(auto& run : runs)
+        {
+            if(run.skipped || run.report_big_o || run.report_rms
+               || (run.run_type == Run::RT_Aggregate && run.aggregate_name != "mean"
+                   && run.aggregate_name != "median"))
+            {
+                continue;
+            }
+
+            for(const auto& value : values)
+            {
+                run.counters[value.first] = benchmark::Counter(value.second);
+            }
+        }
+        reporter_->ReportRuns(runs);
+    }
+
+    void Finalize() override
+    {
+        reporter_->Finalize();
+    }
+};
+
+} // namespace bench_utils
+
+#undef ROCTHRUST_BENCHMARKS_HAVE_PERF_EVENTS
+
+#endif // ROCTHRUST_BENCHMARKS_BENCH_UTILS_PERF_COUNTERS_HPP_
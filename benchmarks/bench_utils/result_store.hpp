@@ -0,0 +1,349 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef ROCTHRUST_BENCHMARKS_BENCH_UTILS_RESULT_STORE_HPP_
+#define ROCTHRUST_BENCHMARKS_BENCH_UTILS_RESULT_STORE_HPP_
+
+#include <thrust/detail/config.h>
+
+// SQLite
+#include <sqlite3.h>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// STL
+#include <chrono>
+#include <ctime>
+#include <map>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Written on every build, see cmake/BenchmarksGitRevision.cmake
+#if __has_include(<rocthrust_benchmarks_git_revision.hpp>)
+#include <rocthrust_benchmarks_git_revision.hpp>
+#endif
+#ifndef ROCTHRUST_BENCHMARKS_GIT_REVISION
+#define ROCTHRUST_BENCHMARKS_GIT_REVISION "unknown"
+#endif
+
+namespace bench_utils
+{
+
+/// \brief Returns the name of the system the benchmarks are built for, as in THRUST_DEVICE_SYSTEM.
+inline std::string backend_name()
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+    return "OMP";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+    return "TBB";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CPP
+    return "CPP";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+    return "CUDA";
+#else
+    return "HIP";
+#endif
+}
+
+/// \brief SQLite database the results of the benchmarks are appended to, so that the results of
+/// different revisions can be compared with scripts/compare_benchmark_store.py.
+///
+/// Every row is one trial of a benchmark: a single run, or one of the repetitions of
+/// --benchmark_repetitions. Rows are keyed by the git revision, the name of the benchmark, the
+/// backend and the number of host threads. The algorithm, type and number of elements are parsed
+/// from the name of the benchmark to ease queries. The time is the time of one iteration, in
+/// seconds.
+class result_store
+{
+public:
+    /// \brief Opens the database, creating the file and its table if they don't exist yet.
+    /// \param db_path Path to the database file (eg. "./results.db").
+    /// \param revision Revision the results are stored under; the revision the benchmarks were
+    /// built from if empty.
+    result_store(const std::string& db_path, const std::string& revision)
+        : db_(nullptr)
+        , insert_stmt_(nullptr)
+        , revision_(revision.empty() ? ROCTHRUST_BENCHMARKS_GIT_REVISION : revision)
+        , session_(current_time())
+    {
+        if(sqlite3_open(db_path.c_str(), &db_) != SQLITE_OK)
+        {
+            sqlite3_close(db_);
+            throw std::runtime_error("Cannot open the benchmark result store: " + db_path);
+        }
+
+        // Several benchmarks may store their results at the same time
+        sqlite3_busy_timeout(db_, 30000);
+        exec("PRAGMA journal_mode = WAL");
+        exec("CREATE TABLE IF NOT EXISTS benchmark_result("
+             "revision TEXT NOT NULL, "
+             "session TEXT NOT NULL, "
+             "name TEXT NOT NULL, "
+             "algorithm TEXT, "
+             "subalgorithm TEXT, "
+             "type TEXT, "
+             "elements INTEGER, "
+             "backend TEXT NOT NULL, "
+             "threads INTEGER NOT NULL, "
+             "trial INTEGER NOT NULL, "
+             "iterations INTEGER NOT NULL, "
+             "time REAL NOT NULL, "
+             "bytes_per_second REAL, "
+             "items_per_second REAL);"
+             "CREATE INDEX IF NOT EXISTS benchmark_result_key ON benchmark_result("
+             "name, backend, threads, revision);");
+
+        const char* insert_sql
+            = "INSERT INTO benchmark_result(revision, session, name, algorithm, subalgorithm, "
+              "type, elements, backend, threads, trial, iterations, time, bytes_per_second, "
+              "items_per_second) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
+        if(sqlite3_prepare_v2(db_, insert_sql, -1, &insert_stmt_, nullptr) != SQLITE_OK)
+        {
+            const std::string error = sqlite3_errmsg(db_);
+            sqlite3_close(db_);
+            throw std::runtime_error("Cannot prepare insert statement: " + error);
+        }
+    }
+
+    ~result_store()
+    {
+        sqlite3_finalize(insert_stmt_);
+        sqlite3_close(db_);
+    }
+
+    result_store(const result_store&)            = delete;
+    result_store& operator=(const result_store&) = delete;
+
+    const std::string& revision() const
+    {
+        return revision_;
+    }
+
+    /// \brief Appends the trials among \p runs, all in one transaction. Aggregates and skipped
+    /// runs are not stored.
+    void append(const std::vector<benchmark::BenchmarkReporter::Run>& runs, int threads)
+    {
+        exec("BEGIN");
+        for(const auto& run : runs)
+        {
+            if(run.skipped || run.run_type != benchmark::BenchmarkReporter::Run::RT_Iteration)
+            {
+                continue;
+            }
+            insert(run, threads);
+        }
+        exec("COMMIT");
+    }
+
+private:
+    sqlite3*      db_;
+    sqlite3_stmt* insert_stmt_;
+    std::string   revision_;
+    std::string   session_;
+
+    static std::string current_time()
+    {
+        const std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+        char              buffer[32];
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+        return buffer;
+    }
+
+    /// \brief Parses the key:value fields of the name of a benchmark, which are kept by the txt
+    /// and json name formats, but not by the human one.
+    static std::map<std::string, std::string> parse_fields(const std::string& name)
+    {
+        std::map<std::string, std::string> fields;
+        const std::regex                   field("\"?([A-Za-z0-9_]+)\"?:\"?([^,\"{}]*)\"?");
+        for(auto it = std::sregex_iterator(name.begin(), name.end(), field);
+            it != std::sregex_iterator();
+            ++it)
+        {
+            fields.emplace((*it)[1].str(), (*it)[2].str());
+        }
+        return fields;
+    }
+
+    /// \brief Parses the number of elements of a benchmark, written as a number or as a shift
+    /// like "1 << 20".
+    static bool parse_elements(const std::string& value, long long& count)
+    {
+        std::smatch match;
+        if(std::regex_match(value, match, std::regex("\\s*([0-9]+)\\s*")))
+        {
+            count = std::stoll(match[1].str());
+            return true;
+        }
+        if(std::regex_match(value, match, std::regex("\\s*([0-9]+)\\s*<<\\s*([0-9]+)\\s*")))
+        {
+            count = std::stoll(match[1].str()) << std::stoi(match[2].str());
+            return true;
+        }
+        return false;
+    }
+
+    void exec(const char* sql)
+    {
+        if(sqlite3_exec(db_, sql, nullptr, nullptr, nullptr) != SQLITE_OK)
+        {
+            throw std::runtime_error("Error executing \"" + std::string(sql)
+                                     + "\": " + sqlite3_errmsg(db_));
+        }
+    }
+
+    void bind_text(int index, const std::string& value)
+    {
+        sqlite3_bind_text(insert_stmt_, index, value.c_str(), -1, SQLITE_TRANSIENT);
+    }
+
+    void bind_optional_text(int index, const std::map<std::string, std::string>& fields, const std::string& key)
+    {
+        const auto it = fields.find(key);
+        if(it != fields.end())
+        {
+            bind_text(index, it->second);
+        }
+        else
+        {
+            sqlite3_bind_null(insert_stmt_, index);
+        }
+    }
+
+    void bind_optional_double(int index, const benchmark::UserCounters& counters, const std::string& key)
+    {
+        const auto it = counters.find(key);
+        if(it != counters.end())
+        {
+            sqlite3_bind_double(insert_stmt_, index, it->second.value);
+        }
+        else
+        {
+            sqlite3_bind_null(insert_stmt_, index);
+        }
+    }
+
+    void insert(const benchmark::BenchmarkReporter::Run& run, int threads)
+    {
+        const std::string                        name   = run.run_name.function_name;
+        const std::map<std::string, std::string> fields = parse_fields(name);
+
+        // The type of the keys or of the input, followed by the type of the values if any
+        std::string type;
+        for(const char* key : {"input_type", "key_type", "value_type"})
+        {
+            const auto it = fields.find(key);
+            if(it != fields.end())
+            {
+                type += (type.empty() ? "" : ",") + it->second;
+            }
+        }
+
+        const auto threads_counter = run.counters.find("host_threads");
+        if(threads_counter != run.counters.end())
+        {
+            threads = static_cast<int>(threads_counter->second.value);
+        }
+
+        sqlite3_reset(insert_stmt_);
+        bind_text(1, revision_);
+        bind_text(2, session_);
+        bind_text(3, name);
+        bind_optional_text(4, fields, "algo");
+        bind_optional_text(5, fields, "subalgo");
+        if(!type.empty())
+        {
+            bind_text(6, type);
+        }
+        else
+        {
+            sqlite3_bind_null(insert_stmt_, 6);
+        }
+        const auto elements = fields.find("elements");
+        long long  count    = 0;
+        if(elements != fields.end() && parse_elements(elements->second, count))
+        {
+            sqlite3_bind_int64(insert_stmt_, 7, count);
+        }
+        else
+        {
+            sqlite3_bind_null(insert_stmt_, 7);
+        }
+        bind_text(8, backend_name());
+        sqlite3_bind_int(insert_stmt_, 9, threads);
+        sqlite3_bind_int64(insert_stmt_, 10, run.repetition_index);
+        sqlite3_bind_int64(insert_stmt_, 11, run.iterations);
+        sqlite3_bind_double(insert_stmt_,
+                            12,
+                            run.GetAdjustedRealTime()
+                                / benchmark::GetTimeUnitMultiplier(run.time_unit));
+        bind_optional_double(13, run.counters, "bytes_per_second");
+        bind_optional_double(14, run.counters, "items_per_second");
+
+        if(sqlite3_step(insert_stmt_) != SQLITE_DONE)
+        {
+            throw std::runtime_error("Error executing insert statement: "
+                                     + std::string(sqlite3_errmsg(db_)));
+        }
+    }
+};
+
+/// \brief Reporter appending the results of the benchmarks to a \p result_store, before forwarding
+/// them to another reporter.
+class ResultStoreReporter : public benchmark::BenchmarkReporter
+{
+private:
+    benchmark::BenchmarkReporter* reporter_;
+    result_store&                 store_;
+    int                           threads_;
+
+public:
+    /// \param threads Number of host threads the benchmarks run with, unless a run says otherwise
+    /// with a host_threads counter.
+    ResultStoreReporter(benchmark::BenchmarkReporter* reporter, result_store& store, int threads)
+        : reporter_(reporter)
+        , store_(store)
+        , threads_(threads)
+    {}
+
+    bool ReportContext(const Context& context) override
+    {
+        return reporter_->ReportContext(context);
+    }
+
+    void ReportRuns(const std::vector<Run>& reports) override
+    {
+        store_.append(reports, threads_);
+        reporter_->ReportRuns(reports);
+    }
+
+    void Finalize() override
+    {
+        reporter_->Finalize();
+    }
+};
+
+} // namespace bench_utils
+
+#endif // ROCTHRUST_BENCHMARKS_BENCH_UTILS_RESULT_STORE_HPP_
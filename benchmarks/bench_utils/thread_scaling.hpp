@@ -0,0 +1,348 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef ROCTHRUST_BENCHMARKS_BENCH_UTILS_THREAD_SCALING_HPP_
+#define ROCTHRUST_BENCHMARKS_BENCH_UTILS_THREAD_SCALING_HPP_
+
+// Utils
+#include "cmdparser.hpp"
+#include "custom_reporter.hpp"
+#include "perf_counters.hpp"
+#include "result_store.hpp"
+
+#include <thrust/detail/config.h>
+
+// The host backend the benchmarks are built for
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#endif
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// STL
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace bench_utils
+{
+
+/// \brief Returns the number of threads the host backend runs its algorithms on by default,
+/// which is 1 for the CPP backend and for the device backends.
+inline int host_max_threads()
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+    return omp_get_max_threads();
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+    return tbb::this_task_arena::max_concurrency();
+#else
+    return 1;
+#endif
+}
+
+/// \brief Limits the number of threads of the host backend while in scope: with the OMP thread
+/// limit of the calling thread for OMP, and with \p tbb::global_control for TBB.
+class thread_limit
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+    int previous_threads_;
+
+public:
+    explicit thread_limit(int threads)
+        : previous_threads_(omp_get_max_threads())
+    {
+        omp_set_num_threads(threads);
+    }
+
+    ~thread_limit()
+    {
+        omp_set_num_threads(previous_threads_);
+    }
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+    tbb::global_control control_;
+
+public:
+    explicit thread_limit(int threads)
+        : control_(tbb::global_control::max_allowed_parallelism, static_cast<std::size_t>(threads))
+    {}
+#else
+public:
+    explicit thread_limit(int /*threads*/) {}
+#endif
+
+    thread_limit(const thread_limit&)            = delete;
+    thread_limit& operator=(const thread_limit&) = delete;
+};
+
+/// \brief Returns the numbers of threads of a scaling sweep: the powers of two below
+/// \p max_threads, followed by \p max_threads itself.
+inline std::vector<int> scaling_thread_counts(int max_threads)
+{
+    std::vector<int> counts;
+    for(int threads = 1; threads < max_threads; threads *= 2)
+    {
+        counts.push_back(threads);
+    }
+    counts.push_back(max_threads < 1 ? 1 : max_threads);
+    return counts;
+}
+
+/// \brief Reporter of a thread-scaling sweep, which runs every benchmark once per number of
+/// threads and forwards the results to one of the custom reporters.
+///
+/// The number of threads is appended to the name of each run as \p host_threads:N, and each run
+/// gets the counters:
+/// - host_threads: the number of threads the run was limited to.
+/// - speedup: the time of the same run with one thread divided by its time.
+/// - parallel_efficiency: the speedup divided by the number of threads.
+/// The speedup and efficiency are only computed for single runs and for the mean and median of
+/// repetitions, as the other aggregates are not times. The achieved bandwidth is the usual
+/// \p bytes_per_second counter of the benchmarks.
+class ScalingReporter : public benchmark::BenchmarkReporter
+{
+private:
+    benchmark::BenchmarkReporter* reporter_;
+    int                           threads_          = 1;
+    bool                          reported_context_ = false;
+
+    // Times of the runs with one thread, by name and repetition
+    std::map<std::string, double> single_thread_times_;
+
+    static bool is_time(const Run& run)
+    {
+        if(run.skipped || run.report_big_o || run.report_rms)
+        {
+            return false;
+        }
+        return run.run_type == Run::RT_Iteration || run.aggregate_name == "mean"
+               || run.aggregate_name == "median";
+    }
+
+    static std::string key(const Run& run)
+    {
+        std::string key = run.benchmark_name();
+        if(run.run_type == Run::RT_Iteration)
+        {
+            key += "#" + std::to_string(run.repetition_index);
+        }
+        return key;
+    }
+
+public:
+    explicit ScalingReporter(benchmark::BenchmarkReporter* reporter)
+        : reporter_(reporter)
+    {}
+
+    void set_threads(int threads)
+    {
+        threads_ = threads;
+    }
+
+    // The context is the same for every number of threads, so it's only reported once
+    bool ReportContext(const Context& context) override
+    {
+        if(reported_context_)
+        {
+            return true;
+        }
+        reported_context_ = true;
+        return reporter_->ReportContext(context);
+    }
+
+    void ReportRuns(const std::vector<Run>& reports) override
+    {
+        std::vector<Run> runs(reports);
+        for(auto& run : runs)
+        {
+            if(is_time(run))
+            {
+                const double time = run.GetAdjustedRealTime();
+                if(threads_ == 1)
+                {
+                    single_thread_times_[key(run)] = time;
+                }
+
+                auto single_thread_time = single_thread_times_.find(key(run));
+                if(single_thread_time != single_thread_times_.end() && time > 0)
+                {
+                    const double speedup = single_thread_time->second / time;
+                    run.counters["speedup"]             = benchmark::Counter(speedup);
+                    run.counters["parallel_efficiency"] = benchmark::Counter(speedup / threads_);
+                }
+            }
+
+            run.counters["host_threads"] = benchmark::Counter(threads_);
+            run.run_name.threads         = "host_threads:" + std::to_string(threads_);
+        }
+        reporter_->ReportRuns(runs);
+    }
+
+    // Each number of threads is a separate run of the benchmarks, and the reporter is only
+    // finalized after the last one by finish()
+    void Finalize() override {}
+
+    void finish()
+    {
+        reporter_->Finalize();
+    }
+};
+
+/// \brief Adds the command line options of \p run_benchmarks: the thread-scaling sweep, the
+/// hardware performance counters and the result store.
+inline void add_run_options(cli::Parser& parser)
+{
+    parser.set_optional<bool>("scaling",
+                              "scaling",
+                              false,
+                              "run each benchmark at 1, 2, 4, ... threads of the host backend, "
+                              "reporting the speedup and parallel efficiency");
+    parser.set_optional<int>("max_threads",
+                             "max_threads",
+                             0,
+                             "the largest number of threads of the scaling sweep, 0 for the "
+                             "default number of threads of the host backend");
+    parser.set_optional<bool>("perf_counters",
+                              "perf_counters",
+                              false,
+                              "record the cycles, instructions, LLC, dTLB and branch misses of "
+                              "each benchmark with perf_event_open");
+    parser.set_optional<std::string>("results_db",
+                                     "results_db",
+                                     "",
+                                     "SQLite database to append the results to, see "
+                                     "scripts/compare_benchmark_store.py");
+    parser.set_optional<std::string>("revision",
+                                     "revision",
+                                     "",
+                                     "revision to store the results under, the git revision the "
+                                     "benchmarks were built from by default");
+}
+
+/// \brief Starts collecting the hardware performance counters, returning false if they are not
+/// available. The counters are reported in the context of the benchmarks either way.
+inline bool enable_perf_counters()
+{
+#if(THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_HIP) \
+    || (THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA)
+    std::cerr << "The performance counters are only collected for the host backends" << std::endl;
+    benchmark::AddCustomContext("perf_counters", "unavailable: device backend");
+    return false;
+#else
+    perf_counters& counters = perf_counters::instance();
+    if(!counters.enable())
+    {
+        std::cerr << "The performance counters are not available: " << counters.error()
+                  << std::endl;
+        benchmark::AddCustomContext("perf_counters", "unavailable: " + counters.error());
+        return false;
+    }
+
+    std::string names;
+    for(const auto& name : counters.names())
+    {
+        names += (names.empty() ? "" : ",") + name;
+    }
+    benchmark::AddCustomContext("perf_counters", names);
+    return true;
+#endif
+}
+
+/// \brief Runs the benchmarks selected on the command line with the custom reporter, once or,
+/// with --scaling, once per number of threads of the sweep. With --perf_counters, the hardware
+/// performance counters of each benchmark are added to its results, and with --results_db, the
+/// results are appended to a \p result_store.
+inline void run_benchmarks(const cli::Parser& parser)
+{
+    const bool scaling = parser.get<bool>("scaling");
+
+    benchmark::BenchmarkReporter* reporter = ChooseCustomReporter();
+
+    std::unique_ptr<result_store>        store;
+    std::unique_ptr<ResultStoreReporter> store_reporter;
+    const std::string                    results_db = parser.get<std::string>("results_db");
+    if(!results_db.empty())
+    {
+        try
+        {
+            store.reset(new result_store(results_db, parser.get<std::string>("revision")));
+        }
+        catch(const std::exception& e)
+        {
+            std::cerr << e.what() << std::endl;
+            std::exit(1);
+        }
+        benchmark::AddCustomContext("revision", store->revision());
+        store_reporter.reset(new ResultStoreReporter(reporter, *store, host_max_threads()));
+        reporter = store_reporter.get();
+    }
+
+    ScalingReporter scaling_reporter(reporter);
+    if(scaling)
+    {
+        reporter = &scaling_reporter;
+    }
+
+    // The counters are opened before the first benchmark starts the threads of the backend, so
+    // that they are inherited by all of them
+    PerfCountersReporter perf_reporter(reporter);
+    if(parser.get<bool>("perf_counters") && enable_perf_counters())
+    {
+        reporter = &perf_reporter;
+    }
+
+    if(!scaling)
+    {
+        benchmark::RunSpecifiedBenchmarks(reporter);
+        return;
+    }
+
+    int max_threads = parser.get<int>("max_threads");
+    if(max_threads <= 0)
+    {
+        max_threads = host_max_threads();
+    }
+#if(THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_OMP) \
+    && (THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_TBB)
+    std::cerr << "The scaling sweep needs the OMP or TBB backend, running with one thread"
+              << std::endl;
+    max_threads = 1;
+#endif
+
+    for(int threads : scaling_thread_counts(max_threads))
+    {
+        thread_limit limit(threads);
+        scaling_reporter.set_threads(threads);
+        benchmark::RunSpecifiedBenchmarks(reporter);
+    }
+    scaling_reporter.finish();
+}
+
+} // namespace bench_utils
+
+#endif // ROCTHRUST_BENCHMARKS_BENCH_UTILS_THREAD_SCALING_HPP_
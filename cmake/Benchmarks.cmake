@@ -34,6 +34,42 @@ function(find_rocrand)
     endif()
 endfunction()
 
+# The git revision the results of the benchmarks are stored under, see --results_db.
+# It is looked up on every build rather than at configure time, so that a build directory
+# reused across commits does not store results under a stale revision.
+set(ROCTHRUST_GIT_REVISION_DIR "${CMAKE_BINARY_DIR}/benchmarks/git_revision")
+if(NOT TARGET rocthrust_benchmarks_git_revision)
+    add_custom_target(rocthrust_benchmarks_git_revision
+        COMMAND ${CMAKE_COMMAND}
+            -DSOURCE_DIR=${CMAKE_CURRENT_LIST_DIR}
+            -DOUTPUT_FILE=${ROCTHRUST_GIT_REVISION_DIR}/rocthrust_benchmarks_git_revision.hpp
+            -P ${CMAKE_CURRENT_LIST_DIR}/BenchmarksGitRevision.cmake
+        BYPRODUCTS ${ROCTHRUST_GIT_REVISION_DIR}/rocthrust_benchmarks_git_revision.hpp
+        COMMENT "Looking up the git revision of the benchmarks"
+    )
+endif()
+
+# Builds a benchmark for the host backend selected with THRUST_DEVICE_SYSTEM, which
+# replaces HIP as the system of thrust::device_vector and thrust::device
+function(target_link_thrust_device_system BENCHMARK_TARGET)
+    target_compile_definitions(${BENCHMARK_TARGET}
+        PRIVATE
+            THRUST_DEVICE_SYSTEM=THRUST_DEVICE_SYSTEM_${THRUST_DEVICE_SYSTEM}
+    )
+    # The sources are compiled as plain C++, not HIP, so that no HIP install is needed
+    target_compile_options(${BENCHMARK_TARGET}
+        PRIVATE
+            -x c++
+    )
+    if(THRUST_DEVICE_SYSTEM STREQUAL "OMP")
+        find_package(OpenMP REQUIRED)
+        target_link_libraries(${BENCHMARK_TARGET} PRIVATE OpenMP::OpenMP_CXX)
+    elseif(THRUST_DEVICE_SYSTEM STREQUAL "TBB")
+        find_package(TBB REQUIRED)
+        target_link_libraries(${BENCHMARK_TARGET} PRIVATE TBB::tbb)
+    endif()
+endfunction()
+
 # Registers a .cu as C++ rocThrust benchmark
 function(add_thrust_benchmark BENCHMARK_NAME BENCHMARK_SOURCE NOT_INTERNAL)
     set(BENCHMARK_TARGET "benchmark_thrust_${BENCHMARK_NAME}")
@@ -43,27 +79,55 @@ function(add_thrust_benchmark BENCHMARK_NAME BENCHMARK_SOURCE NOT_INTERNAL)
     )
     add_executable(${BENCHMARK_TARGET} ${BENCHMARK_SOURCE})
 
-    target_link_libraries(${BENCHMARK_TARGET}
-        PRIVATE
-            rocthrust
-            roc::rocprim_hip
-    )
+    # The host backends only use the headers of rocThrust, and generate their
+    # input data without rocRAND.
     # Internal benchmark does not use Google Benchmark nor rocRAND.
     # This can be omited when that benchmark is removed.
-    if(NOT_INTERNAL)
-        find_rocrand()
+    if(THRUST_DEVICE_SYSTEM STREQUAL "HIP")
         target_link_libraries(${BENCHMARK_TARGET}
             PRIVATE
-                roc::rocrand
-                benchmark::benchmark
-    )
+                rocthrust
+                roc::rocprim_hip
+        )
+        if(NOT_INTERNAL)
+            find_rocrand()
+            target_link_libraries(${BENCHMARK_TARGET}
+                PRIVATE
+                    roc::rocrand
+                    benchmark::benchmark
+            )
+        endif()
+        foreach(gpu_target ${GPU_TARGETS})
+            target_link_libraries(${BENCHMARK_TARGET}
+                INTERFACE
+                    --cuda-gpu-arch=${gpu_target}
+            )
+        endforeach()
+    else()
+        target_include_directories(${BENCHMARK_TARGET}
+            PRIVATE
+                $<TARGET_PROPERTY:rocthrust,INTERFACE_INCLUDE_DIRECTORIES>
+        )
+        target_link_thrust_device_system(${BENCHMARK_TARGET})
+        if(NOT_INTERNAL)
+            target_link_libraries(${BENCHMARK_TARGET}
+                PRIVATE
+                    benchmark::benchmark
+            )
+        endif()
     endif()
-    foreach(gpu_target ${GPU_TARGETS})
+    # The results of the benchmarks can be stored in an SQLite database
+    if(NOT_INTERNAL)
+        add_dependencies(${BENCHMARK_TARGET} rocthrust_benchmarks_git_revision)
+        target_include_directories(${BENCHMARK_TARGET}
+            PRIVATE
+                ${ROCTHRUST_GIT_REVISION_DIR}
+        )
         target_link_libraries(${BENCHMARK_TARGET}
-            INTERFACE
-                --cuda-gpu-arch=${gpu_target}
+            PRIVATE
+                sqlite3
         )
-    endforeach()
+    endif()
 
     # Separate normal from internal benchmarks
     if(NOT_INTERNAL)
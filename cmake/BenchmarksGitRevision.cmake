@@ -0,0 +1,26 @@
+#!/usr/bin/cmake -P
+
+# Writes the git revision of SOURCE_DIR to OUTPUT_FILE as ROCTHRUST_BENCHMARKS_GIT_REVISION.
+# Run on every build, so that the results of the benchmarks are stored under the revision
+# they were built from, not the one the build directory was configured at. The file is
+# only rewritten when the revision changes, so the benchmarks are not rebuilt otherwise.
+
+execute_process(
+  COMMAND git rev-parse --short HEAD
+  WORKING_DIRECTORY ${SOURCE_DIR}
+  OUTPUT_VARIABLE GIT_REVISION
+  OUTPUT_STRIP_TRAILING_WHITESPACE
+  ERROR_QUIET
+)
+if(NOT GIT_REVISION)
+  set(GIT_REVISION "unknown")
+endif()
+
+set(CONTENT "// Generated by cmake/BenchmarksGitRevision.cmake\n#define ROCTHRUST_BENCHMARKS_GIT_REVISION \"${GIT_REVISION}\"\n")
+
+if(EXISTS ${OUTPUT_FILE})
+  file(READ ${OUTPUT_FILE} OLD_CONTENT)
+endif()
+if(NOT CONTENT STREQUAL OLD_CONTENT)
+  file(WRITE ${OUTPUT_FILE} "${CONTENT}")
+endif()
@@ -13,25 +13,28 @@
 include(cmake/DownloadProject.cmake)
 
 # rocPRIM (https://github.com/ROCmSoftwarePlatform/rocPRIM)
-if(NOT DOWNLOAD_ROCPRIM)
-  find_package(rocprim QUIET)
-endif()
-if(NOT rocprim_FOUND)
-  message(STATUS "Downloading and building rocprim.")
-  download_project(
-    PROJ                rocprim
-    GIT_REPOSITORY      https://github.com/ROCmSoftwarePlatform/rocPRIM.git
-    GIT_TAG             develop
-    INSTALL_DIR         ${CMAKE_CURRENT_BINARY_DIR}/deps/rocprim
-    CMAKE_ARGS          -DBUILD_TEST=OFF -DCMAKE_INSTALL_PREFIX=<INSTALL_DIR> -DCMAKE_PREFIX_PATH=/opt/rocm
-    LOG_DOWNLOAD        TRUE
-    LOG_CONFIGURE       TRUE
-    LOG_BUILD           TRUE
-    LOG_INSTALL         TRUE
-    BUILD_PROJECT       TRUE
-    UPDATE_DISCONNECTED TRUE # Never update automatically from the remote repository
-  )
-  find_package(rocprim REQUIRED CONFIG PATHS ${CMAKE_CURRENT_BINARY_DIR}/deps/rocprim NO_DEFAULT_PATH)
+# The host backends, built alone for their benchmarks, do not use it
+if(NOT ROCTHRUST_HOST_ONLY)
+  if(NOT DOWNLOAD_ROCPRIM)
+    find_package(rocprim QUIET)
+  endif()
+  if(NOT rocprim_FOUND)
+    message(STATUS "Downloading and building rocprim.")
+    download_project(
+      PROJ                rocprim
+      GIT_REPOSITORY      https://github.com/ROCmSoftwarePlatform/rocPRIM.git
+      GIT_TAG             develop
+      INSTALL_DIR         ${CMAKE_CURRENT_BINARY_DIR}/deps/rocprim
+      CMAKE_ARGS          -DBUILD_TEST=OFF -DCMAKE_INSTALL_PREFIX=<INSTALL_DIR> -DCMAKE_PREFIX_PATH=/opt/rocm
+      LOG_DOWNLOAD        TRUE
+      LOG_CONFIGURE       TRUE
+      LOG_BUILD           TRUE
+      LOG_INSTALL         TRUE
+      BUILD_PROJECT       TRUE
+      UPDATE_DISCONNECTED TRUE # Never update automatically from the remote repository
+    )
+    find_package(rocprim REQUIRED CONFIG PATHS ${CMAKE_CURRENT_BINARY_DIR}/deps/rocprim NO_DEFAULT_PATH)
+  endif()
 endif()
 
 # Test dependencies
@@ -62,8 +65,10 @@ if(BUILD_TEST)
     )
     find_package(GTest REQUIRED CONFIG PATHS ${GTEST_ROOT})
   endif()
+endif()
 
-  # SQlite (for run-to-run bitwise-reproducibility tests)
+# SQLite (for run-to-run bitwise-reproducibility tests and the benchmark result store)
+if(BUILD_TEST OR BUILD_BENCHMARKS)
   # Note: SQLite 3.36.0 enabled the backup API by default, which we need
   # for cache serialization.  We also want to use a static SQLite,
   # and distro static libraries aren't typically built
@@ -43,5 +43,6 @@ endif()
     message(STATUS "  BUILD_HIPSTDPAR_TEST      : ${BUILD_HIPSTDPAR_TEST}")
     message(STATUS "  BUILD_EXAMPLES            : ${BUILD_EXAMPLES}")
     message(STATUS "  BUILD_BENCHMARKS          : ${BUILD_BENCHMARKS}")
+    message(STATUS "  THRUST_DEVICE_SYSTEM      : ${THRUST_DEVICE_SYSTEM}")
     message(STATUS "  BUILD_ADDRESS_SANITIZER   : ${BUILD_ADDRESS_SANITIZER}")
 endfunction()
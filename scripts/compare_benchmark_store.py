@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+"""Compares the results of two revisions in the SQLite store the benchmarks
+append to with --results_db.
+
+The trials of each benchmark (its repetitions, over all the sessions it was
+run in) are compared with a Mann-Whitney U test, or with a bootstrap
+confidence interval of the ratio of the median times. A benchmark regressed
+when the difference is significant and its median time grew by more than the
+threshold. The script exits with 1 when a benchmark regressed, so that it can
+gate CI jobs.
+
+Only the Python standard library is needed.
+"""
+
+import argparse
+from collections import namedtuple
+import math
+import random
+import re
+import sqlite3
+import sys
+
+Comparison = namedtuple('Comparison', ['name', 'backend', 'threads', 'baseline', 'candidate', 'ratio', 'low', 'high', 'p_value', 'verdict'])
+
+def median(values):
+    values = sorted(values)
+    n = len(values)
+    middle = n // 2
+    return values[middle] if n % 2 else (values[middle - 1] + values[middle]) / 2
+
+def mann_whitney_p_value(x, y):
+    """Two-sided p-value of the Mann-Whitney U test, with the normal
+    approximation corrected for ties and continuity."""
+    n1, n2 = len(x), len(y)
+    ranked = sorted([(value, 0) for value in x] + [(value, 1) for value in y])
+
+    # Average ranks over ties
+    ranks = [0.0] * len(ranked)
+    tie_correction = 0.0
+    i = 0
+    while i < len(ranked):
+        j = i
+        while j + 1 < len(ranked) and ranked[j + 1][0] == ranked[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2 + 1
+        ties = j - i + 1
+        tie_correction += ties ** 3 - ties
+        i = j + 1
+
+    rank_sum = sum(rank for rank, (_, group) in zip(ranks, ranked) if group == 0)
+    u = rank_sum - n1 * (n1 + 1) / 2
+    mean = n1 * n2 / 2
+    n = n1 + n2
+    variance = n1 * n2 / 12 * ((n + 1) - tie_correction / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+    z = (abs(u - mean) - 0.5) / math.sqrt(variance)
+    return min(1.0, math.erfc(max(z, 0.0) / math.sqrt(2)))
+
+def bootstrap_interval(x, y, alpha, samples, rng):
+    """Percentile bootstrap confidence interval of median(y) / median(x)."""
+    ratios = []
+    for _ in range(samples):
+        baseline = median(rng.choices(x, k=len(x)))
+        candidate = median(rng.choices(y, k=len(y)))
+        ratios.append(candidate / baseline)
+    ratios.sort()
+    low = ratios[int(alpha / 2 * (samples - 1))]
+    high = ratios[int((1 - alpha / 2) * (samples - 1))]
+    return low, high
+
+def load_trials(connection, revision, args):
+    query = 'SELECT name, backend, threads, time FROM benchmark_result WHERE revision = ?'
+    parameters = [revision]
+    if args.backend:
+        query += ' AND backend = ?'
+        parameters.append(args.backend)
+    if args.threads:
+        query += ' AND threads = ?'
+        parameters.append(args.threads)
+
+    name_filter = re.compile(args.filter)
+    trials = {}
+    for name, backend, threads, time in connection.execute(query, parameters):
+        if name_filter.search(name):
+            trials.setdefault((name, backend, threads), []).append(time)
+    return trials
+
+def latest_revisions(connection):
+    """The revisions in the store, from the one stored first to the last one."""
+    rows = connection.execute('SELECT revision, MIN(session) AS first FROM benchmark_result GROUP BY revision ORDER BY first')
+    return [revision for revision, _ in rows]
+
+def compare(baseline_trials, candidate_trials, args):
+    rng = random.Random(args.seed)
+    comparisons = []
+    for key in sorted(baseline_trials.keys() & candidate_trials.keys()):
+        x, y = baseline_trials[key], candidate_trials[key]
+        ratio = median(y) / median(x)
+        low, high, p_value = None, None, None
+
+        if min(len(x), len(y)) < args.min_trials:
+            verdict = 'too few trials'
+        else:
+            if args.method == 'mannwhitney':
+                p_value = mann_whitney_p_value(x, y)
+                significant = p_value < args.alpha
+            else:
+                low, high = bootstrap_interval(x, y, args.alpha, args.bootstrap_samples, rng)
+                significant = low > 1 or high < 1
+
+            if significant and ratio > 1 + args.threshold:
+                verdict = 'regression'
+            elif significant and ratio < 1 - args.threshold:
+                verdict = 'improvement'
+            else:
+                verdict = 'same'
+
+        comparisons.append(Comparison(key[0], key[1], key[2], median(x), median(y), ratio, low, high, p_value, verdict))
+    return comparisons
+
+def print_report(comparisons, baseline, candidate, args):
+    print(f'Baseline: {baseline}, candidate: {candidate}, method: {args.method}, alpha: {args.alpha}, threshold: {args.threshold:.1%}')
+    print(f'{"Benchmark":<80} {"Backend":>7} {"Threads":>7} {"Baseline":>12} {"Candidate":>12} {"Change":>8} {"Confidence":>17} {"Verdict":>14}')
+    for c in comparisons:
+        if args.only_changes and c.verdict == 'same':
+            continue
+        if c.p_value is not None:
+            confidence = f'p={c.p_value:.4f}'
+        elif c.low is not None:
+            confidence = f'[{c.low - 1:+.1%}, {c.high - 1:+.1%}]'
+        else:
+            confidence = '-'
+        print(f'{c.name:<80} {c.backend:>7} {c.threads:>7} {c.baseline * 1e3:>10.4f}ms {c.candidate * 1e3:>10.4f}ms {c.ratio - 1:>+8.1%} {confidence:>17} {c.verdict:>14}')
+
+    verdicts = [c.verdict for c in comparisons]
+    print(f'{len(comparisons)} benchmarks compared: {verdicts.count("regression")} regressions, '
+          f'{verdicts.count("improvement")} improvements, {verdicts.count("too few trials")} with too few trials')
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('database',
+        help='The SQLite database the benchmarks stored their results in')
+    parser.add_argument('--baseline',
+        help='The revision to compare against, the one stored before the candidate by default')
+    parser.add_argument('--candidate',
+        help='The revision to compare, the last one stored by default')
+    parser.add_argument('--list', action='store_true',
+        help='List the revisions in the database and exit')
+    parser.add_argument('--method', choices=['mannwhitney', 'bootstrap'], default='mannwhitney',
+        help='The statistical test of the difference between the revisions')
+    parser.add_argument('--alpha', type=float, default=0.05,
+        help='The significance level of the test, or one minus the confidence of the interval')
+    parser.add_argument('--threshold', type=float, default=0.02,
+        help='The smallest relative change of the median time reported as a regression or an improvement')
+    parser.add_argument('--min_trials', type=int, default=5,
+        help='The smallest number of trials of each revision a benchmark is compared with')
+    parser.add_argument('--bootstrap_samples', type=int, default=10000,
+        help='The number of resamples of the bootstrap')
+    parser.add_argument('--seed', type=int, default=0,
+        help='The seed of the bootstrap resampling')
+    parser.add_argument('--filter', default='',
+        help='Regular expression that selects the benchmarks to compare by name')
+    parser.add_argument('--backend',
+        help='Only compare the results of this backend (HIP, CPP, OMP or TBB)')
+    parser.add_argument('--threads', type=int,
+        help='Only compare the results with this number of host threads')
+    parser.add_argument('--only_changes', action='store_true',
+        help='Only print the benchmarks that regressed or improved')
+
+    args = parser.parse_args()
+
+    connection = sqlite3.connect(args.database)
+    revisions = latest_revisions(connection)
+    if args.list:
+        print('\n'.join(revisions))
+        return True
+
+    candidate = args.candidate or (revisions[-1] if revisions else None)
+    baseline = args.baseline
+    if not baseline and candidate in revisions and revisions.index(candidate) > 0:
+        baseline = revisions[revisions.index(candidate) - 1]
+    if not baseline or not candidate:
+        print('The database needs the results of two revisions to compare', file=sys.stderr)
+        return False
+
+    comparisons = compare(load_trials(connection, baseline, args), load_trials(connection, candidate, args), args)
+    if not comparisons:
+        print(f'No benchmark has results for both {baseline} and {candidate}', file=sys.stderr)
+        return False
+
+    print_report(comparisons, baseline, candidate, args)
+    return not any(c.verdict == 'regression' for c in comparisons)
+
+
+if __name__ == '__main__':
+    success = main()
+    if success:
+        exit(0)
+    else:
+        exit(1)
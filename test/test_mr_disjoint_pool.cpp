@@ -2,6 +2,8 @@
 #include <thrust/mr/disjoint_sync_pool.h>
 #include <thrust/mr/new.h>
 
+#include <vector>
+
 #include "test_header.hpp"
 
 
@@ -265,6 +267,211 @@ TEST(MrDisjointPoolTests, TestDisjointSynchronizedPoolCachingOversized)
     TestDisjointPoolCachingOversized<thrust::mr::disjoint_synchronized_pool_resource>();
 }
 
+template<template<typename, typename> class PoolTemplate>
+void TestDisjointPoolManyOversized()
+{
+    dummy_resource upstream;
+    thrust::mr::new_delete_resource bookkeeper;
+
+    typedef PoolTemplate<
+        dummy_resource,
+        thrust::mr::new_delete_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.cache_oversized = false;
+    opts.largest_block_size = 1024;
+
+    const std::size_t count = 1000;
+
+    {
+        Pool pool(&upstream, &bookkeeper, opts);
+
+        std::vector<alloc_id> blocks;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            upstream.id_to_allocate = i + 1;
+            blocks.push_back(pool.do_allocate(2048 + 64 * i, 32));
+            ASSERT_EQ(blocks[i].id, i + 1);
+        }
+
+        // every block goes back to upstream, in an order unrelated to allocation
+        for (std::size_t j = 0; j < count; ++j)
+        {
+            std::size_t i = j * 7 % count;
+            upstream.id_to_deallocate = i + 1;
+            pool.do_deallocate(blocks[i], 2048 + 64 * i, 32);
+            ASSERT_EQ(upstream.id_to_deallocate, 0u);
+        }
+    }
+
+    opts.cache_oversized = true;
+
+    {
+        Pool pool(&upstream, &bookkeeper, opts);
+
+        std::vector<alloc_id> blocks;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            upstream.id_to_allocate = i + 1;
+            blocks.push_back(pool.do_allocate(2048 + 64 * i, 32));
+        }
+
+        for (std::size_t j = 0; j < count; ++j)
+        {
+            std::size_t i = j * 7 % count;
+            pool.do_deallocate(blocks[i], 2048 + 64 * i, 32);
+        }
+
+        // every request is now served from the cache; from the largest one down, the
+        // best fit for each is the block of exactly the same size
+        for (std::size_t i = count; i-- > 0;)
+        {
+            alloc_id a = pool.do_allocate(2048 + 64 * i, 32);
+            ASSERT_EQ(a.id, i + 1);
+        }
+    }
+}
+
+TEST(MrDisjointPoolTests, TestDisjointUnsynchronizedPoolManyOversized)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestDisjointPoolManyOversized<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+
+TEST(MrDisjointPoolTests, TestDisjointSynchronizedPoolManyOversized)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestDisjointPoolManyOversized<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+
+template<template<typename, typename> class PoolTemplate>
+void TestDisjointPoolStats()
+{
+    thrust::mr::new_delete_resource upstream;
+    thrust::mr::new_delete_resource bookkeeper;
+
+    typedef PoolTemplate<
+        thrust::mr::new_delete_resource,
+        thrust::mr::new_delete_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.collect_stats = true;
+
+    Pool pool(&upstream, &bookkeeper, opts);
+
+    void * a1 = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    void * a2 = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    pool.do_deallocate(a2, 16, THRUST_MR_DEFAULT_ALIGNMENT);
+
+    // the overaligned block is cached when deallocated, and reused by the next allocation
+    void * o1 = pool.do_allocate(1000, 32);
+    pool.do_deallocate(o1, 1000, 32);
+    void * o2 = pool.do_allocate(1000, 32);
+
+    thrust::mr::pool_stats stats = pool.stats();
+    ASSERT_EQ(stats.allocations, 4u);
+    ASSERT_EQ(stats.deallocations, 2u);
+    ASSERT_EQ(stats.cache_hits, 2u);
+    ASSERT_EQ(stats.upstream_allocations, 2u);
+    ASSERT_EQ(stats.bytes_in_use, 1016u);
+    ASSERT_EQ(stats.bytes_in_use_high_water, 1016u);
+    ASSERT_EQ(stats.oversized_blocks, 1u);
+    ASSERT_EQ(stats.oversized_blocks_cached, 0u);
+    ASSERT_EQ(stats.buckets[0].blocks_in_use, 1u);
+
+    pool.do_deallocate(o2, 1000, 32);
+    pool.release();
+
+    stats = pool.stats();
+    ASSERT_EQ(stats.upstream_deallocations, 2u);
+    ASSERT_EQ(stats.bytes_upstream, 0u);
+    ASSERT_EQ(stats.bytes_cached, 0u);
+
+    (void)a1;
+}
+
+TEST(MrDisjointPoolTests, TestDisjointUnsynchronizedPoolStats)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestDisjointPoolStats<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+
+TEST(MrDisjointPoolTests, TestDisjointSynchronizedPoolStats)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestDisjointPoolStats<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+
+template<template<typename, typename> class PoolTemplate>
+void TestDisjointPoolTrim()
+{
+    thrust::mr::new_delete_resource upstream;
+    thrust::mr::new_delete_resource bookkeeper;
+
+    typedef PoolTemplate<
+        thrust::mr::new_delete_resource,
+        thrust::mr::new_delete_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.collect_stats = true;
+
+    Pool pool(&upstream, &bookkeeper, opts);
+
+    std::vector<void *> small, large;
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        small.push_back(pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT));
+        large.push_back(pool.do_allocate(256, THRUST_MR_DEFAULT_ALIGNMENT));
+    }
+
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        pool.do_deallocate(small[i], 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+
+    void * o = pool.do_allocate(1000, 32);
+    pool.do_deallocate(o, 1000, 32);
+
+    // the cached overaligned block and the chunks of the small blocks are returned to upstream,
+    // and the blocks in use are all that is left
+    std::size_t held = pool.stats().bytes_upstream;
+    std::size_t released = pool.trim();
+    ASSERT_EQ(released > 1000, true);
+    ASSERT_EQ(pool.stats().bytes_upstream, held - released);
+    ASSERT_EQ(pool.stats().oversized_blocks, 0u);
+    ASSERT_EQ(pool.stats().buckets[0].blocks, 0u);
+    ASSERT_EQ(pool.trim(), 0u);
+
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        pool.do_deallocate(large[i], 256, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+
+    pool.trim();
+    ASSERT_EQ(pool.stats().bytes_upstream, 0u);
+}
+
+TEST(MrDisjointPoolTests, TestDisjointUnsynchronizedPoolTrim)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestDisjointPoolTrim<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+
+TEST(MrDisjointPoolTests, TestDisjointSynchronizedPoolTrim)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestDisjointPoolTrim<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+
 template<template<typename, typename> class PoolTemplate>
 void TestDisjointGlobalPool()
 {
@@ -736,6 +736,395 @@ TEST(RandomTests, TestRanlux48Unequal)
     TestEngineUnequal<Engine>();
 }
 
+TEST(RandomTests, TestPhilox4x32Validation)
+{
+    typedef thrust::random::philox4x32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineValidation<Engine, 1955073260u>();
+}
+
+TEST(RandomTests, TestPhilox4x32Min)
+{
+    typedef thrust::random::philox4x32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineMin<Engine>();
+}
+
+TEST(RandomTests, TestPhilox4x32Max)
+{
+    typedef thrust::random::philox4x32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineMax<Engine>();
+}
+
+TEST(RandomTests, TestPhilox4x32SaveRestore)
+{
+    typedef thrust::random::philox4x32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineSaveRestore<Engine>();
+}
+
+TEST(RandomTests, TestPhilox4x32Equal)
+{
+    typedef thrust::random::philox4x32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineEqual<Engine>();
+}
+
+TEST(RandomTests, TestPhilox4x32Unequal)
+{
+    typedef thrust::random::philox4x32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineUnequal<Engine>();
+}
+
+TEST(RandomTests, TestPhilox4x64Validation)
+{
+    typedef thrust::random::philox4x64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineValidation<Engine, 3409172418970261260ull>();
+}
+
+TEST(RandomTests, TestPhilox4x64Min)
+{
+    typedef thrust::random::philox4x64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineMin<Engine>();
+}
+
+TEST(RandomTests, TestPhilox4x64Max)
+{
+    typedef thrust::random::philox4x64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineMax<Engine>();
+}
+
+TEST(RandomTests, TestPhilox4x64SaveRestore)
+{
+    typedef thrust::random::philox4x64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineSaveRestore<Engine>();
+}
+
+TEST(RandomTests, TestPhilox4x64Equal)
+{
+    typedef thrust::random::philox4x64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineEqual<Engine>();
+}
+
+TEST(RandomTests, TestPhilox4x64Unequal)
+{
+    typedef thrust::random::philox4x64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineUnequal<Engine>();
+}
+
+TEST(RandomTests, TestThreefry4x32Validation)
+{
+    typedef thrust::random::threefry4x32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineValidation<Engine, 112810865u>();
+}
+
+TEST(RandomTests, TestThreefry4x32Min)
+{
+    typedef thrust::random::threefry4x32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineMin<Engine>();
+}
+
+TEST(RandomTests, TestThreefry4x32Max)
+{
+    typedef thrust::random::threefry4x32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineMax<Engine>();
+}
+
+TEST(RandomTests, TestThreefry4x32SaveRestore)
+{
+    typedef thrust::random::threefry4x32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineSaveRestore<Engine>();
+}
+
+TEST(RandomTests, TestThreefry4x32Equal)
+{
+    typedef thrust::random::threefry4x32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineEqual<Engine>();
+}
+
+TEST(RandomTests, TestThreefry4x32Unequal)
+{
+    typedef thrust::random::threefry4x32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineUnequal<Engine>();
+}
+
+TEST(RandomTests, TestThreefry4x64Validation)
+{
+    typedef thrust::random::threefry4x64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineValidation<Engine, 9253438642465275567ull>();
+}
+
+TEST(RandomTests, TestThreefry4x64Min)
+{
+    typedef thrust::random::threefry4x64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineMin<Engine>();
+}
+
+TEST(RandomTests, TestThreefry4x64Max)
+{
+    typedef thrust::random::threefry4x64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineMax<Engine>();
+}
+
+TEST(RandomTests, TestThreefry4x64SaveRestore)
+{
+    typedef thrust::random::threefry4x64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineSaveRestore<Engine>();
+}
+
+TEST(RandomTests, TestThreefry4x64Equal)
+{
+    typedef thrust::random::threefry4x64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineEqual<Engine>();
+}
+
+TEST(RandomTests, TestThreefry4x64Unequal)
+{
+    typedef thrust::random::threefry4x64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineUnequal<Engine>();
+}
+
+TEST(RandomTests, TestSquares32Validation)
+{
+    typedef thrust::random::squares32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineValidation<Engine, 941856950u>();
+}
+
+TEST(RandomTests, TestSquares32Min)
+{
+    typedef thrust::random::squares32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineMin<Engine>();
+}
+
+TEST(RandomTests, TestSquares32Max)
+{
+    typedef thrust::random::squares32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineMax<Engine>();
+}
+
+TEST(RandomTests, TestSquares32SaveRestore)
+{
+    typedef thrust::random::squares32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineSaveRestore<Engine>();
+}
+
+TEST(RandomTests, TestSquares32Equal)
+{
+    typedef thrust::random::squares32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineEqual<Engine>();
+}
+
+TEST(RandomTests, TestSquares32Unequal)
+{
+    typedef thrust::random::squares32 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineUnequal<Engine>();
+}
+
+TEST(RandomTests, TestSquares64Validation)
+{
+    typedef thrust::random::squares64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineValidation<Engine, 4045244800961042677ull>();
+}
+
+TEST(RandomTests, TestSquares64Min)
+{
+    typedef thrust::random::squares64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineMin<Engine>();
+}
+
+TEST(RandomTests, TestSquares64Max)
+{
+    typedef thrust::random::squares64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineMax<Engine>();
+}
+
+TEST(RandomTests, TestSquares64SaveRestore)
+{
+    typedef thrust::random::squares64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineSaveRestore<Engine>();
+}
+
+TEST(RandomTests, TestSquares64Equal)
+{
+    typedef thrust::random::squares64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineEqual<Engine>();
+}
+
+TEST(RandomTests, TestSquares64Unequal)
+{
+    typedef thrust::random::squares64 Engine;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestEngineUnequal<Engine>();
+}
+
+template <typename Engine, size_t lanes>
+struct ValidateSimdEngine
+{
+    __host__ __device__ bool operator()(void) const
+    {
+        const unsigned long long stride = 100000;
+
+        // lane j produces the values of a scalar engine advanced by j * stride
+        thrust::random::simd_engine<Engine, lanes> e(Engine(13), stride);
+
+        Engine scalar[lanes];
+        for(size_t j = 0; j < lanes; ++j)
+        {
+            scalar[j] = Engine(13);
+            scalar[j].discard(j * stride);
+        }
+
+        bool result = true;
+
+        typename Engine::result_type values[lanes];
+        for(int i = 0; i < 1000; ++i)
+        {
+            e(values);
+            for(size_t j = 0; j < lanes; ++j)
+            {
+                result &= (values[j] == scalar[j]());
+            }
+        }
+
+        return result;
+    }
+}; // end ValidateSimdEngine
+
+template <typename Engine, size_t lanes>
+void TestSimdEngine(void)
+{
+    // test host
+    thrust::host_vector<bool> h(1);
+    thrust::generate(h.begin(), h.end(), ValidateSimdEngine<Engine, lanes>());
+
+    ASSERT_EQ(true, h[0]);
+
+    // test device
+    thrust::device_vector<bool> d(1);
+    thrust::generate(d.begin(), d.end(), ValidateSimdEngine<Engine, lanes>());
+
+    ASSERT_EQ(true, d[0]);
+}
+
+TEST(RandomTests, TestSimdEngineMinstdRand)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestSimdEngine<thrust::random::minstd_rand, 8>();
+    TestSimdEngine<thrust::random::minstd_rand, 16>();
+}
+
+TEST(RandomTests, TestSimdEngineTaus88)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestSimdEngine<thrust::random::taus88, 8>();
+    TestSimdEngine<thrust::random::taus88, 16>();
+}
+
 template <typename Distribution, typename Validator>
 void ValidateDistributionCharacteristic(void)
 {
@@ -0,0 +1,111 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/random.h>
+#include <thrust/random/generate.h>
+
+#include <cmath>
+
+#include "test_header.hpp"
+
+template <typename Engine, typename T, typename Distribution>
+void TestRandomGenerateSequential(size_t n, Distribution dist)
+{
+    // uniform distributions produce the sequential results
+    thrust::device_vector<T> d(n);
+    Engine                   e0(13);
+    thrust::random::generate(thrust::device, d.begin(), d.end(), e0, dist);
+
+    thrust::host_vector<T> h(n);
+    Engine                 e1(13);
+    thrust::random::generate(thrust::host, h.begin(), h.end(), e1, dist);
+
+    thrust::host_vector<T> reference(n);
+    Engine                 e2(13);
+    for(size_t i = 0; i < n; ++i)
+    {
+        reference[i] = dist(e2);
+    }
+
+    // device arithmetic may contract the scaling of the engine values
+    thrust::host_vector<T> d_h(d);
+    for(size_t i = 0; i < n; ++i)
+    {
+        ASSERT_NEAR(d_h[i], reference[i], std::abs(reference[i]) * 1e-5 + 1e-6);
+    }
+    ASSERT_EQ(h, reference);
+
+    // and leave the engine where the sequential loop does
+    ASSERT_TRUE(e0 == e2);
+    ASSERT_TRUE(e1 == e2);
+}
+
+TEST(RandomGenerateTests, TestRandomGenerateUniformReal)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        TestRandomGenerateSequential<thrust::minstd_rand, float>(
+            size, thrust::random::uniform_real_distribution<float>(-1, 2));
+        TestRandomGenerateSequential<thrust::philox4x32, double>(
+            size, thrust::random::uniform_real_distribution<double>(-1, 2));
+    }
+}
+
+TEST(RandomGenerateTests, TestRandomGenerateUniformInt)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        TestRandomGenerateSequential<thrust::squares32, int>(
+            size, thrust::random::uniform_int_distribution<int>(-5, 100));
+    }
+}
+
+TEST(RandomGenerateTests, TestRandomGenerateNormal)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const size_t                                n = 1 << 20;
+    thrust::random::normal_distribution<double> dist(2, 3);
+
+    thrust::device_vector<double> d(n);
+    thrust::philox4x64            e(7);
+    thrust::random::generate(thrust::device, d.begin(), d.end(), e, dist);
+
+    thrust::host_vector<double> h(d);
+
+    double sum = 0, sum_of_squares = 0;
+    for(size_t i = 0; i < n; ++i)
+    {
+        sum += h[i];
+        sum_of_squares += h[i] * h[i];
+    }
+
+    const double mean   = sum / n;
+    const double stddev = std::sqrt(sum_of_squares / n - mean * mean);
+
+    ASSERT_NEAR(mean, 2.0, 0.02);
+    ASSERT_NEAR(stddev, 3.0, 0.02);
+}
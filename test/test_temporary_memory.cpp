@@ -0,0 +1,90 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system_error.h>
+#include <thrust/temporary_memory.h>
+
+#include <string>
+
+#include "test_header.hpp"
+
+TEST(TemporaryMemoryTests, TestTemporaryMemoryStatsReduceByKey)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        thrust::device_vector<int> keys(size);
+        thrust::device_vector<int> values(size, 1);
+        thrust::device_vector<int> keys_out(size);
+        thrust::device_vector<int> values_out(size);
+        thrust::sequence(keys.begin(), keys.end());
+
+        thrust::reset_temporary_memory_stats();
+        thrust::reduce_by_key(
+            keys.begin(), keys.end(), values.begin(), keys_out.begin(), values_out.begin());
+
+        // the temporary storage has been returned, and was never above the total allocated
+        thrust::temporary_memory_stats stats = thrust::get_temporary_memory_stats();
+        ASSERT_EQ(stats.current_bytes, 0u);
+        ASSERT_LE(stats.peak_bytes, stats.cumulative_bytes);
+        if(size > 0)
+        {
+            ASSERT_GT(stats.peak_bytes, 0u);
+            ASSERT_GT(stats.allocations, 0u);
+        }
+    }
+}
+
+TEST(TemporaryMemoryTests, TestTemporaryMemoryLimit)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const size_t               size = 1 << 16;
+    thrust::device_vector<int> d(size);
+    thrust::sequence(d.rbegin(), d.rend());
+
+    thrust::reset_temporary_memory_stats();
+    thrust::sort(thrust::device, d.begin(), d.end());
+    const size_t needed = thrust::get_temporary_memory_stats().peak_bytes;
+    ASSERT_GT(needed, 0u);
+
+    // the sort runs with exactly the storage it needs
+    thrust::sequence(d.rbegin(), d.rend());
+    thrust::sort(thrust::device(thrust::temporary_memory_limit(needed)), d.begin(), d.end());
+    ASSERT_TRUE(thrust::is_sorted(d.begin(), d.end()));
+
+    // and fails with less
+    thrust::sequence(d.rbegin(), d.rend());
+    try
+    {
+        thrust::sort(thrust::device(thrust::temporary_memory_limit(needed - 1)), d.begin(), d.end());
+        FAIL() << "the temporary memory limit was not enforced";
+    }
+    catch(thrust::system_error& e)
+    {
+        ASSERT_EQ(e.code().value(), int(thrust::system::errc::not_enough_memory));
+        ASSERT_NE(std::string(e.what()).find("temporary memory limit"), std::string::npos);
+    }
+    ASSERT_EQ(thrust::get_temporary_memory_stats().current_bytes, 0u);
+}
@@ -0,0 +1,225 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#define THRUST_ENABLE_TRACING
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/trace.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "test_header.hpp"
+
+namespace
+{
+
+struct trace_recorder
+{
+    std::vector<thrust::trace::event> events;
+
+    static void record(const thrust::trace::event& e, void* user_data)
+    {
+        static_cast<trace_recorder*>(user_data)->events.push_back(e);
+    }
+
+    // the index of the begin event of the first call of algorithm, or events.size()
+    size_t find(const char* algorithm) const
+    {
+        for(size_t i = 0; i < events.size(); ++i)
+        {
+            if(events[i].phase == thrust::trace::phase::begin
+               && std::strcmp(events[i].algorithm, algorithm) == 0)
+            {
+                return i;
+            }
+        }
+        return events.size();
+    }
+
+    // the index of the end event matching the begin event at i, or events.size()
+    size_t matching_end(size_t i) const
+    {
+        int depth = 0;
+        for(; i < events.size(); ++i)
+        {
+            depth += events[i].phase == thrust::trace::phase::begin ? 1 : -1;
+            if(depth == 0)
+            {
+                return i;
+            }
+        }
+        return events.size();
+    }
+};
+
+} // namespace
+
+TEST(TraceTests, TestTraceDeviceReduceByKey)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const size_t n = 1 << 16;
+    thrust::device_vector<int> keys(n);
+    thrust::device_vector<int> values(n, 1);
+    thrust::device_vector<int> keys_out(n);
+    thrust::device_vector<int> values_out(n);
+    thrust::sequence(keys.begin(), keys.end());
+
+    trace_recorder recorder;
+    thrust::trace::set_callback(&trace_recorder::record, &recorder);
+
+    thrust::reduce_by_key(keys.begin(), keys.end(), values.begin(), keys_out.begin(), values_out.begin());
+
+    thrust::trace::set_callback(NULL);
+
+    const size_t begin = recorder.find("reduce_by_key");
+    ASSERT_LT(begin, recorder.events.size());
+    ASSERT_EQ(recorder.events[begin].count, n);
+    ASSERT_EQ(recorder.events[begin].value_size, sizeof(int));
+    ASSERT_STREQ(recorder.events[begin].backend, "hip");
+
+    // the device reduce_by_key runs in temporary storage
+    const size_t end = recorder.matching_end(begin);
+    ASSERT_LT(end, recorder.events.size());
+    ASSERT_STREQ(recorder.events[end].algorithm, "reduce_by_key");
+    ASSERT_GT(recorder.events[end].temporary_bytes, 0u);
+    ASSERT_GT(recorder.events[end].peak_temporary_bytes, 0u);
+    ASSERT_LE(recorder.events[end].peak_temporary_bytes, recorder.events[end].temporary_bytes);
+    ASSERT_GE(recorder.events[end].timestamp, recorder.events[begin].timestamp);
+}
+
+TEST(TraceTests, TestTraceHostBackends)
+{
+    thrust::host_vector<int> v(1000, 1);
+
+    trace_recorder recorder;
+    thrust::trace::set_callback(&trace_recorder::record, &recorder);
+
+    thrust::reduce(thrust::seq, v.begin(), v.end());
+    thrust::reduce(thrust::host, v.begin(), v.end());
+
+    thrust::trace::set_callback(NULL);
+
+    ASSERT_GE(recorder.events.size(), 4u);
+    ASSERT_STREQ(recorder.events.front().backend, "seq");
+    ASSERT_STREQ(recorder.events.back().backend, "cpp");
+
+    // nothing is recorded once the callback is unset
+    const size_t recorded = recorder.events.size();
+    thrust::reduce(thrust::host, v.begin(), v.end());
+    ASSERT_EQ(recorder.events.size(), recorded);
+}
+
+TEST(TraceTests, TestTraceChromeWriter)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const char* path = "rocthrust_test_trace.json";
+    {
+        thrust::trace::chrome_trace_writer writer(path);
+        ASSERT_TRUE(writer.is_open());
+        writer.install();
+
+        thrust::device_vector<int> v(1000, 1);
+        thrust::sort(v.begin(), v.end());
+    }
+    ASSERT_TRUE(thrust::trace::get_callback() == NULL);
+
+    std::ifstream file(path);
+    std::string   contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(path);
+
+    ASSERT_EQ(contents.compare(0, 16, "{\"traceEvents\":["), 0);
+    ASSERT_NE(contents.find("\"name\":\"sort\",\"cat\":\"hip\",\"ph\":\"B\""), std::string::npos);
+    ASSERT_NE(contents.find("\"ph\":\"E\""), std::string::npos);
+    ASSERT_NE(contents.find("\"count\":1000"), std::string::npos);
+}
+
+struct close_writer_functor
+{
+    thrust::trace::chrome_trace_writer* writer;
+
+    void operator()(int) const
+    {
+        writer->close();
+    }
+};
+
+size_t count_occurrences(const std::string& s, const std::string& pattern)
+{
+    size_t count = 0;
+    for(size_t i = s.find(pattern); i != std::string::npos; i = s.find(pattern, i + 1))
+    {
+        ++count;
+    }
+    return count;
+}
+
+std::string read_and_remove(const char* path)
+{
+    std::ifstream file(path);
+    std::string   contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(path);
+    return contents;
+}
+
+TEST(TraceTests, TestTraceChromeWriterClosedDuringAlgorithm)
+{
+    const char* path = "rocthrust_test_trace_closed.json";
+
+    thrust::host_vector<int> v(10, 1);
+    {
+        thrust::trace::chrome_trace_writer writer(path);
+        writer.install();
+
+        // the writer is closed while for_each runs, and ends its slice
+        close_writer_functor f = {&writer};
+        thrust::for_each(thrust::host, v.begin(), v.end(), f);
+
+        ASSERT_FALSE(writer.is_open());
+    }
+    ASSERT_TRUE(thrust::trace::get_callback() == NULL);
+
+    std::string contents = read_and_remove(path);
+    ASSERT_NE(contents.find("\"name\":\"for_each\",\"cat\":\"cpp\",\"ph\":\"B\""), std::string::npos);
+    ASSERT_NE(contents.find("\"name\":\"for_each\",\"cat\":\"cpp\",\"ph\":\"E\""), std::string::npos);
+    ASSERT_EQ(count_occurrences(contents, "\"ph\":\"B\""), count_occurrences(contents, "\"ph\":\"E\""));
+
+    // an end event whose begin event the writer did not see is dropped
+    {
+        thrust::trace::chrome_trace_writer writer(path);
+
+        thrust::trace::event e = {};
+        e.phase     = thrust::trace::phase::end;
+        e.algorithm = "reduce";
+        e.backend   = "cpp";
+        e.thread    = 1;
+        writer.write(e);
+    }
+
+    contents = read_and_remove(path);
+    ASSERT_EQ(count_occurrences(contents, "\"ph\":\"E\""), 0u);
+}
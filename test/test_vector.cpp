@@ -18,7 +18,9 @@
 #include <thrust/device_malloc_allocator.h>
 #include <thrust/device_vector.h>
 #include <thrust/memory.h>
+#include <thrust/fill.h>
 #include <thrust/sequence.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
 
 #include "test_header.hpp"
 
@@ -774,6 +776,114 @@ TYPED_TEST(VectorTests, TestVectorResizing)
     ASSERT_EQ(v.size(), 0);
 }
 
+TYPED_TEST(VectorTests, TestVectorNoInit)
+{
+    using Vector = typename TestFixture::input_type;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector v(3, thrust::no_init);
+
+    ASSERT_EQ(v.size(), 3);
+
+    thrust::sequence(v.begin(), v.end());
+
+    // the old elements are kept, in place or after a reallocation
+    v.resize(4, thrust::no_init);
+    v.resize(100, thrust::no_init);
+
+    ASSERT_EQ(v.size(), 100);
+    ASSERT_EQ(v[0], T(0));
+    ASSERT_EQ(v[1], T(1));
+    ASSERT_EQ(v[2], T(2));
+
+    thrust::fill(v.begin() + 3, v.end(), T(7));
+    ASSERT_EQ(v[99], T(7));
+
+    v.resize(2, thrust::no_init);
+
+    ASSERT_EQ(v.size(), 2);
+    ASSERT_EQ(v[1], T(1));
+
+    Vector w(0, thrust::no_init, typename Vector::allocator_type());
+    ASSERT_EQ(w.size(), 0);
+}
+
+struct default_forty_two
+{
+    int value;
+
+    default_forty_two() : value(42) {}
+};
+
+TEST(VectorTests, TestVectorNoInitConstructsNonTrivialTypes)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // elements with a default constructor that does something are still constructed
+    thrust::host_vector<default_forty_two> v(3, thrust::no_init);
+    ASSERT_EQ(v[2].value, 42);
+
+    v.resize(10, thrust::no_init);
+    ASSERT_EQ(v[9].value, 42);
+}
+
+// counts its copies; proclaimed trivially relocatable below, so vectors move it bitwise
+struct counted_copies
+{
+    int value;
+
+    counted_copies(int v = 0) : value(v) {}
+    counted_copies(const counted_copies &other) : value(other.value) { ++copies; }
+    counted_copies &operator=(const counted_copies &other) = default;
+
+    static int copies;
+};
+int counted_copies::copies = 0;
+
+THRUST_PROCLAIM_TRIVIALLY_RELOCATABLE(counted_copies)
+
+TEST(VectorTests, TestVectorGrowthRelocatesElements)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::host_vector<counted_copies> v;
+    for(int i = 0; i < 100; ++i)
+    {
+        v.push_back(counted_copies(i));
+    }
+
+    // the elements are moved bitwise to the new storage, without copy constructors
+    counted_copies::copies = 0;
+    v.reserve(1000);
+    ASSERT_EQ(counted_copies::copies, 0);
+    ASSERT_EQ(v[99].value, 99);
+
+    v.resize(v.capacity());
+    ASSERT_EQ(v[99].value, 99);
+
+    // only the inserted elements are copied when an insertion needs new storage
+    counted_copies::copies = 0;
+    v.insert(v.begin() + 50, 10, counted_copies(-1));
+    ASSERT_LT(counted_copies::copies, 100);
+    ASSERT_EQ(v[49].value, 49);
+    ASSERT_EQ(v[50].value, -1);
+    ASSERT_EQ(v[59].value, -1);
+    ASSERT_EQ(v[60].value, 50);
+    ASSERT_EQ(v[109].value, 99);
+
+    const int old_size = static_cast<int>(v.size());
+    thrust::host_vector<counted_copies> w(v.capacity(), counted_copies(-2));
+
+    counted_copies::copies = 0;
+    v.insert(v.begin(), w.begin(), w.end());
+    ASSERT_LT(counted_copies::copies, static_cast<int>(w.size()) + old_size);
+    ASSERT_EQ(v[0].value, -2);
+    ASSERT_EQ(v[w.size()].value, 0);
+    ASSERT_EQ(v[w.size() + 109].value, 99);
+}
+
 TYPED_TEST(VectorTests, TestVectorReserving)
 {
     using Vector = typename TestFixture::input_type;
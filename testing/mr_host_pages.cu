@@ -0,0 +1,158 @@
+#include <unittest/unittest.h>
+
+#include <thrust/detail/config.h>
+#include <thrust/mr/huge_page.h>
+#include <thrust/mr/numa.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/host_vector.h>
+#include <thrust/reduce.h>
+#include <thrust/system/cpp/memory.h>
+#include <thrust/system/cpp/vector.h>
+
+#include <cstring>
+
+template<typename Resource>
+void check_large_allocation(Resource & resource, std::size_t bytes, std::size_t alignment)
+{
+    char * p = static_cast<char *>(resource.do_allocate(bytes, THRUST_MR_DEFAULT_ALIGNMENT));
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(p) % alignment, 0u);
+
+    // freshly mapped pages are zero-initialized
+    ASSERT_EQUAL(p[0], 0);
+    ASSERT_EQUAL(p[bytes - 1], 0);
+
+    std::memset(p, 1, bytes);
+    ASSERT_EQUAL(p[bytes / 2], 1);
+
+    resource.do_deallocate(p, bytes, THRUST_MR_DEFAULT_ALIGNMENT);
+}
+
+template<typename Resource>
+void check_small_allocation(Resource & resource)
+{
+    char * p = static_cast<char *>(resource.do_allocate(100, 64));
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(p) % 64, 0u);
+    std::memset(p, 1, 100);
+    resource.do_deallocate(p, 100, 64);
+}
+
+void TestHugePageResource()
+{
+    std::size_t huge_page_size = thrust::detail::host_pages::available
+        ? thrust::detail::host_pages::huge_page_size()
+        : THRUST_MR_DEFAULT_ALIGNMENT;
+
+    thrust::mr::huge_page_resource transparent;
+    check_large_allocation(transparent, (5 << 20) + 3, huge_page_size);
+    check_small_allocation(transparent);
+
+    // without reserved huge pages, this falls back to transparent huge pages
+    thrust::mr::huge_page_resource explicit_pages(thrust::mr::explicit_huge_pages);
+    ASSERT_EQUAL(explicit_pages.mode(), thrust::mr::explicit_huge_pages);
+    check_large_allocation(explicit_pages, 4 << 20, huge_page_size);
+    check_small_allocation(explicit_pages);
+}
+DECLARE_UNITTEST(TestHugePageResource);
+
+void TestNumaResource()
+{
+    std::size_t page_size = thrust::detail::host_pages::available
+        ? thrust::detail::host_pages::page_size()
+        : THRUST_MR_DEFAULT_ALIGNMENT;
+
+    thrust::mr::numa_resource interleaved;
+    ASSERT_EQUAL(interleaved.placement(), thrust::mr::numa_interleave);
+    check_large_allocation(interleaved, (3 << 20) + 5, page_size);
+    check_small_allocation(interleaved);
+
+    thrust::mr::numa_resource first_touch(thrust::mr::numa_first_touch, true);
+    check_large_allocation(first_touch, 3 << 20, page_size);
+    check_small_allocation(first_touch);
+
+    // a large alignment is honored
+    thrust::mr::numa_resource small(thrust::mr::numa_first_touch, false, 0);
+    void * p = small.do_allocate(100, 1 << 16);
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(p) % (1 << 16), 0u);
+    small.do_deallocate(p, 100, 1 << 16);
+}
+DECLARE_UNITTEST(TestNumaResource);
+
+void TestHostPagesReallocate()
+{
+    thrust::mr::huge_page_resource resource;
+    const std::size_t old_bytes = 4 << 20;
+    const std::size_t new_bytes = 64 << 20;
+
+    char * p = static_cast<char *>(resource.do_allocate(old_bytes, THRUST_MR_DEFAULT_ALIGNMENT));
+    std::memset(p, 3, old_bytes);
+
+    char * q = static_cast<char *>(resource.do_reallocate(p, old_bytes, new_bytes, THRUST_MR_DEFAULT_ALIGNMENT));
+    if(!thrust::detail::host_pages::available)
+    {
+        // the memory is not mapped directly, so it can't be remapped either
+        ASSERT_EQUAL(q == nullptr, true);
+        resource.do_deallocate(p, old_bytes, THRUST_MR_DEFAULT_ALIGNMENT);
+        return;
+    }
+
+    // the contents are kept, and the rest is zero-initialized
+    ASSERT_EQUAL(q != nullptr, true);
+    ASSERT_EQUAL(q[0], 3);
+    ASSERT_EQUAL(q[old_bytes - 1], 3);
+    ASSERT_EQUAL(q[old_bytes], 0);
+    ASSERT_EQUAL(q[new_bytes - 1], 0);
+
+    // small allocations are never resized in place
+    void * small = resource.do_allocate(100, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(resource.do_reallocate(small, 100, new_bytes, THRUST_MR_DEFAULT_ALIGNMENT) == nullptr, true);
+    resource.do_deallocate(small, 100, THRUST_MR_DEFAULT_ALIGNMENT);
+
+    resource.do_deallocate(q, new_bytes, THRUST_MR_DEFAULT_ALIGNMENT);
+}
+DECLARE_UNITTEST(TestHostPagesReallocate);
+
+void TestNumaNodeList()
+{
+    thrust::detail::host_pages::node_mask mask = thrust::detail::host_pages::parse_node_list("0-3,8,10-11\n");
+    ASSERT_EQUAL(mask.count, 7u);
+    ASSERT_EQUAL(mask.max_node, 11u);
+    ASSERT_EQUAL(mask.bits[0], 0xd0ful);
+
+    mask = thrust::detail::host_pages::parse_node_list("");
+    ASSERT_EQUAL(mask.count, 0u);
+}
+DECLARE_UNITTEST(TestNumaNodeList);
+
+void TestHostPagesVectors()
+{
+    const int n = 1 << 20;
+
+    thrust::host_vector<int, thrust::mr::stateless_resource_allocator<int, thrust::mr::huge_page_resource> > h(n, 1);
+    ASSERT_EQUAL(thrust::reduce(h.begin(), h.end()), n);
+
+    thrust::cpp::vector<int, thrust::cpp::huge_page_allocator<int> > c(n, 2);
+    ASSERT_EQUAL(thrust::reduce(c.begin(), c.end()), 2 * n);
+
+    thrust::cpp::vector<int, thrust::cpp::numa_allocator<int> > numa(h.begin(), h.end());
+    ASSERT_EQUAL(thrust::reduce(numa.begin(), numa.end()), n);
+}
+DECLARE_UNITTEST(TestHostPagesVectors);
+
+void TestHostPagesVectorGrowth()
+{
+    const int n = 1 << 20;
+
+    // growing vectors remap their pages instead of copying the elements
+    thrust::cpp::vector<int, thrust::cpp::huge_page_allocator<int> > h(n, 1);
+    h.resize(8 * n);
+    ASSERT_EQUAL(h[n - 1], 1);
+    ASSERT_EQUAL(h[n], 0);
+    ASSERT_EQUAL(thrust::reduce(h.begin(), h.end()), n);
+
+    thrust::cpp::vector<int, thrust::cpp::numa_allocator<int> > numa(n, 1);
+    numa.reserve(4 * n);
+    numa.push_back(3);
+    ASSERT_EQUAL(numa.size(), static_cast<std::size_t>(n + 1));
+    ASSERT_EQUAL(thrust::reduce(numa.begin(), numa.end()), n + 3);
+}
+DECLARE_UNITTEST(TestHostPagesVectorGrowth);
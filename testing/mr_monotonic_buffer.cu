@@ -0,0 +1,203 @@
+#include <unittest/unittest.h>
+
+#include <thrust/detail/config.h>
+#include <thrust/mr/monotonic_buffer.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/device_memory_resource.h>
+#include <thrust/mr/new.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+
+#include <cstring>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+class counting_resource final : public thrust::mr::memory_resource<>
+{
+public:
+    counting_resource() : allocations(0), bytes(0)
+    {
+    }
+
+    virtual void * do_allocate(std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        ++allocations;
+        bytes += n;
+        return upstream.do_allocate(n, alignment);
+    }
+
+    virtual void do_deallocate(void * p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        bytes -= n;
+        upstream.do_deallocate(p, n, alignment);
+    }
+
+    std::size_t allocations;
+    std::size_t bytes;
+
+private:
+    thrust::mr::new_delete_resource upstream;
+};
+
+typedef thrust::mr::monotonic_buffer_resource<counting_resource> arena_t;
+
+void TestMonotonicBufferResourceBumps()
+{
+    counting_resource upstream;
+
+    {
+        arena_t arena(&upstream, 1024);
+
+        // consecutive allocations are adjacent, up to their alignment
+        char * a = static_cast<char *>(arena.do_allocate(10, 16));
+        char * b = static_cast<char *>(arena.do_allocate(10, 16));
+        char * c = static_cast<char *>(arena.do_allocate(4, 4));
+        ASSERT_EQUAL(reinterpret_cast<std::size_t>(a) % 16, 0u);
+        ASSERT_EQUAL(b - a, 16);
+        ASSERT_EQUAL(c - b, 12);
+        ASSERT_EQUAL(upstream.allocations, 1u);
+
+        // deallocation does nothing
+        arena.do_deallocate(b, 10, 16);
+        ASSERT_EQUAL(static_cast<char *>(arena.do_allocate(1, 1)), c + 4);
+
+        // the buffers grow geometrically
+        std::vector<char *> blocks;
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            char * p = static_cast<char *>(arena.do_allocate(100, 64));
+            ASSERT_EQUAL(reinterpret_cast<std::size_t>(p) % 64, 0u);
+            std::memset(p, static_cast<int>(i), 100);
+            blocks.push_back(p);
+        }
+        ASSERT_EQUAL(upstream.allocations <= 10, true);
+
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            ASSERT_EQUAL(static_cast<std::size_t>(static_cast<unsigned char>(blocks[i][99])), i % 256);
+        }
+
+        // a reset reuses the buffers
+        std::size_t allocations = upstream.allocations;
+        arena.reset();
+        ASSERT_EQUAL(static_cast<char *>(arena.do_allocate(10, 16)), a);
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            void * p = arena.do_allocate(100, 64);
+            ASSERT_EQUAL(reinterpret_cast<std::size_t>(p) % 64, 0u);
+        }
+        ASSERT_EQUAL(upstream.allocations, allocations);
+
+        // an allocation bigger than the next buffer gets a buffer of its own size
+        void * big = arena.do_allocate(1 << 24, 16);
+        ASSERT_EQUAL(reinterpret_cast<std::size_t>(big) % 16, 0u);
+        ASSERT_EQUAL(upstream.allocations, allocations + 1);
+
+        arena.release();
+        ASSERT_EQUAL(upstream.bytes, 0u);
+
+        void * small = arena.do_allocate(10, 16);
+        ASSERT_EQUAL(reinterpret_cast<std::size_t>(small) % 16, 0u);
+        ASSERT_EQUAL(upstream.bytes, 1024u);
+    }
+
+    ASSERT_EQUAL(upstream.bytes, 0u);
+}
+DECLARE_UNITTEST(TestMonotonicBufferResourceBumps);
+
+void TestMonotonicBufferResourceInitialBuffer()
+{
+    counting_resource upstream;
+
+    alignas(16) char buffer[256];
+    arena_t arena(buffer, sizeof(buffer), &upstream);
+
+    // the initial buffer is used first
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        char * p = static_cast<char *>(arena.do_allocate(16, 16));
+        ASSERT_EQUAL(p, buffer + i * 16);
+    }
+    ASSERT_EQUAL(upstream.allocations, 0u);
+
+    // and then buffers from upstream, starting at twice its size
+    void * first_upstream = arena.do_allocate(16, 16);
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(first_upstream) % 16, 0u);
+    ASSERT_EQUAL(upstream.allocations, 1u);
+    ASSERT_EQUAL(upstream.bytes, 512u);
+
+    // after a release, the initial buffer is used again
+    arena.release();
+    ASSERT_EQUAL(static_cast<char *>(arena.do_allocate(16, 16)), buffer);
+    ASSERT_EQUAL(upstream.bytes, 0u);
+}
+DECLARE_UNITTEST(TestMonotonicBufferResourceInitialBuffer);
+
+void TestMonotonicBufferResourceEdgeCases()
+{
+    // a size alone does not convert to a resource
+    ASSERT_EQUAL((std::is_convertible<std::size_t, arena_t>::value), false);
+
+    counting_resource upstream;
+    arena_t arena(&upstream, 1024);
+
+    // an empty allocation before any buffer exists is not null, and takes a byte
+    char * empty = static_cast<char *>(arena.do_allocate(0, 1));
+    ASSERT_EQUAL(empty != NULL, true);
+    ASSERT_EQUAL(static_cast<char *>(arena.do_allocate(0, 1)), empty + 1);
+    ASSERT_EQUAL(upstream.allocations, 1u);
+
+    // a size that cannot be reached by doubling the buffers throws instead of looping
+    const std::size_t huge = (std::numeric_limits<std::size_t>::max)() / 2 + 2;
+    ASSERT_THROWS((void)arena.do_allocate(huge, 16), std::bad_alloc);
+    ASSERT_EQUAL(upstream.allocations, 1u);
+}
+DECLARE_UNITTEST(TestMonotonicBufferResourceEdgeCases);
+
+void TestMonotonicBufferResourceAllocator()
+{
+    counting_resource upstream;
+    arena_t arena(&upstream);
+
+    typedef thrust::mr::allocator<int, arena_t> allocator_t;
+    allocator_t alloc(&arena);
+
+    std::vector<int, allocator_t> v(alloc);
+    for (int i = 0; i < 1000; ++i)
+    {
+        v.push_back(i);
+    }
+
+    ASSERT_EQUAL(v[999], 999);
+    ASSERT_EQUAL(upstream.allocations <= 2, true);
+}
+DECLARE_UNITTEST(TestMonotonicBufferResourceAllocator);
+
+void TestMonotonicBufferResourcePolicy()
+{
+    thrust::mr::monotonic_buffer_resource<thrust::device_memory_resource> arena;
+
+    thrust::host_vector<int> h(10000);
+    for (std::size_t i = 0; i < h.size(); ++i)
+    {
+        h[i] = static_cast<int>((i * 7919) % h.size());
+    }
+
+    // the temporary storage of every batch comes from the arena, and is freed at once by a reset
+    for (int batch = 0; batch < 3; ++batch)
+    {
+        thrust::device_vector<int> d = h;
+        thrust::sort(thrust::device(&arena), d.begin(), d.end());
+        int sum = thrust::reduce(thrust::device(&arena), d.begin(), d.end());
+
+        ASSERT_EQUAL(thrust::is_sorted(d.begin(), d.end()), true);
+        ASSERT_EQUAL(sum, 10000 * 9999 / 2);
+
+        arena.reset();
+    }
+}
+DECLARE_UNITTEST(TestMonotonicBufferResourcePolicy);
@@ -5,6 +5,11 @@
 #include <thrust/mr/new.h>
 
 #include <thrust/mr/sync_pool.h>
+#include <thrust/mr/sharded_pool.h>
+
+#include <cstring>
+#include <thread>
+#include <vector>
 
 template<typename T>
 struct reference
@@ -250,6 +255,12 @@ void TestSynchronizedPool()
 }
 DECLARE_UNITTEST(TestSynchronizedPool);
 
+void TestShardedPool()
+{
+    TestPool<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPool);
+
 template<template<typename> class PoolTemplate>
 void TestPoolCachingOversized()
 {
@@ -361,6 +372,78 @@ void TestSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestSynchronizedPoolCachingOversized);
 
+void TestShardedPoolCachingOversized()
+{
+    TestPoolCachingOversized<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPoolCachingOversized);
+
+template<template<typename> class PoolTemplate>
+void TestPoolCachingManyOversized()
+{
+    tracked_resource upstream;
+
+    upstream.id_to_allocate = -1u;
+
+    typedef PoolTemplate<
+        tracked_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.cache_oversized = true;
+    opts.largest_block_size = 1024;
+
+    Pool pool(&upstream, opts);
+
+    const std::size_t count = 1000;
+    std::vector<tracked_pointer<void> > blocks;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        blocks.push_back(pool.do_allocate(2048 + 64 * i, 32));
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        pool.do_deallocate(blocks[i], 2048 + 64 * i, 32);
+    }
+
+    // every request is now served from the cache; from the largest one down, the
+    // only cached block big enough for each is the one of exactly the same size
+    upstream.id_to_allocate = 0;
+    for (std::size_t i = count; i-- > 0;)
+    {
+        tracked_pointer<void> a = pool.do_allocate(2048 + 64 * i, 32);
+        ASSERT_EQUAL(a.ptr, blocks[i].ptr);
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        pool.do_deallocate(blocks[i], 2048 + 64 * i, 32);
+    }
+
+    // and so is a request between two cached sizes
+    tracked_pointer<void> between = pool.do_allocate(2048 + 64 * (count / 2) + 1, 32);
+    pool.do_deallocate(between, 2048 + 64 * (count / 2) + 1, 32);
+}
+
+void TestUnsynchronizedPoolCachingManyOversized()
+{
+    TestPoolCachingManyOversized<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolCachingManyOversized);
+
+void TestSynchronizedPoolCachingManyOversized()
+{
+    TestPoolCachingManyOversized<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolCachingManyOversized);
+
+void TestShardedPoolCachingManyOversized()
+{
+    TestPoolCachingManyOversized<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPoolCachingManyOversized);
+
 template<template<typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -383,3 +466,357 @@ void TestSynchronizedGlobalPool()
 }
 DECLARE_UNITTEST(TestSynchronizedGlobalPool);
 
+void TestShardedGlobalPool()
+{
+    TestGlobalPool<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedGlobalPool);
+
+void count_upstream_allocations(std::size_t, std::size_t, bool oversized, void * user_data)
+{
+    std::size_t * counts = static_cast<std::size_t *>(user_data);
+    ++counts[oversized ? 1 : 0];
+}
+
+template<template<typename> class PoolTemplate>
+void TestPoolStats()
+{
+    thrust::mr::new_delete_resource upstream;
+
+    typedef PoolTemplate<
+        thrust::mr::new_delete_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.collect_stats = true;
+
+    Pool pool(&upstream, opts);
+
+    std::size_t upstream_counts[2] = { 0, 0 };
+    pool.set_upstream_callback(count_upstream_allocations, upstream_counts);
+
+    // the first pooled allocation allocates a chunk, the following ones are served from it
+    void * a1 = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    void * a2 = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    pool.do_deallocate(a2, 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    void * a3 = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+
+    // an oversized block is cached when deallocated, and reused by the next allocation
+    std::size_t oversized = opts.largest_block_size * 2;
+    void * o1 = pool.do_allocate(oversized, THRUST_MR_DEFAULT_ALIGNMENT);
+    pool.do_deallocate(o1, oversized, THRUST_MR_DEFAULT_ALIGNMENT);
+    void * o2 = pool.do_allocate(oversized, THRUST_MR_DEFAULT_ALIGNMENT);
+
+    thrust::mr::pool_stats stats = pool.stats();
+    ASSERT_EQUAL(stats.allocations, 5u);
+    ASSERT_EQUAL(stats.deallocations, 2u);
+    ASSERT_EQUAL(stats.cache_hits, 3u);
+    ASSERT_ALMOST_EQUAL(stats.hit_rate(), 0.6);
+    ASSERT_EQUAL(stats.upstream_allocations, 2u);
+    ASSERT_EQUAL(stats.upstream_deallocations, 0u);
+    ASSERT_EQUAL(stats.bytes_in_use, 32 + oversized);
+    ASSERT_EQUAL(stats.bytes_in_use_high_water, 32 + oversized);
+    ASSERT_EQUAL(stats.bytes_upstream_high_water >= stats.bytes_upstream, true);
+    ASSERT_EQUAL(stats.oversized_blocks, 1u);
+    ASSERT_EQUAL(stats.oversized_blocks_cached, 0u);
+    ASSERT_EQUAL(stats.buckets[0].block_size, 16u);
+    ASSERT_EQUAL(stats.buckets[0].blocks_in_use, 2u);
+    ASSERT_EQUAL(stats.bytes_cached, (stats.buckets[0].blocks - 2) * 16);
+
+    // the callback is called once for the chunk and once for the oversized block
+    ASSERT_EQUAL(upstream_counts[0], 1u);
+    ASSERT_EQUAL(upstream_counts[1], 1u);
+
+    // the cumulative counters survive a release
+    pool.release();
+    stats = pool.stats();
+    ASSERT_EQUAL(stats.allocations, 5u);
+    ASSERT_EQUAL(stats.upstream_deallocations, 2u);
+    ASSERT_EQUAL(stats.bytes_upstream, 0u);
+    ASSERT_EQUAL(stats.bytes_in_use, 0u);
+    ASSERT_EQUAL(stats.bytes_cached, 0u);
+    ASSERT_EQUAL(stats.bytes_in_use_high_water, 32 + oversized);
+
+    // without collect_stats, only the callback is called
+    Pool quiet(&upstream);
+    quiet.set_upstream_callback(count_upstream_allocations, upstream_counts);
+    void * q = quiet.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    quiet.do_deallocate(q, 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(quiet.stats().allocations, 0u);
+    ASSERT_EQUAL(upstream_counts[0], 2u);
+
+    (void)a1;
+    (void)a3;
+    (void)o2;
+}
+
+void TestUnsynchronizedPoolStats()
+{
+    TestPoolStats<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolStats);
+
+void TestSynchronizedPoolStats()
+{
+    TestPoolStats<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolStats);
+
+void TestShardedPoolStats()
+{
+    TestPoolStats<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPoolStats);
+
+class counting_resource final : public thrust::mr::memory_resource<>
+{
+public:
+    counting_resource() : allocations(0), bytes(0)
+    {
+    }
+
+    virtual void * do_allocate(std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        // the pool never uses its upstream resource from two threads at once
+        ++allocations;
+        bytes += n;
+        return upstream.do_allocate(n, alignment);
+    }
+
+    virtual void do_deallocate(void * p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        bytes -= n;
+        upstream.do_deallocate(p, n, alignment);
+    }
+
+    std::size_t allocations;
+    std::size_t bytes;
+
+private:
+    thrust::mr::new_delete_resource upstream;
+};
+
+void TestShardedPoolConcurrent()
+{
+    counting_resource upstream;
+    thrust::mr::sharded_pool_resource<counting_resource> pool(&upstream);
+
+    const std::size_t thread_count = 4;
+    const std::size_t count = 1000;
+
+    std::vector<std::vector<unsigned char *> > blocks(thread_count);
+    std::vector<std::size_t> overwritten(thread_count, 0);
+
+    // every thread allocates blocks of several pooled sizes, and fills them with its own value
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < thread_count; ++t)
+    {
+        threads.push_back(std::thread([&, t] {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::size_t size = i % 64 * 16 + 1;
+                unsigned char * p = static_cast<unsigned char *>(pool.allocate(size));
+                std::memset(p, static_cast<int>(t + 1), size);
+                blocks[t].push_back(p);
+            }
+        }));
+    }
+
+    for (std::size_t t = 0; t < thread_count; ++t)
+    {
+        threads[t].join();
+    }
+    threads.clear();
+
+    // then every thread deallocates the blocks of another one, which must not have been
+    // handed out twice
+    for (std::size_t t = 0; t < thread_count; ++t)
+    {
+        threads.push_back(std::thread([&, t] {
+            std::size_t owner = (t + 1) % thread_count;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::size_t size = i % 64 * 16 + 1;
+                unsigned char * p = blocks[owner][i];
+                for (std::size_t j = 0; j < size; ++j)
+                {
+                    if (p[j] != owner + 1)
+                    {
+                        ++overwritten[t];
+                        break;
+                    }
+                }
+                pool.deallocate(p, size);
+            }
+        }));
+    }
+
+    for (std::size_t t = 0; t < thread_count; ++t)
+    {
+        threads[t].join();
+        ASSERT_EQUAL(overwritten[t], 0u);
+    }
+
+    // the caches of the exited threads went back to the pool, so the same blocks can be
+    // allocated again without going to upstream
+    std::size_t allocations = upstream.allocations;
+    for (std::size_t t = 0; t < thread_count; ++t)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            blocks[t][i] = static_cast<unsigned char *>(pool.allocate(i % 64 * 16 + 1));
+        }
+    }
+    ASSERT_EQUAL(upstream.allocations, allocations);
+
+    for (std::size_t t = 0; t < thread_count; ++t)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            pool.deallocate(blocks[t][i], i % 64 * 16 + 1);
+        }
+    }
+}
+DECLARE_UNITTEST(TestShardedPoolConcurrent);
+
+template<template<typename> class PoolTemplate>
+void TestPoolTrim()
+{
+    counting_resource upstream;
+
+    typedef PoolTemplate<
+        counting_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    const std::size_t oversized = opts.largest_block_size * 2;
+
+    {
+        Pool pool(&upstream, opts);
+        // the bookkeeping of the pool itself
+        const std::size_t base = upstream.bytes;
+
+        std::vector<void *> small, large;
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            small.push_back(pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT));
+            large.push_back(pool.do_allocate(256, THRUST_MR_DEFAULT_ALIGNMENT));
+            std::memset(large[i], static_cast<int>(i), 256);
+        }
+
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            pool.do_deallocate(small[i], 16, THRUST_MR_DEFAULT_ALIGNMENT);
+        }
+
+        void * o = pool.do_allocate(oversized, THRUST_MR_DEFAULT_ALIGNMENT);
+        pool.do_deallocate(o, oversized, THRUST_MR_DEFAULT_ALIGNMENT);
+
+        // the cached oversized block and the chunks of the small blocks are returned to upstream
+        std::size_t held = upstream.bytes;
+        std::size_t released = pool.trim();
+        ASSERT_EQUAL(released > oversized, true);
+        ASSERT_EQUAL(upstream.bytes, held - released);
+
+        // the blocks in use stay valid, and are all that is left
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            unsigned char * p = static_cast<unsigned char *>(large[i]);
+            ASSERT_EQUAL(static_cast<std::size_t>(p[0]), i);
+            ASSERT_EQUAL(static_cast<std::size_t>(p[255]), i);
+        }
+        ASSERT_EQUAL(pool.trim(), 0u);
+
+        // and the trimmed sizes can be allocated again
+        void * s = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+        pool.do_deallocate(s, 16, THRUST_MR_DEFAULT_ALIGNMENT);
+
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            pool.do_deallocate(large[i], 256, THRUST_MR_DEFAULT_ALIGNMENT);
+        }
+
+        // a target keeps some of the cache
+        ASSERT_EQUAL(pool.trim(upstream.bytes), 0u);
+        pool.trim();
+        ASSERT_EQUAL(upstream.bytes, base);
+    }
+
+    // with watermarks, the cache is trimmed before going over the high watermark
+    opts.high_watermark = oversized * 5;
+    opts.low_watermark = 0;
+
+    {
+        Pool pool(&upstream, opts);
+        const std::size_t base = upstream.bytes;
+
+        for (std::size_t size = oversized; size <= oversized * 4; size *= 2)
+        {
+            void * p = pool.do_allocate(size, THRUST_MR_DEFAULT_ALIGNMENT);
+            ASSERT_EQUAL(upstream.bytes - base <= oversized * 5, true);
+            pool.do_deallocate(p, size, THRUST_MR_DEFAULT_ALIGNMENT);
+        }
+    }
+    ASSERT_EQUAL(upstream.bytes, 0u);
+
+    // cached oversized blocks go stale after max_cached_age allocations
+    opts.high_watermark = 0;
+    opts.max_cached_age = 10;
+
+    {
+        Pool pool(&upstream, opts);
+        const std::size_t base = upstream.bytes;
+
+        void * o = pool.do_allocate(oversized, THRUST_MR_DEFAULT_ALIGNMENT);
+        pool.do_deallocate(o, oversized, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQUAL(upstream.bytes - base > oversized, true);
+
+        for (std::size_t i = 0; i < 25; ++i)
+        {
+            void * p = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+            pool.do_deallocate(p, 16, THRUST_MR_DEFAULT_ALIGNMENT);
+        }
+        ASSERT_EQUAL(upstream.bytes - base < oversized, true);
+    }
+}
+
+void TestUnsynchronizedPoolTrim()
+{
+    TestPoolTrim<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolTrim);
+
+void TestSynchronizedPoolTrim()
+{
+    TestPoolTrim<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolTrim);
+
+void TestShardedPoolTrim()
+{
+    counting_resource upstream;
+    thrust::mr::sharded_pool_resource<counting_resource> pool(&upstream);
+
+    void * kept = pool.allocate(16);
+
+    // the caches of a thread go back to the shared free lists when it exits, and can then be trimmed
+    std::thread([&] {
+        std::vector<void *> blocks;
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            blocks.push_back(pool.allocate(i % 64 * 16 + 1));
+        }
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            pool.deallocate(blocks[i], i % 64 * 16 + 1);
+        }
+    }).join();
+
+    std::size_t held = upstream.bytes;
+    std::size_t released = pool.trim();
+    ASSERT_EQUAL(released > 0, true);
+    ASSERT_EQUAL(upstream.bytes, held - released);
+
+    pool.deallocate(kept, 16);
+}
+DECLARE_UNITTEST(TestShardedPoolTrim);
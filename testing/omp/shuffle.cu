@@ -0,0 +1,62 @@
+#include <unittest/unittest.h>
+
+#include <thrust/equal.h>
+#include <thrust/random.h>
+#include <thrust/sequence.h>
+#include <thrust/shuffle.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <omp.h>
+
+void TestOmpShuffleIsPermutation(void)
+{
+  typedef int T;
+
+  // spans several buckets of the scatter shuffle
+  const size_t n = (1 << 18) + 123;
+
+  thrust::host_vector<T> data(n);
+  thrust::sequence(data.begin(), data.end());
+
+  thrust::host_vector<T> shuffled(data);
+  thrust::default_random_engine g(0xD5);
+  thrust::shuffle(thrust::omp::par, shuffled.begin(), shuffled.end(), g);
+
+  ASSERT_EQUAL(thrust::equal(shuffled.begin(), shuffled.end(), data.begin()), false);
+
+  thrust::sort(shuffled.begin(), shuffled.end());
+  ASSERT_EQUAL(shuffled, data);
+}
+DECLARE_UNITTEST(TestOmpShuffleIsPermutation);
+
+void TestOmpShuffleThreadCountIndependent(void)
+{
+  typedef int T;
+
+  const size_t n = (1 << 18) + 123;
+
+  thrust::host_vector<T> data(n);
+  thrust::sequence(data.begin(), data.end());
+
+  const int max_threads = omp_get_max_threads();
+
+  thrust::host_vector<T> reference(n);
+  omp_set_num_threads(1);
+  thrust::default_random_engine g(183);
+  thrust::shuffle_copy(thrust::omp::par, data.begin(), data.end(), reference.begin(), g);
+
+  // more threads than cores are fine, and make the test meaningful on small machines
+  for(int num_threads = 2; num_threads <= 8; num_threads *= 2)
+  {
+    thrust::host_vector<T> result(n);
+    omp_set_num_threads(num_threads);
+    g.seed(183);
+    thrust::shuffle_copy(thrust::omp::par, data.begin(), data.end(), result.begin(), g);
+
+    ASSERT_EQUAL(result, reference);
+  }
+
+  omp_set_num_threads(max_threads);
+}
+DECLARE_UNITTEST(TestOmpShuffleThreadCountIndependent);
@@ -0,0 +1,84 @@
+#include <unittest/unittest.h>
+
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/system_error.h>
+#include <thrust/temporary_memory.h>
+
+#include <omp.h>
+
+template <typename Sort>
+void TestOmpTemporaryMemoryLimit(Sort sort)
+{
+  const size_t n = 1 << 16;
+
+  thrust::host_vector<int> keys(n);
+  for(size_t i = 0; i < n; ++i)
+  {
+    keys[i] = static_cast<int>((i * 7919) % n);
+  }
+
+  const int max_threads = omp_get_max_threads();
+
+  // the tiles are sorted, and their scratch space allocated, by the worker
+  // threads; the limit has to reach them, and their exceptions the caller
+  for(int num_threads = 1; num_threads <= 8; num_threads *= 2)
+  {
+    omp_set_num_threads(num_threads);
+
+    thrust::host_vector<int> v(keys);
+    sort(thrust::omp::par(thrust::temporary_memory_limit(size_t(1) << 40)), v);
+    for(size_t i = 0; i < n; ++i)
+    {
+      ASSERT_EQUAL(v[i], static_cast<int>(i));
+    }
+
+    v = keys;
+    bool thrown = false;
+    try
+    {
+      sort(thrust::omp::par(thrust::temporary_memory_limit(16)), v);
+    }
+    catch(thrust::system_error &e)
+    {
+      thrown = true;
+      ASSERT_EQUAL(e.code().value(), int(thrust::system::errc::not_enough_memory));
+    }
+    ASSERT_EQUAL(thrown, true);
+  }
+
+  omp_set_num_threads(max_threads);
+
+  ASSERT_EQUAL(thrust::get_temporary_memory_stats().current_bytes, 0u);
+}
+
+struct stable_sort_functor
+{
+  template <typename Policy>
+  void operator()(Policy policy, thrust::host_vector<int> &v) const
+  {
+    thrust::stable_sort(policy, v.begin(), v.end());
+  }
+};
+
+struct stable_sort_by_key_functor
+{
+  template <typename Policy>
+  void operator()(Policy policy, thrust::host_vector<int> &v) const
+  {
+    thrust::host_vector<int> values(v);
+    thrust::stable_sort_by_key(policy, v.begin(), v.end(), values.begin());
+  }
+};
+
+void TestOmpTemporaryMemoryLimitStableSort(void)
+{
+  TestOmpTemporaryMemoryLimit(stable_sort_functor());
+}
+DECLARE_UNITTEST(TestOmpTemporaryMemoryLimitStableSort);
+
+void TestOmpTemporaryMemoryLimitStableSortByKey(void)
+{
+  TestOmpTemporaryMemoryLimit(stable_sort_by_key_functor());
+}
+DECLARE_UNITTEST(TestOmpTemporaryMemoryLimitStableSortByKey);
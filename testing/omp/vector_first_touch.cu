@@ -0,0 +1,87 @@
+#include <unittest/unittest.h>
+
+#include <thrust/host_vector.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/system/omp/vector.h>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+// records the thread that reads each element
+struct record_thread
+{
+  int *threads;
+
+  int operator()(int x) const
+  {
+    threads[x] = omp_get_thread_num();
+    return x;
+  }
+};
+
+void TestOmpVectorConstructsInParallel(void)
+{
+  const int n = 1 << 20;
+
+  thrust::host_vector<int> source(n);
+  thrust::sequence(source.begin(), source.end());
+
+  std::vector<int> threads(n, -1);
+  record_thread f = {threads.data()};
+
+  // more threads than cores are fine, and make the test meaningful on small machines
+  const int max_threads = omp_get_max_threads();
+  omp_set_num_threads(4);
+
+  // a range of the sequential host system is copied into the vector by the OpenMP threads
+  thrust::omp::vector<int> v(thrust::make_transform_iterator(source.begin(), f),
+                             thrust::make_transform_iterator(source.end(), f));
+  ASSERT_EQUAL(thrust::host_vector<int>(v), source);
+
+  std::set<int> distinct(threads.begin(), threads.end());
+  ASSERT_EQUAL(distinct.count(-1), 0u);
+  ASSERT_EQUAL(distinct.size() > 1, true);
+
+  // and so is an assignment that needs new storage
+  std::fill(threads.begin(), threads.end(), -1);
+  thrust::omp::vector<int> w(n / 4);
+  w.assign(thrust::make_transform_iterator(source.begin(), f),
+           thrust::make_transform_iterator(source.end(), f));
+  ASSERT_EQUAL(thrust::host_vector<int>(w), source);
+
+  distinct = std::set<int>(threads.begin(), threads.end());
+  ASSERT_EQUAL(distinct.count(-1), 0u);
+  ASSERT_EQUAL(distinct.size() > 1, true);
+
+  omp_set_num_threads(max_threads);
+}
+DECLARE_UNITTEST(TestOmpVectorConstructsInParallel);
+
+void TestOmpVectorCopies(void)
+{
+  const int n = 100000;
+
+  std::vector<int> source(n);
+  for(int i = 0; i < n; ++i)
+  {
+    source[i] = i * 3;
+  }
+
+  thrust::omp::vector<int> v(source.begin(), source.end());
+  thrust::omp::vector<int> copy(v);
+  thrust::host_vector<int> h(copy);
+  ASSERT_EQUAL(h, thrust::host_vector<int>(source.begin(), source.end()));
+
+  v.resize(2 * n, 7);
+  ASSERT_EQUAL(v[n - 1], 3 * (n - 1));
+  ASSERT_EQUAL(v[2 * n - 1], 7);
+
+  v = h;
+  ASSERT_EQUAL(v.size(), static_cast<size_t>(n));
+  ASSERT_EQUAL(v[n / 2], 3 * (n / 2));
+}
+DECLARE_UNITTEST(TestOmpVectorCopies);
@@ -1,6 +1,8 @@
 #include <unittest/unittest.h>
 #include <thrust/random.h>
 #include <thrust/generate.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
 #include <sstream>
 
 template<typename Engine>
@@ -143,6 +145,45 @@ template<typename Engine>
 };
 
 
+template<typename Engine>
+  struct ValidateEngineDiscard
+{
+  THRUST_HOST_DEVICE bool operator()(void) const
+  {
+    bool result = true;
+
+    // discard must agree with stepping the engine, from every position in
+    // a block and across the jump ahead threshold
+    const unsigned long long offsets[] = {0, 1, 23, 24, 389, 4096, 4120, 12345};
+    const unsigned long long distances[] = {0, 1, 11, 12, 223, 2047, 4119, 4121, 20000};
+
+    for(unsigned long long offset : offsets)
+    {
+      for(unsigned long long distance : distances)
+      {
+        Engine e0(13), e1(13);
+        e0.discard(offset);
+        for(unsigned long long i = 0; i < offset; ++i)
+        {
+          e1();
+        }
+
+        e0.discard(distance);
+        for(unsigned long long i = 0; i < distance; ++i)
+        {
+          e1();
+        }
+
+        result &= (e0 == e1);
+        result &= (e0() == e1());
+      }
+    }
+
+    return result;
+  }
+};
+
+
 template<typename Distribution, typename Engine>
   struct ValidateDistributionMin
 {
@@ -338,6 +379,25 @@ void TestEngineUnequal(void)
   ASSERT_EQUAL(true, d[0]);
 }
 
+
+template<typename Engine>
+void TestEngineDiscard(void)
+{
+  ValidateEngineDiscard<Engine> f;
+
+  // test host
+  thrust::host_vector<bool> h(1);
+  thrust::generate(h.begin(), h.end(), f);
+
+  ASSERT_EQUAL(true, h[0]);
+
+  // test device
+  thrust::device_vector<bool> d(1);
+  thrust::generate(d.begin(), d.end(), f);
+
+  ASSERT_EQUAL(true, d[0]);
+}
+
 void TestRanlux24BaseValidation(void)
 {
   typedef thrust::random::ranlux24_base Engine;
@@ -392,6 +452,15 @@ void TestRanlux24BaseUnequal(void)
 DECLARE_UNITTEST(TestRanlux24BaseUnequal);
 
 
+void TestRanlux24BaseDiscard(void)
+{
+  typedef thrust::random::ranlux24_base Engine;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux24BaseDiscard);
+
+
 void TestRanlux48BaseValidation(void)
 {
   typedef thrust::random::ranlux48_base Engine;
@@ -455,6 +524,15 @@ void TestRanlux48BaseUnequal(void)
 DECLARE_UNITTEST(TestRanlux48BaseUnequal);
 
 
+void TestRanlux48BaseDiscard(void)
+{
+  typedef thrust::random::ranlux48_base Engine;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux48BaseDiscard);
+
+
 void TestMinstdRandValidation(void)
 {
   typedef thrust::random::minstd_rand Engine;
@@ -617,6 +695,15 @@ void TestTaus88Unequal(void)
 DECLARE_UNITTEST(TestTaus88Unequal);
 
 
+void TestTaus88Discard(void)
+{
+  typedef thrust::random::taus88 Engine;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestTaus88Discard);
+
+
 void TestRanlux24Validation(void)
 {
   typedef thrust::random::ranlux24 Engine;
@@ -671,6 +758,15 @@ void TestRanlux24Unequal(void)
 DECLARE_UNITTEST(TestRanlux24Unequal);
 
 
+void TestRanlux24Discard(void)
+{
+  typedef thrust::random::ranlux24 Engine;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux24Discard);
+
+
 
 void TestRanlux48Validation(void)
 {
@@ -726,6 +822,588 @@ void TestRanlux48Unequal(void)
 DECLARE_UNITTEST(TestRanlux48Unequal);
 
 
+void TestRanlux48Discard(void)
+{
+  typedef thrust::random::ranlux48 Engine;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestRanlux48Discard);
+
+
+void TestPhilox4x32Validation(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineValidation<Engine,1955073260u>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Validation);
+
+
+void TestPhilox4x32Min(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Min);
+
+
+void TestPhilox4x32Max(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Max);
+
+
+void TestPhilox4x32SaveRestore(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32SaveRestore);
+
+
+void TestPhilox4x32Equal(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Equal);
+
+
+void TestPhilox4x32Unequal(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Unequal);
+
+
+void TestPhilox4x32Discard(void)
+{
+  typedef thrust::random::philox4x32 Engine;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Discard);
+
+
+
+void TestPhilox4x64Validation(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineValidation<Engine,3409172418970261260ull>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Validation);
+
+
+void TestPhilox4x64Min(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Min);
+
+
+void TestPhilox4x64Max(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Max);
+
+
+void TestPhilox4x64SaveRestore(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64SaveRestore);
+
+
+void TestPhilox4x64Equal(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Equal);
+
+
+void TestPhilox4x64Unequal(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Unequal);
+
+
+void TestPhilox4x64Discard(void)
+{
+  typedef thrust::random::philox4x64 Engine;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Discard);
+
+
+
+void TestThreefry4x32Validation(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineValidation<Engine,112810865u>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Validation);
+
+
+void TestThreefry4x32Min(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Min);
+
+
+void TestThreefry4x32Max(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Max);
+
+
+void TestThreefry4x32SaveRestore(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32SaveRestore);
+
+
+void TestThreefry4x32Equal(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Equal);
+
+
+void TestThreefry4x32Unequal(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Unequal);
+
+
+void TestThreefry4x32Discard(void)
+{
+  typedef thrust::random::threefry4x32 Engine;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Discard);
+
+
+
+void TestThreefry4x64Validation(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineValidation<Engine,9253438642465275567ull>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Validation);
+
+
+void TestThreefry4x64Min(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Min);
+
+
+void TestThreefry4x64Max(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Max);
+
+
+void TestThreefry4x64SaveRestore(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64SaveRestore);
+
+
+void TestThreefry4x64Equal(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Equal);
+
+
+void TestThreefry4x64Unequal(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Unequal);
+
+
+void TestThreefry4x64Discard(void)
+{
+  typedef thrust::random::threefry4x64 Engine;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Discard);
+
+
+
+void TestSquares32Validation(void)
+{
+  typedef thrust::random::squares32 Engine;
+
+  TestEngineValidation<Engine,941856950u>();
+}
+DECLARE_UNITTEST(TestSquares32Validation);
+
+
+void TestSquares32Min(void)
+{
+  typedef thrust::random::squares32 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestSquares32Min);
+
+
+void TestSquares32Max(void)
+{
+  typedef thrust::random::squares32 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestSquares32Max);
+
+
+void TestSquares32SaveRestore(void)
+{
+  typedef thrust::random::squares32 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestSquares32SaveRestore);
+
+
+void TestSquares32Equal(void)
+{
+  typedef thrust::random::squares32 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestSquares32Equal);
+
+
+void TestSquares32Unequal(void)
+{
+  typedef thrust::random::squares32 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestSquares32Unequal);
+
+
+void TestSquares32Discard(void)
+{
+  typedef thrust::random::squares32 Engine;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestSquares32Discard);
+
+
+
+void TestSquares64Validation(void)
+{
+  typedef thrust::random::squares64 Engine;
+
+  TestEngineValidation<Engine,4045244800961042677ull>();
+}
+DECLARE_UNITTEST(TestSquares64Validation);
+
+
+void TestSquares64Min(void)
+{
+  typedef thrust::random::squares64 Engine;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestSquares64Min);
+
+
+void TestSquares64Max(void)
+{
+  typedef thrust::random::squares64 Engine;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestSquares64Max);
+
+
+void TestSquares64SaveRestore(void)
+{
+  typedef thrust::random::squares64 Engine;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestSquares64SaveRestore);
+
+
+void TestSquares64Equal(void)
+{
+  typedef thrust::random::squares64 Engine;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestSquares64Equal);
+
+
+void TestSquares64Unequal(void)
+{
+  typedef thrust::random::squares64 Engine;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestSquares64Unequal);
+
+
+void TestSquares64Discard(void)
+{
+  typedef thrust::random::squares64 Engine;
+
+  TestEngineDiscard<Engine>();
+}
+DECLARE_UNITTEST(TestSquares64Discard);
+
+
+template<typename Engine>
+  struct CounterBasedEngineValue
+{
+  THRUST_HOST_DEVICE
+  typename Engine::result_type operator()(unsigned long long i) const
+  {
+    Engine e(13);
+    e.discard(i);
+    return e();
+  }
+};
+
+
+template<typename Engine>
+void TestCounterBasedEngineTransform(void)
+{
+  typedef typename Engine::result_type T;
+  const size_t n = 1000;
+
+  // the ith value is a pure function of the seed and i, so host and device
+  // agree with each other and with a sequential run
+  thrust::host_vector<T> h(n);
+  thrust::transform(thrust::counting_iterator<unsigned long long>(0),
+                    thrust::counting_iterator<unsigned long long>(n),
+                    h.begin(),
+                    CounterBasedEngineValue<Engine>());
+
+  thrust::device_vector<T> d(n);
+  thrust::transform(thrust::counting_iterator<unsigned long long>(0),
+                    thrust::counting_iterator<unsigned long long>(n),
+                    d.begin(),
+                    CounterBasedEngineValue<Engine>());
+
+  thrust::host_vector<T> reference(n);
+  Engine e(13);
+  for(size_t i = 0; i < n; ++i)
+  {
+    reference[i] = e();
+  }
+
+  ASSERT_EQUAL(reference, h);
+  ASSERT_EQUAL(reference, d);
+}
+
+
+void TestCounterBasedEnginesTransform(void)
+{
+  TestCounterBasedEngineTransform<thrust::random::philox4x32>();
+  TestCounterBasedEngineTransform<thrust::random::philox4x64>();
+  TestCounterBasedEngineTransform<thrust::random::threefry4x32>();
+  TestCounterBasedEngineTransform<thrust::random::threefry4x64>();
+  TestCounterBasedEngineTransform<thrust::random::squares32>();
+  TestCounterBasedEngineTransform<thrust::random::squares64>();
+}
+DECLARE_UNITTEST(TestCounterBasedEnginesTransform);
+
+
+void TestPhiloxKnownAnswer(void)
+{
+  // Random123 known answers for a zero key and a zero counter
+  thrust::random::philox4x32 e32(0);
+  ASSERT_EQUAL(0x6627e8d5u, e32());
+  ASSERT_EQUAL(0xe169c58du, e32());
+  ASSERT_EQUAL(0xbc57ac4cu, e32());
+  ASSERT_EQUAL(0x9b00dbd8u, e32());
+
+  thrust::random::philox4x64 e64(0);
+  ASSERT_EQUAL(0x16554d9eca36314cull, e64());
+  ASSERT_EQUAL(0xdb20fe9d672d0fdcull, e64());
+  ASSERT_EQUAL(0xd7e772cee186176bull, e64());
+  ASSERT_EQUAL(0x7e68b68aec7ba23bull, e64());
+}
+DECLARE_UNITTEST(TestPhiloxKnownAnswer);
+
+
+void TestThreefryKnownAnswer(void)
+{
+  // Random123 known answers for a zero key and a zero counter
+  thrust::random::threefry4x32 e32(0);
+  ASSERT_EQUAL(0x9c6ca96au, e32());
+  ASSERT_EQUAL(0xe17eae66u, e32());
+  ASSERT_EQUAL(0xfc10ecd4u, e32());
+  ASSERT_EQUAL(0x5256a7d8u, e32());
+
+  thrust::random::threefry4x64 e64(0);
+  ASSERT_EQUAL(0x09218ebde6c85537ull, e64());
+  ASSERT_EQUAL(0x55941f5266d86105ull, e64());
+  ASSERT_EQUAL(0x4bd25e16282434dcull, e64());
+  ASSERT_EQUAL(0xee29ec846bd2e40bull, e64());
+}
+DECLARE_UNITTEST(TestThreefryKnownAnswer);
+
+
+template<typename Engine, size_t lanes>
+  struct ValidateSimdEngine
+{
+  THRUST_HOST_DEVICE bool operator()(void) const
+  {
+    const unsigned long long stride = 100000;
+
+    // lane j produces the values of a scalar engine advanced by j * stride
+    thrust::random::simd_engine<Engine,lanes> e(Engine(13), stride);
+
+    Engine scalar[lanes];
+    for(size_t j = 0; j < lanes; ++j)
+    {
+      scalar[j] = Engine(13);
+      scalar[j].discard(j * stride);
+    }
+
+    bool result = true;
+
+    typename Engine::result_type values[lanes];
+    for(int i = 0; i < 1000; ++i)
+    {
+      e(values);
+      for(size_t j = 0; j < lanes; ++j)
+      {
+        result &= (values[j] == scalar[j]());
+      }
+    }
+
+    e.discard(12345);
+    for(size_t j = 0; j < lanes; ++j)
+    {
+      scalar[j].discard(12345);
+      result &= (e.lane(j) == scalar[j]);
+    }
+
+    return result;
+  }
+}; // end ValidateSimdEngine
+
+
+template<typename Engine, size_t lanes>
+void TestSimdEngine(void)
+{
+  // test host
+  thrust::host_vector<bool> h(1);
+  thrust::generate(h.begin(), h.end(), ValidateSimdEngine<Engine,lanes>());
+
+  ASSERT_EQUAL(true, h[0]);
+
+  // test device
+  thrust::device_vector<bool> d(1);
+  thrust::generate(d.begin(), d.end(), ValidateSimdEngine<Engine,lanes>());
+
+  ASSERT_EQUAL(true, d[0]);
+
+  typedef thrust::random::simd_engine<Engine,lanes> SimdEngine;
+
+  // save and restore
+  SimdEngine e0(Engine(13), 1000);
+  e0.discard(10000);
+
+  std::stringstream ss;
+  ss << e0;
+
+  SimdEngine e1;
+  ASSERT_EQUAL(true, e0 != e1);
+
+  ss >> e1;
+  ASSERT_EQUAL(true, e0 == e1);
+}
+
+
+void TestSimdEngineMinstdRand(void)
+{
+  TestSimdEngine<thrust::random::minstd_rand, 8>();
+  TestSimdEngine<thrust::random::minstd_rand, 16>();
+}
+DECLARE_UNITTEST(TestSimdEngineMinstdRand);
+
+
+void TestSimdEngineTaus88(void)
+{
+  TestSimdEngine<thrust::random::taus88, 8>();
+  TestSimdEngine<thrust::random::taus88, 16>();
+}
+DECLARE_UNITTEST(TestSimdEngineTaus88);
+
+
+void TestSimdEngineRanlux24Base(void)
+{
+  TestSimdEngine<thrust::random::ranlux24_base, 4>();
+}
+DECLARE_UNITTEST(TestSimdEngineRanlux24Base);
+
+
+
 THRUST_DISABLE_MSVC_WARNING_BEGIN(4305) // truncation warning
 template<typename Distribution, typename Validator>
   void ValidateDistributionCharacteristic(void)
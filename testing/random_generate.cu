@@ -0,0 +1,126 @@
+#include <unittest/unittest.h>
+#include <thrust/random.h>
+#include <thrust/random/generate.h>
+#include <thrust/execution_policy.h>
+
+#include <cmath>
+
+template<typename Vector, typename Engine, typename Distribution>
+void TestRandomGenerateSequential(const size_t n, Distribution dist)
+{
+  typedef typename Vector::value_type T;
+
+  // uniform distributions produce exactly the sequential results
+  Vector result(n);
+  Engine e0(13);
+  thrust::random::generate(result.begin(), result.end(), e0, dist);
+
+  thrust::host_vector<T> reference(n);
+  Engine e1(13);
+  for(size_t i = 0; i < n; ++i)
+  {
+    reference[i] = dist(e1);
+  }
+
+  // device arithmetic may contract the scaling of the engine values
+  ASSERT_ALMOST_EQUAL(reference, result);
+
+  // and leave the engine where the sequential loop does
+  ASSERT_EQUAL(true, e0 == e1);
+}
+
+
+void TestRandomGenerateUniformReal(const size_t n)
+{
+  thrust::random::uniform_real_distribution<float>  float_dist(-1, 2);
+  thrust::random::uniform_real_distribution<double> double_dist(-1, 2);
+
+  TestRandomGenerateSequential<thrust::host_vector<float>,    thrust::minstd_rand>(n, float_dist);
+  TestRandomGenerateSequential<thrust::device_vector<float>,  thrust::minstd_rand>(n, float_dist);
+  TestRandomGenerateSequential<thrust::host_vector<double>,   thrust::philox4x32>(n, double_dist);
+  TestRandomGenerateSequential<thrust::device_vector<double>, thrust::philox4x32>(n, double_dist);
+}
+DECLARE_SIZED_UNITTEST(TestRandomGenerateUniformReal);
+
+
+void TestRandomGenerateUniformInt(const size_t n)
+{
+  thrust::random::uniform_int_distribution<int> dist(-5, 100);
+
+  TestRandomGenerateSequential<thrust::host_vector<int>,   thrust::minstd_rand>(n, dist);
+  TestRandomGenerateSequential<thrust::device_vector<int>, thrust::minstd_rand>(n, dist);
+  TestRandomGenerateSequential<thrust::host_vector<int>,   thrust::squares32>(n, dist);
+  TestRandomGenerateSequential<thrust::device_vector<int>, thrust::squares32>(n, dist);
+  TestRandomGenerateSequential<thrust::host_vector<int>,   thrust::taus88>(n, dist);
+  TestRandomGenerateSequential<thrust::device_vector<int>, thrust::taus88>(n, dist);
+}
+DECLARE_SIZED_UNITTEST(TestRandomGenerateUniformInt);
+
+
+template<typename T>
+void TestRandomGenerateNormal(const size_t n)
+{
+  thrust::random::normal_distribution<T> dist(2, 3);
+
+  thrust::host_vector<T> h(n);
+  thrust::philox4x32 e0(7);
+  thrust::random::generate(h.begin(), h.end(), e0, dist);
+
+  thrust::device_vector<T> d(n);
+  thrust::philox4x32 e1(7);
+  thrust::random::generate(d.begin(), d.end(), e1, dist);
+
+  // both values of each pair are used, so the engine advances once per result
+  thrust::philox4x32 e2(7);
+  e2.discard(n + (n & 1));
+
+  ASSERT_ALMOST_EQUAL(h, d);
+  ASSERT_EQUAL(true, e0 == e2);
+  ASSERT_EQUAL(true, e1 == e2);
+
+  if(n >= 10000)
+  {
+    double sum = 0, sum_of_squares = 0;
+    for(size_t i = 0; i < n; ++i)
+    {
+      sum            += h[i];
+      sum_of_squares += double(h[i]) * h[i];
+    }
+
+    const double mean   = sum / n;
+    const double stddev = std::sqrt(sum_of_squares / n - mean * mean);
+
+    ASSERT_EQUAL(true, std::abs(mean - 2) < 0.1);
+    ASSERT_EQUAL(true, std::abs(stddev - 3) < 0.1);
+  }
+}
+
+
+void TestRandomGenerateNormalDistribution(const size_t n)
+{
+  TestRandomGenerateNormal<float>(n);
+  TestRandomGenerateNormal<double>(n);
+}
+DECLARE_SIZED_UNITTEST(TestRandomGenerateNormalDistribution);
+
+
+void TestRandomGenerateContinuesStream(void)
+{
+  // two calls fill the range the same way as one
+  const size_t n = 10001;
+  thrust::random::uniform_real_distribution<float> dist;
+
+  thrust::device_vector<float> once(2 * n);
+  thrust::minstd_rand e0(5);
+  thrust::random::generate(thrust::device, once.begin(), once.end(), e0, dist);
+
+  thrust::device_vector<float> twice(2 * n);
+  thrust::minstd_rand e1(5);
+  thrust::random::generate(thrust::device, twice.begin(), twice.begin() + n, e1, dist);
+  thrust::random::generate(thrust::device, twice.begin() + n, twice.end(), e1, dist);
+
+  ASSERT_EQUAL(once, twice);
+  ASSERT_EQUAL(true, e0 == e1);
+}
+DECLARE_UNITTEST(TestRandomGenerateContinuesStream);
+
@@ -358,6 +358,10 @@ void TestShuffleCopySimple() {
 }
 DECLARE_VECTOR_UNITTEST(TestShuffleCopySimple);
 
+// The OMP and TBB systems use a scatter shuffle instead of the Feistel
+// bijection, so their results only match systems using the same algorithm
+#if (THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB) == \
+    (THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_OMP || THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_TBB)
 template <typename T>
 void TestHostDeviceIdentical(size_t m) {
   thrust::host_vector<T> host_result(m);
@@ -374,6 +378,7 @@ void TestHostDeviceIdentical(size_t m) {
   ASSERT_EQUAL(device_result, host_result);
 }
 DECLARE_VARIABLE_UNITTEST(TestHostDeviceIdentical);
+#endif
 
 template <typename T>
 void TestFunctionIsBijection(size_t m) {
@@ -559,11 +564,13 @@ void TestShuffleEvenSpacingBetweenOccurances() {
 }
 DECLARE_INTEGRAL_VECTOR_UNITTEST(TestShuffleEvenSpacingBetweenOccurances);
 
+// Returns whether every position and every value of the shuffles made with
+// the given seed pass a chi-squared test of uniformity
 template <typename Vector>
-void TestShuffleEvenDistribution() {
+bool ShuffleEvenDistributionPasses(unsigned int seed) {
   typedef typename Vector::value_type T;
   const uint64_t shuffle_sizes[] = {10, 100, 500};
-  thrust::default_random_engine g(0xD5);
+  thrust::default_random_engine g(seed);
   for (auto shuffle_size : shuffle_sizes) {
     if(shuffle_size > (uint64_t)std::numeric_limits<T>::max())
       continue;
@@ -594,12 +601,30 @@ void TestShuffleEvenDistribution() {
 
       double p_score_pos = CephesFunctions::cephes_igamc(
           (double)(shuffle_size - 1) / 2.0, chi_squared_pos / 2.0);
-      ASSERT_GREATER(p_score_pos, 0.001 / (double)shuffle_size);
-
       double p_score_num = CephesFunctions::cephes_igamc(
           (double)(shuffle_size - 1) / 2.0, chi_squared_num / 2.0);
-      ASSERT_GREATER(p_score_num, 0.001 / (double)shuffle_size);
+      if (p_score_pos <= 0.001 / (double)shuffle_size ||
+          p_score_num <= 0.001 / (double)shuffle_size) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename Vector>
+void TestShuffleEvenDistribution() {
+  // A uniform shuffle fails the test with a single seed about once in 200
+  // seeds, and which seeds fail depends on the shuffle algorithm of the
+  // backend. Requiring most of several seeds to pass keeps the test
+  // independent of the backend, while a biased shuffle still fails them all.
+  const unsigned int seeds[] = {0xD5, 0x2A, 0x7F31, 0x1234, 0xBEEF, 0x5EED, 0x9E37, 0xC0FFEE};
+  int passes = 0;
+  for (auto seed : seeds) {
+    if (ShuffleEvenDistributionPasses<Vector>(seed)) {
+      passes++;
     }
   }
+  ASSERT_GEQUAL(passes, 6);
 }
 DECLARE_INTEGRAL_VECTOR_UNITTEST(TestShuffleEvenDistribution);
@@ -0,0 +1,99 @@
+#include <unittest/unittest.h>
+
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <cstring>
+#include <memory>
+
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+
+template <typename T>
+thrust::host_vector<T> ill_conditioned_input(size_t n)
+{
+  // terms of very different magnitudes and signs, so that any change in the
+  // order of evaluation changes the rounded sum
+  thrust::host_vector<T> data(n);
+  unsigned int state = 0x9E3779B9u;
+  for(size_t i = 0; i < n; ++i)
+  {
+    state = state * 1664525u + 1013904223u;
+    const T mantissa = T(state >> 8) / T(1 << 24);
+    const int exponent = static_cast<int>((state >> 4) % 24) - 12;
+    data[i] = (state & 1 ? -mantissa : mantissa) * T(1 << 12) / T(1 << (exponent + 12));
+  }
+  return data;
+}
+
+template <typename T>
+bool bitwise_equal(T a, T b)
+{
+  return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template <typename T>
+struct TestTbbReduceDeterministic
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> data = ill_conditioned_input<T>(n);
+
+    T reference = T(0);
+    {
+      tbb::global_control limit(tbb::global_control::max_allowed_parallelism, 1);
+      reference = thrust::reduce(thrust::tbb::par_det, data.begin(), data.end(), T(0));
+    }
+
+    // the arena gets as many threads as the limit allows, even beyond the
+    // number of cores, which makes the test meaningful on small machines
+    for(int num_threads = 2; num_threads <= 8; ++num_threads)
+    {
+      tbb::global_control limit(tbb::global_control::max_allowed_parallelism, num_threads);
+      tbb::task_arena arena(num_threads);
+
+      T result = T(0);
+      arena.execute([&] {
+        result = thrust::reduce(thrust::tbb::par_det, data.begin(), data.end(), T(0));
+      });
+
+      ASSERT_EQUAL(bitwise_equal(result, reference), true);
+    }
+  }
+};
+DECLARE_GENERIC_SIZED_UNITTEST_WITH_TYPES(TestTbbReduceDeterministic, FloatingPointTypes);
+
+void TestTbbReduceDeterministicSimple(void)
+{
+  thrust::host_vector<int> data(3);
+  data[0] = 1; data[1] = -2; data[2] = 3;
+
+  ASSERT_EQUAL(thrust::reduce(thrust::tbb::par_det, data.begin(), data.end()), 2);
+  ASSERT_EQUAL(thrust::reduce(thrust::tbb::par_det, data.begin(), data.end(), 10), 12);
+  ASSERT_EQUAL(thrust::reduce(thrust::tbb::par_det, data.begin(), data.end(), 0, thrust::maximum<int>()), 3);
+  ASSERT_EQUAL(thrust::reduce(thrust::tbb::par_det, data.begin(), data.begin(), 10), 10);
+}
+DECLARE_UNITTEST(TestTbbReduceDeterministicSimple);
+
+void TestTbbReduceDeterministicMultiLevel(void)
+{
+  // more than 4096 * 4096 elements need a second level of partial sums
+  const size_t n = (size_t(1) << 24) + 4097;
+  thrust::host_vector<int> data(n, 1);
+
+  ASSERT_EQUAL(thrust::reduce(thrust::tbb::par_det, data.begin(), data.end(), size_t(0)), n);
+}
+DECLARE_UNITTEST(TestTbbReduceDeterministicMultiLevel);
+
+void TestTbbReduceDeterministicWithAllocator(void)
+{
+  thrust::host_vector<double> data = ill_conditioned_input<double>(100000);
+  std::allocator<char> alloc;
+
+  const double expected = thrust::reduce(thrust::tbb::par_det, data.begin(), data.end(), 0.0);
+  const double result   = thrust::reduce(thrust::tbb::par_det(alloc), data.begin(), data.end(), 0.0);
+
+  ASSERT_EQUAL(bitwise_equal(result, expected), true);
+}
+DECLARE_UNITTEST(TestTbbReduceDeterministicWithAllocator);
@@ -0,0 +1,66 @@
+#include <unittest/unittest.h>
+
+#include <thrust/equal.h>
+#include <thrust/random.h>
+#include <thrust/sequence.h>
+#include <thrust/shuffle.h>
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+
+void TestTbbShuffleIsPermutation(void)
+{
+  typedef int T;
+
+  // spans several buckets of the scatter shuffle
+  const size_t n = (1 << 18) + 123;
+
+  thrust::host_vector<T> data(n);
+  thrust::sequence(data.begin(), data.end());
+
+  thrust::host_vector<T> shuffled(data);
+  thrust::default_random_engine g(0xD5);
+  thrust::shuffle(thrust::tbb::par, shuffled.begin(), shuffled.end(), g);
+
+  ASSERT_EQUAL(thrust::equal(shuffled.begin(), shuffled.end(), data.begin()), false);
+
+  thrust::sort(shuffled.begin(), shuffled.end());
+  ASSERT_EQUAL(shuffled, data);
+}
+DECLARE_UNITTEST(TestTbbShuffleIsPermutation);
+
+void TestTbbShuffleThreadCountIndependent(void)
+{
+  typedef int T;
+
+  const size_t n = (1 << 18) + 123;
+
+  thrust::host_vector<T> data(n);
+  thrust::sequence(data.begin(), data.end());
+
+  thrust::host_vector<T> reference(n);
+  thrust::default_random_engine g(183);
+  {
+    tbb::global_control limit(tbb::global_control::max_allowed_parallelism, 1);
+    thrust::shuffle_copy(thrust::tbb::par, data.begin(), data.end(), reference.begin(), g);
+  }
+
+  // the arena gets as many threads as the limit allows, even beyond the
+  // number of cores
+  for(int num_threads = 2; num_threads <= 8; num_threads *= 2)
+  {
+    tbb::global_control limit(tbb::global_control::max_allowed_parallelism, num_threads);
+    tbb::task_arena arena(num_threads);
+
+    thrust::host_vector<T> result(n);
+    g.seed(183);
+    arena.execute([&] {
+      thrust::shuffle_copy(thrust::tbb::par, data.begin(), data.end(), result.begin(), g);
+    });
+
+    ASSERT_EQUAL(result, reference);
+  }
+}
+DECLARE_UNITTEST(TestTbbShuffleThreadCountIndependent);
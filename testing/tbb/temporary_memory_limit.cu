@@ -0,0 +1,82 @@
+#include <unittest/unittest.h>
+
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+#include <thrust/system_error.h>
+#include <thrust/temporary_memory.h>
+
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+
+template <typename Sort>
+void TestTbbTemporaryMemoryLimit(Sort sort)
+{
+  const size_t n = 1 << 16;
+
+  thrust::host_vector<int> keys(n);
+  for(size_t i = 0; i < n; ++i)
+  {
+    keys[i] = static_cast<int>((i * 7919) % n);
+  }
+
+  // the leaves are sorted, and their scratch space allocated, by the worker
+  // threads; the limit has to reach them, and their exceptions the caller
+  for(int num_threads = 1; num_threads <= 8; num_threads *= 2)
+  {
+    tbb::global_control limit(tbb::global_control::max_allowed_parallelism, num_threads);
+    tbb::task_arena arena(num_threads);
+
+    thrust::host_vector<int> v(keys);
+    arena.execute([&] { sort(thrust::tbb::par(thrust::temporary_memory_limit(size_t(1) << 40)), v); });
+    for(size_t i = 0; i < n; ++i)
+    {
+      ASSERT_EQUAL(v[i], static_cast<int>(i));
+    }
+
+    v = keys;
+    bool thrown = false;
+    try
+    {
+      arena.execute([&] { sort(thrust::tbb::par(thrust::temporary_memory_limit(16)), v); });
+    }
+    catch(thrust::system_error &e)
+    {
+      thrown = true;
+      ASSERT_EQUAL(e.code().value(), int(thrust::system::errc::not_enough_memory));
+    }
+    ASSERT_EQUAL(thrown, true);
+  }
+
+  ASSERT_EQUAL(thrust::get_temporary_memory_stats().current_bytes, 0u);
+}
+
+struct stable_sort_functor
+{
+  template <typename Policy>
+  void operator()(Policy policy, thrust::host_vector<int> &v) const
+  {
+    thrust::stable_sort(policy, v.begin(), v.end());
+  }
+};
+
+struct stable_sort_by_key_functor
+{
+  template <typename Policy>
+  void operator()(Policy policy, thrust::host_vector<int> &v) const
+  {
+    thrust::host_vector<int> values(v);
+    thrust::stable_sort_by_key(policy, v.begin(), v.end(), values.begin());
+  }
+};
+
+void TestTbbTemporaryMemoryLimitStableSort(void)
+{
+  TestTbbTemporaryMemoryLimit(stable_sort_functor());
+}
+DECLARE_UNITTEST(TestTbbTemporaryMemoryLimitStableSort);
+
+void TestTbbTemporaryMemoryLimitStableSortByKey(void)
+{
+  TestTbbTemporaryMemoryLimit(stable_sort_by_key_functor());
+}
+DECLARE_UNITTEST(TestTbbTemporaryMemoryLimitStableSortByKey);
@@ -0,0 +1,85 @@
+#include <unittest/unittest.h>
+#include <thrust/temporary_memory.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+#include <thrust/system_error.h>
+
+#include <string>
+
+void TestTemporaryMemoryStatsSequentialSort()
+{
+  const int n = 1000;
+  thrust::host_vector<int> v(n);
+  for(int i = 0; i < n; ++i)
+  {
+    v[i] = (i * 7919) % n;
+  }
+
+  thrust::reset_temporary_memory_stats();
+  const size_t in_use = thrust::get_temporary_memory_stats().current_bytes;
+
+  thrust::stable_sort(thrust::seq, v.begin(), v.end());
+
+  // the sequential sort of integers sorts through a temporary copy of the keys, and returns it
+  thrust::temporary_memory_stats stats = thrust::get_temporary_memory_stats();
+  ASSERT_EQUAL(stats.current_bytes, in_use);
+  ASSERT_EQUAL(stats.peak_bytes >= in_use + n * sizeof(int), true);
+  ASSERT_EQUAL(stats.cumulative_bytes >= stats.peak_bytes - in_use, true);
+  ASSERT_EQUAL(stats.allocations > 0, true);
+
+  thrust::reset_temporary_memory_stats();
+  stats = thrust::get_temporary_memory_stats();
+  ASSERT_EQUAL(stats.peak_bytes, stats.current_bytes);
+  ASSERT_EQUAL(stats.cumulative_bytes, 0u);
+  ASSERT_EQUAL(stats.allocations, 0u);
+}
+DECLARE_UNITTEST(TestTemporaryMemoryStatsSequentialSort);
+
+
+template<typename Vector, typename Policy>
+void TestTemporaryMemoryLimit(Policy policy)
+{
+  typedef typename Vector::value_type T;
+
+  const size_t n = 1 << 16;
+  thrust::host_vector<T> h(n);
+  for(size_t i = 0; i < n; ++i)
+  {
+    h[i] = T((i * 7919) % n);
+  }
+  Vector v = h;
+
+  // a limit far above the needs of the sort does not change it
+  thrust::stable_sort(policy(thrust::temporary_memory_limit(size_t(1) << 40)), v.begin(), v.end());
+  thrust::sort(h.begin(), h.end());
+  ASSERT_EQUAL(v, h);
+
+  v = h;
+  bool thrown = false;
+  try
+  {
+    thrust::stable_sort(policy(thrust::temporary_memory_limit(16)), v.begin(), v.end());
+  }
+  catch(thrust::system_error &e)
+  {
+    thrown = true;
+    ASSERT_EQUAL(e.code().value(), int(thrust::system::errc::not_enough_memory));
+    ASSERT_EQUAL(std::string(e.what()).find("temporary memory limit") != std::string::npos, true);
+  }
+  ASSERT_EQUAL(thrown, true);
+
+  // the storage allocated before the exception has been returned
+  ASSERT_EQUAL(thrust::get_temporary_memory_stats().current_bytes, 0u);
+}
+
+void TestTemporaryMemoryLimitHost()
+{
+  TestTemporaryMemoryLimit<thrust::host_vector<int> >(thrust::host);
+}
+DECLARE_UNITTEST(TestTemporaryMemoryLimitHost);
+
+void TestTemporaryMemoryLimitDevice()
+{
+  TestTemporaryMemoryLimit<thrust::device_vector<int> >(thrust::device);
+}
+DECLARE_UNITTEST(TestTemporaryMemoryLimitDevice);
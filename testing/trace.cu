@@ -0,0 +1,247 @@
+#define THRUST_ENABLE_TRACING
+
+#include <unittest/unittest.h>
+#include <thrust/trace.h>
+#include <thrust/execution_policy.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+struct trace_recorder
+{
+  std::vector<thrust::trace::event> events;
+
+  static void record(const thrust::trace::event &e, void *user_data)
+  {
+    static_cast<trace_recorder *>(user_data)->events.push_back(e);
+  }
+
+  // the begin event of the first call of algorithm, or events.end()
+  std::vector<thrust::trace::event>::const_iterator find(const char *algorithm) const
+  {
+    for(std::vector<thrust::trace::event>::const_iterator i = events.begin(); i != events.end(); ++i)
+    {
+      if(i->phase == thrust::trace::phase::begin && std::strcmp(i->algorithm, algorithm) == 0)
+      {
+        return i;
+      }
+    }
+    return events.end();
+  }
+
+  // the end event matching the begin event at i
+  std::vector<thrust::trace::event>::const_iterator matching_end(std::vector<thrust::trace::event>::const_iterator i) const
+  {
+    int depth = 0;
+    for(; i != events.end(); ++i)
+    {
+      depth += i->phase == thrust::trace::phase::begin ? 1 : -1;
+      if(depth == 0)
+      {
+        return i;
+      }
+    }
+    return events.end();
+  }
+};
+
+
+void TestTraceEnabled()
+{
+  ASSERT_EQUAL(thrust::trace::enabled(), true);
+}
+DECLARE_UNITTEST(TestTraceEnabled);
+
+
+template<typename Vector>
+void TestTraceReduce()
+{
+  typedef typename Vector::value_type T;
+
+  Vector v(1000, T(1));
+
+  trace_recorder recorder;
+  thrust::trace::set_callback(&trace_recorder::record, &recorder);
+  ASSERT_EQUAL(thrust::trace::get_callback() == &trace_recorder::record, true);
+
+  T sum = thrust::reduce(v.begin(), v.end());
+
+  thrust::trace::set_callback(NULL);
+  ASSERT_EQUAL(sum, T(1000));
+
+  std::vector<thrust::trace::event>::const_iterator begin = recorder.find("reduce");
+  ASSERT_EQUAL(begin != recorder.events.end(), true);
+  ASSERT_EQUAL(begin->count, 1000u);
+  ASSERT_EQUAL(begin->value_size, sizeof(T));
+  ASSERT_EQUAL(std::strcmp(begin->backend, "unknown") != 0, true);
+
+  std::vector<thrust::trace::event>::const_iterator end = recorder.matching_end(begin);
+  ASSERT_EQUAL(end != recorder.events.end(), true);
+  ASSERT_EQUAL(std::strcmp(end->algorithm, "reduce"), 0);
+  ASSERT_EQUAL(end->thread, begin->thread);
+  ASSERT_EQUAL(end->timestamp >= begin->timestamp, true);
+
+  // nothing is recorded once the callback is unset
+  const size_t recorded = recorder.events.size();
+  thrust::reduce(v.begin(), v.end());
+  ASSERT_EQUAL(recorder.events.size(), recorded);
+}
+DECLARE_VECTOR_UNITTEST(TestTraceReduce);
+
+
+void TestTraceSequentialTemporaryBytes()
+{
+  const int n = 1000;
+  thrust::host_vector<int> v(n);
+  for(int i = 0; i < n; ++i)
+  {
+    v[i] = (i * 7919) % n;
+  }
+
+  trace_recorder recorder;
+  thrust::trace::set_callback(&trace_recorder::record, &recorder);
+
+  thrust::stable_sort(thrust::seq, v.begin(), v.end());
+
+  thrust::trace::set_callback(NULL);
+
+  std::vector<thrust::trace::event>::const_iterator begin = recorder.find("stable_sort");
+  ASSERT_EQUAL(begin != recorder.events.end(), true);
+  ASSERT_EQUAL(std::strcmp(begin->backend, "seq"), 0);
+  ASSERT_EQUAL(begin->temporary_bytes, 0u);
+
+  // the sequential sort of integers sorts through a temporary copy of the keys
+  std::vector<thrust::trace::event>::const_iterator end = recorder.matching_end(begin);
+  ASSERT_EQUAL(end != recorder.events.end(), true);
+  ASSERT_EQUAL(end->temporary_bytes >= n * sizeof(int), true);
+  ASSERT_EQUAL(end->peak_temporary_bytes >= n * sizeof(int), true);
+  ASSERT_EQUAL(end->peak_temporary_bytes <= end->temporary_bytes, true);
+}
+DECLARE_UNITTEST(TestTraceSequentialTemporaryBytes);
+
+
+void TestTraceCountN()
+{
+  thrust::host_vector<int> v(100);
+
+  trace_recorder recorder;
+  thrust::trace::set_callback(&trace_recorder::record, &recorder);
+
+  thrust::fill_n(thrust::host, v.begin(), 42, 7);
+
+  thrust::trace::set_callback(NULL);
+
+  std::vector<thrust::trace::event>::const_iterator begin = recorder.find("fill_n");
+  ASSERT_EQUAL(begin != recorder.events.end(), true);
+  ASSERT_EQUAL(begin->count, 42u);
+  ASSERT_EQUAL(begin->value_size, sizeof(int));
+}
+DECLARE_UNITTEST(TestTraceCountN);
+
+
+void TestTraceChromeWriter()
+{
+  const char *path = "thrust_test_trace.json";
+
+  {
+    thrust::trace::chrome_trace_writer writer(path);
+    ASSERT_EQUAL(writer.is_open(), true);
+    writer.install();
+
+    thrust::host_vector<int> v(100, 1);
+    thrust::reduce(thrust::host, v.begin(), v.end());
+  }
+
+  // the destructor uninstalled the writer
+  ASSERT_EQUAL(thrust::trace::get_callback() == NULL, true);
+
+  std::ifstream file(path);
+  std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  file.close();
+  std::remove(path);
+
+  ASSERT_EQUAL(contents.compare(0, 16, "{\"traceEvents\":["), 0);
+  ASSERT_EQUAL(contents.find("\"name\":\"reduce\"") != std::string::npos, true);
+  ASSERT_EQUAL(contents.find("\"ph\":\"B\"") != std::string::npos, true);
+  ASSERT_EQUAL(contents.find("\"ph\":\"E\"") != std::string::npos, true);
+  ASSERT_EQUAL(contents.find("\"count\":100") != std::string::npos, true);
+  ASSERT_EQUAL(contents.find("]") != std::string::npos, true);
+}
+DECLARE_UNITTEST(TestTraceChromeWriter);
+
+
+struct close_writer_functor
+{
+  thrust::trace::chrome_trace_writer *writer;
+
+  void operator()(int) const
+  {
+    writer->close();
+  }
+};
+
+size_t count_occurrences(const std::string &s, const std::string &pattern)
+{
+  size_t count = 0;
+  for(size_t i = s.find(pattern); i != std::string::npos; i = s.find(pattern, i + 1))
+  {
+    ++count;
+  }
+  return count;
+}
+
+std::string read_and_remove(const char *path)
+{
+  std::ifstream file(path);
+  std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  file.close();
+  std::remove(path);
+  return contents;
+}
+
+void TestTraceChromeWriterClosedDuringAlgorithm()
+{
+  const char *path = "thrust_test_trace_closed.json";
+
+  thrust::host_vector<int> v(10, 1);
+  {
+    thrust::trace::chrome_trace_writer writer(path);
+    writer.install();
+
+    // the writer is closed while for_each runs, and ends its slice
+    close_writer_functor f = {&writer};
+    thrust::for_each(thrust::host, v.begin(), v.end(), f);
+
+    ASSERT_EQUAL(writer.is_open(), false);
+  }
+  ASSERT_EQUAL(thrust::trace::get_callback() == NULL, true);
+
+  std::string contents = read_and_remove(path);
+  ASSERT_EQUAL(contents.find("\"name\":\"for_each\",\"cat\":\"cpp\",\"ph\":\"B\"") != std::string::npos, true);
+  ASSERT_EQUAL(contents.find("\"name\":\"for_each\",\"cat\":\"cpp\",\"ph\":\"E\"") != std::string::npos, true);
+  ASSERT_EQUAL(count_occurrences(contents, "\"ph\":\"B\""), count_occurrences(contents, "\"ph\":\"E\""));
+
+  // an end event whose begin event the writer did not see is dropped
+  {
+    thrust::trace::chrome_trace_writer writer(path);
+
+    thrust::trace::event e = {};
+    e.phase = thrust::trace::phase::end;
+    e.algorithm = "reduce";
+    e.backend = "cpp";
+    e.thread = 1;
+    writer.write(e);
+  }
+
+  contents = read_and_remove(path);
+  ASSERT_EQUAL(count_occurrences(contents, "\"ph\":\"E\""), 0u);
+}
+DECLARE_UNITTEST(TestTraceChromeWriterClosedDuringAlgorithm);
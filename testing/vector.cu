@@ -18,8 +18,10 @@
 #include <unittest/unittest.h>
 
 #include <thrust/detail/config.h>
+#include <thrust/fill.h>
 #include <thrust/sequence.h>
 #include <thrust/device_malloc_allocator.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
 
 #include <initializer_list>
 #include <vector>
@@ -653,6 +655,111 @@ void TestVectorResizing(void)
 }
 DECLARE_VECTOR_UNITTEST(TestVectorResizing);
 
+template <class Vector>
+void TestVectorNoInit(void)
+{
+    typedef typename Vector::value_type T;
+
+    Vector v(3, thrust::no_init);
+
+    ASSERT_EQUAL(v.size(), 3lu);
+
+    thrust::sequence(v.begin(), v.end());
+
+    // the old elements are kept, in place or after a reallocation
+    v.resize(4, thrust::no_init);
+    v.resize(100, thrust::no_init);
+
+    ASSERT_EQUAL(v.size(), 100lu);
+    ASSERT_EQUAL(v[0], T(0));
+    ASSERT_EQUAL(v[1], T(1));
+    ASSERT_EQUAL(v[2], T(2));
+
+    thrust::fill(v.begin() + 3, v.end(), T(7));
+    ASSERT_EQUAL(v[99], T(7));
+
+    v.resize(2, thrust::no_init);
+
+    ASSERT_EQUAL(v.size(), 2lu);
+    ASSERT_EQUAL(v[1], T(1));
+
+    Vector w(0, thrust::no_init, typename Vector::allocator_type());
+    ASSERT_EQUAL(w.size(), 0lu);
+}
+DECLARE_VECTOR_UNITTEST(TestVectorNoInit);
+
+struct default_forty_two
+{
+    int value;
+
+    default_forty_two() : value(42) {}
+};
+
+void TestVectorNoInitConstructsNonTrivialTypes(void)
+{
+    // elements with a default constructor that does something are still constructed
+    thrust::host_vector<default_forty_two> v(3, thrust::no_init);
+    ASSERT_EQUAL(v[2].value, 42);
+
+    v.resize(10, thrust::no_init);
+    ASSERT_EQUAL(v[9].value, 42);
+}
+DECLARE_UNITTEST(TestVectorNoInitConstructsNonTrivialTypes);
+
+// counts its copies; proclaimed trivially relocatable below, so vectors move it bitwise
+struct counted_copies
+{
+    int value;
+
+    counted_copies(int v = 0) : value(v) {}
+    counted_copies(const counted_copies &other) : value(other.value) { ++copies; }
+    counted_copies &operator=(const counted_copies &other) = default;
+
+    static int copies;
+};
+int counted_copies::copies = 0;
+
+THRUST_PROCLAIM_TRIVIALLY_RELOCATABLE(counted_copies)
+
+void TestVectorGrowthRelocatesElements(void)
+{
+    thrust::host_vector<counted_copies> v;
+    for(int i = 0; i < 100; ++i)
+    {
+        v.push_back(counted_copies(i));
+    }
+
+    // the elements are moved bitwise to the new storage, without copy constructors
+    counted_copies::copies = 0;
+    v.reserve(1000);
+    ASSERT_EQUAL(counted_copies::copies, 0);
+    ASSERT_EQUAL(v[99].value, 99);
+
+    v.resize(v.capacity());
+    ASSERT_EQUAL(v[99].value, 99);
+
+    // only the inserted elements are copied when an insertion needs new storage
+    counted_copies::copies = 0;
+    v.insert(v.begin() + 50, 10, counted_copies(-1));
+    ASSERT_LESS(counted_copies::copies, 100);
+    ASSERT_EQUAL(v[49].value, 49);
+    ASSERT_EQUAL(v[50].value, -1);
+    ASSERT_EQUAL(v[59].value, -1);
+    ASSERT_EQUAL(v[60].value, 50);
+    ASSERT_EQUAL(v[109].value, 99);
+
+    const int old_size = static_cast<int>(v.size());
+    thrust::host_vector<counted_copies> w(v.capacity(), counted_copies(-2));
+
+    counted_copies::copies = 0;
+    v.insert(v.begin(), w.begin(), w.end());
+    ASSERT_LESS(counted_copies::copies, static_cast<int>(w.size()) + old_size);
+    ASSERT_EQUAL(v[0].value, -2);
+    ASSERT_EQUAL(v[w.size()].value, 0);
+    ASSERT_EQUAL(v[w.size() + 109].value, 99);
+}
+DECLARE_UNITTEST(TestVectorGrowthRelocatesElements);
+
 
 
 template <class Vector>
@@ -20,6 +20,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/adjacent_difference.h>
 #include <thrust/system/detail/adl/adjacent_difference.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -30,6 +31,7 @@ OutputIterator adjacent_difference(const thrust::detail::execution_policy_base<D
                                    InputIterator first, InputIterator last,
                                    OutputIterator result)
 {
+  THRUST_TRACE_ALGORITHM("adjacent_difference", exec, first, last);
   using thrust::system::detail::generic::adjacent_difference;
 
   return adjacent_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
@@ -44,6 +46,7 @@ OutputIterator adjacent_difference(const thrust::detail::execution_policy_base<D
                                    OutputIterator result,
                                    BinaryFunction binary_op)
 {
+  THRUST_TRACE_ALGORITHM("adjacent_difference", exec, first, last);
   using thrust::system::detail::generic::adjacent_difference;
 
   return adjacent_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, binary_op);
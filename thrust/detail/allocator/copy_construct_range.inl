@@ -200,6 +200,80 @@ THRUST_HOST_DEVICE
 } // end uninitialized_copy_with_allocator_n()
 
 
+// when the allocator's system can read the input of the source system, as the parallel
+// host systems can read that of the sequential one, the copy runs on the allocator's
+// system, so that the new elements are first touched by the threads that will process
+// them, and their pages are spread across the NUMA nodes of these threads
+template<typename FromSystem, typename ToSystem, typename InputIterator, typename Pointer>
+THRUST_HOST_DEVICE
+  typename enable_if_convertible<
+    ToSystem,
+    FromSystem,
+    Pointer
+  >::type
+    trivial_copy_construct_range(const thrust::execution_policy<FromSystem> &,
+                                 const thrust::execution_policy<ToSystem> &to_system,
+                                 InputIterator first,
+                                 InputIterator last,
+                                 Pointer result)
+{
+  return thrust::copy(to_system, first, last, result);
+}
+
+
+template<typename FromSystem, typename ToSystem, typename InputIterator, typename Size, typename Pointer>
+THRUST_HOST_DEVICE
+  typename enable_if_convertible<
+    ToSystem,
+    FromSystem,
+    Pointer
+  >::type
+    trivial_copy_construct_range_n(const thrust::execution_policy<FromSystem> &,
+                                   const thrust::execution_policy<ToSystem> &to_system,
+                                   InputIterator first,
+                                   Size n,
+                                   Pointer result)
+{
+  return thrust::copy_n(to_system, first, n, result);
+}
+
+
+template<typename FromSystem, typename ToSystem, typename InputIterator, typename Pointer>
+THRUST_HOST_DEVICE
+  typename disable_if_convertible<
+    ToSystem,
+    FromSystem,
+    Pointer
+  >::type
+    trivial_copy_construct_range(const thrust::execution_policy<FromSystem> &from_system,
+                                 const thrust::execution_policy<ToSystem> &to_system,
+                                 InputIterator first,
+                                 InputIterator last,
+                                 Pointer result)
+{
+  // just call two_system_copy
+  return thrust::detail::two_system_copy(from_system, to_system, first, last, result);
+}
+
+
+template<typename FromSystem, typename ToSystem, typename InputIterator, typename Size, typename Pointer>
+THRUST_HOST_DEVICE
+  typename disable_if_convertible<
+    ToSystem,
+    FromSystem,
+    Pointer
+  >::type
+    trivial_copy_construct_range_n(const thrust::execution_policy<FromSystem> &from_system,
+                                   const thrust::execution_policy<ToSystem> &to_system,
+                                   InputIterator first,
+                                   Size n,
+                                   Pointer result)
+{
+  // just call two_system_copy_n
+  return thrust::detail::two_system_copy_n(from_system, to_system, first, n, result);
+}
+
+
 template<typename FromSystem, typename Allocator, typename InputIterator, typename Pointer>
 THRUST_HOST_DEVICE
   typename disable_if<
@@ -215,8 +289,7 @@ THRUST_HOST_DEVICE
                          InputIterator last,
                          Pointer result)
 {
-  // just call two_system_copy
-  return thrust::detail::two_system_copy(from_system, allocator_system<Allocator>::get(a), first, last, result);
+  return trivial_copy_construct_range(from_system, allocator_system<Allocator>::get(a), first, last, result);
 }
 
 
@@ -235,8 +308,7 @@ THRUST_HOST_DEVICE
                            Size n,
                            Pointer result)
 {
-  // just call two_system_copy_n
-  return thrust::detail::two_system_copy_n(from_system, allocator_system<Allocator>::get(a), first, n, result);
+  return trivial_copy_construct_range_n(from_system, allocator_system<Allocator>::get(a), first, n, result);
 }
 
 
@@ -28,6 +28,12 @@ THRUST_HOST_DEVICE
 inline void default_construct_range(Allocator &a, Pointer p, Size n);
 
 
+// like default_construct_range, but leaves trivially constructible elements uninitialized
+template<typename Allocator, typename Pointer, typename Size>
+THRUST_HOST_DEVICE
+inline void default_init_range(Allocator &a, Pointer p, Size n);
+
+
 } // end detail
 THRUST_NAMESPACE_END
 
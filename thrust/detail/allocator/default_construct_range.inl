@@ -96,6 +96,34 @@ THRUST_HOST_DEVICE
 }
 
 
+template<typename Allocator, typename Pointer, typename Size>
+THRUST_HOST_DEVICE
+  typename enable_if<
+    needs_default_construct_via_allocator<
+      Allocator,
+      typename pointer_element<Pointer>::type
+    >::value
+  >::type
+    default_init_range(Allocator &a, Pointer p, Size n)
+{
+  default_construct_range(a, p, n);
+}
+
+
+// neither the allocator nor T's default constructor does anything, so there's nothing to do
+template<typename Allocator, typename Pointer, typename Size>
+THRUST_HOST_DEVICE
+  typename disable_if<
+    needs_default_construct_via_allocator<
+      Allocator,
+      typename pointer_element<Pointer>::type
+    >::value
+  >::type
+    default_init_range(Allocator &, Pointer, Size)
+{
+}
+
+
 } // end allocator_traits_detail
 
 
@@ -107,6 +135,14 @@ THRUST_HOST_DEVICE
 }
 
 
+template<typename Allocator, typename Pointer, typename Size>
+THRUST_HOST_DEVICE
+  void default_init_range(Allocator &a, Pointer p, Size n)
+{
+  return allocator_traits_detail::default_init_range(a,p,n);
+}
+
+
 } // end detail
 THRUST_NAMESPACE_END
 
@@ -0,0 +1,42 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+// bitwise copies [p, p + n) into the uninitialized storage at result, leaving the source
+// storage without live elements; only valid when is_trivially_relocatable_with_allocator holds
+template<typename Allocator, typename Pointer, typename Size>
+THRUST_HOST_DEVICE
+  inline void relocate_range(Allocator &a, Pointer p, Size n, Pointer result);
+
+// resizes the storage at p without copying it, when the allocator is able to; returns a
+// null pointer, leaving p untouched, otherwise
+template<typename Allocator, typename Pointer, typename Size>
+THRUST_HOST
+  inline Pointer reallocate(Allocator &a, Pointer p, Size old_n, Size new_n);
+
+} // end detail
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/allocator/relocate_range.inl>
+
@@ -0,0 +1,132 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/allocator/relocate_range.h>
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/allocator/destroy_range.h>
+#include <thrust/detail/allocator/fill_construct_range.h>
+#include <thrust/detail/type_traits/is_call_possible.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/detail/copy.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+namespace allocator_traits_detail
+{
+
+
+// the elements of an allocation can be moved to another one with a bitwise copy when
+// T is trivially relocatable and the allocator neither constructs nor destroys them itself
+template<typename Allocator, typename T>
+  struct is_trivially_relocatable_with_allocator
+    : integral_constant<
+        bool,
+        is_trivially_relocatable<T>::value &&
+        !has_effectful_member_construct2<Allocator,T,T>::value &&
+        !has_effectful_member_destroy<Allocator,T>::value
+      >
+{};
+
+
+// the bytes of an element, copied in place of it so that no constructor or
+// assignment operator of T is invoked
+template<std::size_t Size, std::size_t Alignment>
+  struct relocation_unit
+{
+  alignas(Alignment) unsigned char bytes[Size];
+};
+
+
+template<typename Allocator, typename Pointer, typename Size>
+THRUST_HOST_DEVICE
+  void relocate_range(Allocator &a, Pointer p, Size n, Pointer result)
+{
+  typedef typename pointer_element<Pointer>::type                        value_type;
+  typedef relocation_unit<sizeof(value_type), alignof(value_type)>        unit;
+  typedef typename pointer_traits<Pointer>::template rebind<unit>::other unit_pointer;
+
+  thrust::copy_n(allocator_system<Allocator>::get(a),
+                 unit_pointer(reinterpret_cast<unit*>(pointer_traits<Pointer>::get(p))),
+                 n,
+                 unit_pointer(reinterpret_cast<unit*>(pointer_traits<Pointer>::get(result))));
+}
+
+
+__THRUST_DEFINE_IS_CALL_POSSIBLE(has_member_reallocate_impl, reallocate)
+
+template<typename Allocator, typename Pointer, typename Size>
+  struct has_member_reallocate
+    : has_member_reallocate_impl<Allocator, Pointer(Pointer,Size,Size)>
+{};
+
+template<typename Allocator, typename Pointer, typename Size>
+THRUST_HOST
+  typename enable_if<
+    has_member_reallocate<Allocator,Pointer,Size>::value,
+    Pointer
+  >::type
+    reallocate(Allocator &a, Pointer p, Size old_n, Size new_n)
+{
+  return a.reallocate(p, old_n, new_n);
+}
+
+template<typename Allocator, typename Pointer, typename Size>
+THRUST_HOST
+  typename disable_if<
+    has_member_reallocate<Allocator,Pointer,Size>::value,
+    Pointer
+  >::type
+    reallocate(Allocator &, Pointer, Size, Size)
+{
+  return Pointer();
+}
+
+
+} // end allocator_traits_detail
+
+
+template<typename Allocator, typename T>
+  struct is_trivially_relocatable_with_allocator
+    : allocator_traits_detail::is_trivially_relocatable_with_allocator<Allocator,T>
+{};
+
+
+template<typename Allocator, typename Pointer, typename Size>
+THRUST_HOST_DEVICE
+  void relocate_range(Allocator &a, Pointer p, Size n, Pointer result)
+{
+  allocator_traits_detail::relocate_range(a, p, n, result);
+}
+
+
+template<typename Allocator, typename Pointer, typename Size>
+THRUST_HOST
+  Pointer reallocate(Allocator &a, Pointer p, Size old_n, Size new_n)
+{
+  return allocator_traits_detail::reallocate(a, p, old_n, new_n);
+}
+
+
+} // end detail
+THRUST_NAMESPACE_END
+
@@ -18,6 +18,8 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/detail/execute_with_allocator_fwd.h>
+#include <thrust/detail/execute_with_temporary_memory_limit_fwd.h>
+#include <thrust/temporary_memory.h>
 #include <thrust/detail/alignment.h>
 
 #include <type_traits>
@@ -90,6 +92,13 @@ struct allocator_aware_execution_policy
   {
     return typename execute_with_allocator_type<Allocator>::type(std::move(alloc));
   }
+
+  // taken by value, so that it is preferred over the allocator overloads
+  execute_with_temporary_memory_limit<ExecutionPolicyCRTPBase>
+    operator()(thrust::temporary_memory_limit limit) const
+  {
+    return execute_with_temporary_memory_limit<ExecutionPolicyCRTPBase>(limit.bytes);
+  }
 };
 
 } // end namespace detail
@@ -22,6 +22,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/binary_search.h>
 #include <thrust/system/detail/adl/binary_search.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -33,6 +34,7 @@ ForwardIterator lower_bound(const thrust::detail::execution_policy_base<DerivedP
                             ForwardIterator last,
                             const LessThanComparable &value)
 {
+  THRUST_TRACE_ALGORITHM("lower_bound", exec, first, last);
     using thrust::system::detail::generic::lower_bound;
     return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -47,6 +49,7 @@ ForwardIterator lower_bound(const thrust::detail::execution_policy_base<DerivedP
                             const T &value,
                             StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM("lower_bound", exec, first, last);
     using thrust::system::detail::generic::lower_bound;
     return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -60,6 +63,7 @@ ForwardIterator upper_bound(const thrust::detail::execution_policy_base<DerivedP
                             ForwardIterator last,
                             const LessThanComparable &value)
 {
+  THRUST_TRACE_ALGORITHM("upper_bound", exec, first, last);
     using thrust::system::detail::generic::upper_bound;
     return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -74,6 +78,7 @@ ForwardIterator upper_bound(const thrust::detail::execution_policy_base<DerivedP
                             const T &value,
                             StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM("upper_bound", exec, first, last);
     using thrust::system::detail::generic::upper_bound;
     return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -87,6 +92,7 @@ bool binary_search(const thrust::detail::execution_policy_base<DerivedPolicy> &e
                    ForwardIterator last,
                    const LessThanComparable& value)
 {
+  THRUST_TRACE_ALGORITHM("binary_search", exec, first, last);
     using thrust::system::detail::generic::binary_search;
     return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -101,6 +107,7 @@ bool binary_search(const thrust::detail::execution_policy_base<DerivedPolicy> &e
                    const T& value,
                    StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM("binary_search", exec, first, last);
     using thrust::system::detail::generic::binary_search;
     return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -116,6 +123,7 @@ equal_range(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
             const T& value,
             StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM("equal_range", exec, first, last);
     using thrust::system::detail::generic::equal_range;
     return equal_range(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -130,6 +138,7 @@ equal_range(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
             ForwardIterator last,
             const LessThanComparable& value)
 {
+  THRUST_TRACE_ALGORITHM("equal_range", exec, first, last);
     using thrust::system::detail::generic::equal_range;
     return equal_range(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -145,6 +154,7 @@ OutputIterator lower_bound(const thrust::detail::execution_policy_base<DerivedPo
                            InputIterator values_last,
                            OutputIterator output)
 {
+  THRUST_TRACE_ALGORITHM("lower_bound", exec, first, last);
     using thrust::system::detail::generic::lower_bound;
     return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
 }
@@ -161,6 +171,7 @@ OutputIterator lower_bound(const thrust::detail::execution_policy_base<DerivedPo
                            OutputIterator output,
                            StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM("lower_bound", exec, first, last);
     using thrust::system::detail::generic::lower_bound;
     return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output, comp);
 }
@@ -176,6 +187,7 @@ OutputIterator upper_bound(const thrust::detail::execution_policy_base<DerivedPo
                            InputIterator values_last,
                            OutputIterator output)
 {
+  THRUST_TRACE_ALGORITHM("upper_bound", exec, first, last);
     using thrust::system::detail::generic::upper_bound;
     return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
 }
@@ -192,6 +204,7 @@ OutputIterator upper_bound(const thrust::detail::execution_policy_base<DerivedPo
                            OutputIterator output,
                            StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM("upper_bound", exec, first, last);
     using thrust::system::detail::generic::upper_bound;
     return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output, comp);
 }
@@ -207,6 +220,7 @@ OutputIterator binary_search(const thrust::detail::execution_policy_base<Derived
                              InputIterator values_last,
                              OutputIterator output)
 {
+  THRUST_TRACE_ALGORITHM("binary_search", exec, first, last);
     using thrust::system::detail::generic::binary_search;
     return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
 }
@@ -223,6 +237,7 @@ OutputIterator binary_search(const thrust::detail::execution_policy_base<Derived
                              OutputIterator output,
                              StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM("binary_search", exec, first, last);
     using thrust::system::detail::generic::binary_search;
     return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output, comp);
 }
@@ -20,9 +20,11 @@
 
 #pragma once
 
-#if !defined(__HIP__)
+#if !defined(__HIP__) && defined(__has_include)
+#if __has_include(<cuda/__cccl_config>)
 // For _CCCL_IMPLICIT_SYSTEM_HEADER
 #include <cuda/__cccl_config>
+#endif // __has_include(<cuda/__cccl_config>)
 #endif
 
 // NOTE: The order of these #includes matters.
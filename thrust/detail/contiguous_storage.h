@@ -113,9 +113,18 @@ template<typename T, typename Alloc>
     THRUST_HOST_DEVICE
     void swap(contiguous_storage &x);
 
+    // resizes the storage without copying it, when the allocator is able to; returns
+    // whether it did. Note that the elements are neither constructed nor destroyed
+    THRUST_HOST
+    bool reallocate(size_type n);
+
     THRUST_HOST_DEVICE
     void default_construct_n(iterator first, size_type n);
 
+    // leaves trivially constructible elements uninitialized
+    THRUST_HOST_DEVICE
+    void default_init_n(iterator first, size_type n);
+
     THRUST_HOST_DEVICE
     void uninitialized_fill_n(iterator first, size_type n, const value_type &value);
 
@@ -144,6 +153,11 @@ template<typename T, typename Alloc>
     THRUST_HOST_DEVICE
     void destroy(iterator first, iterator last);
 
+    // bitwise copies the elements to uninitialized storage, which then holds them instead
+    // of [first, last); only valid for trivially relocatable elements
+    THRUST_HOST_DEVICE
+    void relocate(iterator first, iterator last, iterator result);
+
     THRUST_HOST_DEVICE
     void deallocate_on_allocator_mismatch(const contiguous_storage &other);
 
@@ -25,6 +25,7 @@
 #include <thrust/detail/allocator/default_construct_range.h>
 #include <thrust/detail/allocator/destroy_range.h>
 #include <thrust/detail/allocator/fill_construct_range.h>
+#include <thrust/detail/allocator/relocate_range.h>
 
 #include <thrust/detail/nv_target.h>
 
@@ -249,6 +250,27 @@ THRUST_HOST_DEVICE
   thrust::swap(m_allocator, x.m_allocator);
 } // end contiguous_storage::swap()
 
+template<typename T, typename Alloc>
+THRUST_HOST
+  bool contiguous_storage<T,Alloc>
+    ::reallocate(size_type n)
+{
+  if(size() == 0 || n == 0)
+  {
+    return false;
+  } // end if
+
+  pointer p = thrust::detail::reallocate(m_allocator, m_begin.base(), size(), n);
+  if(pointer_traits<pointer>::get(p) == 0)
+  {
+    return false;
+  } // end if
+
+  m_begin = iterator(p);
+  m_size = n;
+  return true;
+} // end contiguous_storage::reallocate()
+
 template<typename T, typename Alloc>
 THRUST_HOST_DEVICE
   void contiguous_storage<T,Alloc>
@@ -257,6 +279,14 @@ THRUST_HOST_DEVICE
   default_construct_range(m_allocator, first.base(), n);
 } // end contiguous_storage::default_construct_n()
 
+template<typename T, typename Alloc>
+THRUST_HOST_DEVICE
+  void contiguous_storage<T,Alloc>
+    ::default_init_n(iterator first, size_type n)
+{
+  default_init_range(m_allocator, first.base(), n);
+} // end contiguous_storage::default_init_n()
+
 template<typename T, typename Alloc>
 THRUST_HOST_DEVICE
   void contiguous_storage<T,Alloc>
@@ -319,6 +349,14 @@ THRUST_HOST_DEVICE
   destroy_range(m_allocator, first.base(), last - first);
 } // end contiguous_storage::destroy()
 
+template<typename T, typename Alloc>
+THRUST_HOST_DEVICE
+  void contiguous_storage<T,Alloc>
+    ::relocate(iterator first, iterator last, iterator result)
+{
+  relocate_range(m_allocator, first.base(), last - first, result.base());
+} // end contiguous_storage::relocate()
+
 template<typename T, typename Alloc>
 THRUST_HOST_DEVICE
   void contiguous_storage<T,Alloc>
@@ -21,6 +21,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/system/detail/adl/copy.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -32,6 +33,7 @@ THRUST_HOST_DEVICE
                       InputIterator last,
                       OutputIterator result)
 {
+  THRUST_TRACE_ALGORITHM("copy", exec, first, last);
   using thrust::system::detail::generic::copy;
   return copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end copy()
@@ -45,6 +47,7 @@ THRUST_HOST_DEVICE
                         Size n,
                         OutputIterator result)
 {
+  THRUST_TRACE_ALGORITHM_N("copy_n", exec, first, n);
   using thrust::system::detail::generic::copy_n;
   return copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, result);
 } // end copy_n()
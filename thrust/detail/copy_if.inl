@@ -22,6 +22,7 @@
 #include <thrust/system/detail/generic/copy_if.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/adl/copy_if.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -37,6 +38,7 @@ THRUST_HOST_DEVICE
                          OutputIterator result,
                          Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("copy_if", exec, first, last);
   using thrust::system::detail::generic::copy_if;
   return copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred);
 } // end copy_if()
@@ -56,6 +58,7 @@ THRUST_HOST_DEVICE
                          OutputIterator result,
                          Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("copy_if", exec, first, last);
   using thrust::system::detail::generic::copy_if;
   return copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred);
 } // end copy_if()
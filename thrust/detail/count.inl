@@ -22,6 +22,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/count.h>
 #include <thrust/system/detail/adl/count.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -31,6 +32,7 @@ THRUST_HOST_DEVICE
   typename thrust::iterator_traits<InputIterator>::difference_type
     count(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, InputIterator first, InputIterator last, const EqualityComparable& value)
 {
+  THRUST_TRACE_ALGORITHM("count", exec, first, last);
   using thrust::system::detail::generic::count;
   return count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end count()
@@ -42,6 +44,7 @@ THRUST_HOST_DEVICE
   typename thrust::iterator_traits<InputIterator>::difference_type
     count_if(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, InputIterator first, InputIterator last, Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("count_if", exec, first, last);
   using thrust::system::detail::generic::count_if;
   return count_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end count_if()
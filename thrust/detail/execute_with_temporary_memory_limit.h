@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/execute_with_temporary_memory_limit_fwd.h>
+#include <thrust/detail/pointer.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/generic/temporary_buffer.h>
+#include <thrust/system/system_error.h>
+#include <thrust/system/error_code.h>
+#include <thrust/temporary_memory.h>
+
+#include <string>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+template <
+    typename T
+  , template <typename> class BaseSystem
+>
+THRUST_HOST
+thrust::pair<
+    thrust::pointer<T, execute_with_temporary_memory_limit<BaseSystem> >
+  , typename thrust::pointer<T, execute_with_temporary_memory_limit<BaseSystem> >::difference_type
+>
+get_temporary_buffer(
+    thrust::detail::execute_with_temporary_memory_limit<BaseSystem>& system
+  , std::ptrdiff_t n
+    )
+{
+  const std::size_t bytes = sizeof(T) * static_cast<std::size_t>(n);
+  const std::size_t limit = system.get_temporary_memory_limit();
+
+  bool reserved = false;
+  const std::size_t in_use = system.try_reserve(bytes, reserved);
+
+  if (!reserved)
+  {
+    throw thrust::system_error(
+      thrust::system::errc::not_enough_memory,
+      thrust::generic_category(),
+      "get_temporary_buffer: allocating " + std::to_string(bytes) + " bytes of temporary storage with "
+        + std::to_string(in_use) + " bytes in use exceeds the temporary memory limit of "
+        + std::to_string(limit) + " bytes");
+  }
+
+  // allocate as the base system would
+  thrust::execution_policy<execute_with_temporary_memory_limit<BaseSystem> >& base = system;
+  thrust::pair<
+      thrust::pointer<T, execute_with_temporary_memory_limit<BaseSystem> >
+    , typename thrust::pointer<T, execute_with_temporary_memory_limit<BaseSystem> >::difference_type
+  > result = thrust::system::detail::generic::get_temporary_buffer<T>(base, n);
+
+  // a failed allocation returns a size of 0, and is not charged
+  if (result.second == 0)
+  {
+    system.release(bytes);
+  }
+
+  return result;
+}
+
+template <
+    template <typename> class BaseSystem
+  , typename Pointer
+>
+THRUST_HOST
+void
+return_temporary_buffer(
+    thrust::detail::execute_with_temporary_memory_limit<BaseSystem>& system
+  , Pointer p
+  , std::ptrdiff_t n
+    )
+{
+  typedef typename thrust::detail::pointer_traits<Pointer>::element_type T;
+
+  if (thrust::raw_pointer_cast(p) && n > 0)
+  {
+    system.release(static_cast<std::size_t>(n) * thrust::detail::temporary_element_size<T>::value);
+  }
+
+  thrust::execution_policy<execute_with_temporary_memory_limit<BaseSystem> >& base = system;
+  thrust::system::detail::generic::return_temporary_buffer(base, p, n);
+}
+
+} // namespace detail
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,80 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+template <template <typename> class BaseSystem>
+struct execute_with_temporary_memory_limit
+  : BaseSystem<execute_with_temporary_memory_limit<BaseSystem> >
+{
+private:
+  std::size_t limit;
+
+  // shared by the copies of the policy, and charged by every thread allocating through it
+  std::shared_ptr<std::atomic<std::size_t> > in_use;
+
+public:
+  THRUST_HOST
+  execute_with_temporary_memory_limit(std::size_t limit_)
+    : limit(limit_), in_use(std::make_shared<std::atomic<std::size_t> >(0))
+  {}
+
+  THRUST_HOST
+  std::size_t get_temporary_memory_limit() const { return limit; }
+
+  THRUST_HOST
+  std::size_t get_temporary_memory_in_use() const { return in_use->load(std::memory_order_relaxed); }
+
+  // Adds bytes to the storage in use, unless that would bring it above the
+  // limit. Returns the storage in use before the call either way.
+  THRUST_HOST
+  std::size_t try_reserve(std::size_t bytes, bool& reserved)
+  {
+    std::size_t current = in_use->load(std::memory_order_relaxed);
+    do
+    {
+      if (bytes > limit || current > limit - bytes)
+      {
+        reserved = false;
+        return current;
+      }
+    } while (!in_use->compare_exchange_weak(current, current + bytes, std::memory_order_relaxed));
+
+    reserved = true;
+    return current;
+  }
+
+  THRUST_HOST
+  void release(std::size_t bytes)
+  {
+    in_use->fetch_sub(bytes, std::memory_order_relaxed);
+  }
+};
+
+} // namespace detail
+
+THRUST_NAMESPACE_END
@@ -23,6 +23,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/fill.h>
 #include <thrust/system/detail/adl/fill.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -34,6 +35,7 @@ THRUST_HOST_DEVICE
             ForwardIterator last,
             const T &value)
 {
+  THRUST_TRACE_ALGORITHM("fill", exec, first, last);
   using thrust::system::detail::generic::fill;
   return fill(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end fill()
@@ -47,6 +49,7 @@ THRUST_HOST_DEVICE
                         Size n,
                         const T &value)
 {
+  THRUST_TRACE_ALGORITHM_N("fill_n", exec, first, n);
   using thrust::system::detail::generic::fill_n;
   return fill_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, value);
 } // end fill_n()
@@ -21,6 +21,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/find.h>
 #include <thrust/system/detail/adl/find.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -32,6 +33,7 @@ InputIterator find(const thrust::detail::execution_policy_base<DerivedPolicy> &e
                    InputIterator last,
                    const T& value)
 {
+  THRUST_TRACE_ALGORITHM("find", exec, first, last);
   using thrust::system::detail::generic::find;
   return find(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end find()
@@ -45,6 +47,7 @@ InputIterator find_if(const thrust::detail::execution_policy_base<DerivedPolicy>
                       InputIterator last,
                       Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("find_if", exec, first, last);
   using thrust::system::detail::generic::find_if;
   return find_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end find_if()
@@ -58,6 +61,7 @@ InputIterator find_if_not(const thrust::detail::execution_policy_base<DerivedPol
                           InputIterator last,
                           Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("find_if_not", exec, first, last);
   using thrust::system::detail::generic::find_if_not;
   return find_if_not(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end find_if_not()
@@ -22,6 +22,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/for_each.h>
 #include <thrust/system/detail/adl/for_each.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -35,6 +36,7 @@ THRUST_HOST_DEVICE
                          InputIterator last,
                          UnaryFunction f)
 {
+  THRUST_TRACE_ALGORITHM("for_each", exec, first, last);
   using thrust::system::detail::generic::for_each;
 
   return for_each(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, f);
@@ -62,6 +64,7 @@ THRUST_HOST_DEVICE
                            Size n,
                            UnaryFunction f)
 {
+  THRUST_TRACE_ALGORITHM_N("for_each_n", exec, first, n);
   using thrust::system::detail::generic::for_each_n;
 
   return for_each_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, f);
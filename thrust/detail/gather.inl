@@ -23,6 +23,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/gather.h>
 #include <thrust/system/detail/adl/gather.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -38,6 +39,7 @@ THRUST_HOST_DEVICE
                         RandomAccessIterator                                        input_first,
                         OutputIterator                                              result)
 {
+  THRUST_TRACE_ALGORITHM("gather", exec, map_first, map_last);
   using thrust::system::detail::generic::gather;
   return gather(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, input_first, result);
 } // end gather()
@@ -57,6 +59,7 @@ THRUST_HOST_DEVICE
                            RandomAccessIterator                                        input_first,
                            OutputIterator                                              result)
 {
+  THRUST_TRACE_ALGORITHM("gather_if", exec, map_first, map_last);
   using thrust::system::detail::generic::gather_if;
   return gather_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, stencil, input_first, result);
 } // end gather_if()
@@ -78,6 +81,7 @@ THRUST_HOST_DEVICE
                            OutputIterator                                              result,
                            Predicate                                                   pred)
 {
+  THRUST_TRACE_ALGORITHM("gather_if", exec, map_first, map_last);
   using thrust::system::detail::generic::gather_if;
   return gather_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, stencil, input_first, result, pred);
 } // end gather_if()
@@ -23,6 +23,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/generate.h>
 #include <thrust/system/detail/adl/generate.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -36,6 +37,7 @@ THRUST_HOST_DEVICE
                 ForwardIterator last,
                 Generator gen)
 {
+  THRUST_TRACE_ALGORITHM("generate", exec, first, last);
   using thrust::system::detail::generic::generate;
   return generate(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, gen);
 } // end generate()
@@ -52,6 +54,7 @@ THRUST_HOST_DEVICE
                             Size n,
                             Generator gen)
 {
+  THRUST_TRACE_ALGORITHM_N("generate_n", exec, first, n);
   using thrust::system::detail::generic::generate_n;
   return generate_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, gen);
 } // end generate_n()
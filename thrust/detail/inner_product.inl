@@ -22,6 +22,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/inner_product.h>
 #include <thrust/system/detail/adl/inner_product.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -37,6 +38,7 @@ OutputType inner_product(const thrust::detail::execution_policy_base<DerivedPoli
                          InputIterator2 first2,
                          OutputType init)
 {
+  THRUST_TRACE_ALGORITHM("inner_product", exec, first1, last1);
   using thrust::system::detail::generic::inner_product;
   return inner_product(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, init);
 } // end inner_product()
@@ -58,6 +60,7 @@ OutputType inner_product(const thrust::detail::execution_policy_base<DerivedPoli
                          BinaryFunction1 binary_op1,
                          BinaryFunction2 binary_op2)
 {
+  THRUST_TRACE_ALGORITHM("inner_product", exec, first1, last1);
   using thrust::system::detail::generic::inner_product;
   return inner_product(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, init, binary_op1, binary_op2);
 } // end inner_product()
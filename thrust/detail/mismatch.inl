@@ -22,6 +22,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/mismatch.h>
 #include <thrust/system/detail/adl/mismatch.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -33,6 +34,7 @@ thrust::pair<InputIterator1, InputIterator2> mismatch(const thrust::detail::exec
                                                       InputIterator1 last1,
                                                       InputIterator2 first2)
 {
+  THRUST_TRACE_ALGORITHM("mismatch", exec, first1, last1);
   using thrust::system::detail::generic::mismatch;
   return mismatch(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2);
 } // end mismatch()
@@ -47,6 +49,7 @@ thrust::pair<InputIterator1, InputIterator2> mismatch(const thrust::detail::exec
                                                       InputIterator2 first2,
                                                       BinaryPredicate pred)
 {
+  THRUST_TRACE_ALGORITHM("mismatch", exec, first1, last1);
   using thrust::system::detail::generic::mismatch;
   return mismatch(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, pred);
 } // end mismatch()
@@ -0,0 +1,60 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A tag for creating or growing vectors without initializing their new elements.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup containers Containers
+ *  \{
+ */
+
+/*! The type of \p thrust::no_init.
+ */
+struct no_init_t
+{
+};
+
+/*! A tag passed to the constructors and to \p resize of the vectors to leave
+ *  their new elements uninitialized, when the element type is trivially
+ *  default constructible and the allocator doesn't construct elements itself.
+ *  Other elements are default constructed as usual. This saves a full pass
+ *  over the memory when the elements are about to be overwritten, such as the
+ *  output of \p thrust::transform.
+ *
+ *  \code
+ *  #include <thrust/device_vector.h>
+ *  #include <thrust/transform.h>
+ *  ...
+ *  thrust::device_vector<float> x(n, 1.0f);
+ *
+ *  // the elements of y are not zeroed first
+ *  thrust::device_vector<float> y(n, thrust::no_init);
+ *  thrust::transform(x.begin(), x.end(), y.begin(), thrust::negate<float>());
+ *  \endcode
+ */
+THRUST_INLINE_CONSTANT no_init_t no_init{};
+
+/*! \} // containers
+ */
+
+THRUST_NAMESPACE_END
@@ -22,6 +22,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/partition.h>
 #include <thrust/system/detail/adl/partition.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -35,6 +36,7 @@ THRUST_HOST_DEVICE
                             ForwardIterator last,
                             Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("partition", exec, first, last);
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end partition()
@@ -52,6 +54,7 @@ THRUST_HOST_DEVICE
                             InputIterator stencil,
                             Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("partition", exec, first, last);
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end partition()
@@ -72,6 +75,7 @@ THRUST_HOST_DEVICE
                    OutputIterator2 out_false,
                    Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("partition_copy", exec, first, last);
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
 } // end partition_copy()
@@ -94,6 +98,7 @@ THRUST_HOST_DEVICE
                    OutputIterator2 out_false,
                    Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("partition_copy", exec, first, last);
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
 } // end partition_copy()
@@ -109,6 +114,7 @@ THRUST_HOST_DEVICE
                                    ForwardIterator last,
                                    Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("stable_partition", exec, first, last);
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end stable_partition()
@@ -126,6 +132,7 @@ THRUST_HOST_DEVICE
                                    InputIterator stencil,
                                    Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("stable_partition", exec, first, last);
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end stable_partition()
@@ -146,6 +153,7 @@ THRUST_HOST_DEVICE
                           OutputIterator2 out_false,
                           Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("stable_partition_copy", exec, first, last);
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
 } // end stable_partition_copy()
@@ -168,6 +176,7 @@ THRUST_HOST_DEVICE
                           OutputIterator2 out_false,
                           Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("stable_partition_copy", exec, first, last);
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
 } // end stable_partition_copy()
@@ -181,6 +190,7 @@ THRUST_HOST_DEVICE
                                   ForwardIterator last,
                                   Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("partition_point", exec, first, last);
   using thrust::system::detail::generic::partition_point;
   return partition_point(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end partition_point()
@@ -194,6 +204,7 @@ THRUST_HOST_DEVICE
                       InputIterator last,
                       Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("is_partitioned", exec, first, last);
   using thrust::system::detail::generic::is_partitioned;
   return is_partitioned(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end is_partitioned()
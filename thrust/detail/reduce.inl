@@ -25,6 +25,7 @@
 #include <thrust/system/detail/generic/reduce_by_key.h>
 #include <thrust/system/detail/adl/reduce.h>
 #include <thrust/system/detail/adl/reduce_by_key.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -35,6 +36,7 @@ THRUST_HOST_DEVICE
   typename thrust::iterator_traits<InputIterator>::value_type
     reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, InputIterator first, InputIterator last)
 {
+  THRUST_TRACE_ALGORITHM("reduce", exec, first, last);
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end reduce()
@@ -48,6 +50,7 @@ THRUST_HOST_DEVICE
            InputIterator last,
            T init)
 {
+  THRUST_TRACE_ALGORITHM("reduce", exec, first, last);
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init);
 } // end reduce()
@@ -65,6 +68,7 @@ THRUST_HOST_DEVICE
            T init,
            BinaryFunction binary_op)
 {
+  THRUST_TRACE_ALGORITHM("reduce", exec, first, last);
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init, binary_op);
 } // end reduce()
@@ -85,6 +89,7 @@ THRUST_HOST_DEVICE
                 OutputIterator1 keys_output,
                 OutputIterator2 values_output)
 {
+  THRUST_TRACE_ALGORITHM("reduce_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, keys_output, values_output);
 } // end reduce_by_key()
@@ -107,6 +112,7 @@ THRUST_HOST_DEVICE
                 OutputIterator2 values_output,
                 BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM("reduce_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
 } // end reduce_by_key()
@@ -131,6 +137,7 @@ THRUST_HOST_DEVICE
                 BinaryPredicate binary_pred,
                 BinaryFunction binary_op)
 {
+  THRUST_TRACE_ALGORITHM("reduce_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
 } // end reduce_by_key()
@@ -22,6 +22,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/remove.h>
 #include <thrust/system/detail/adl/remove.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -36,6 +37,7 @@ THRUST_HOST_DEVICE
                          ForwardIterator last,
                          const T &value)
 {
+  THRUST_TRACE_ALGORITHM("remove", exec, first, last);
   using thrust::system::detail::generic::remove;
   return remove(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end remove()
@@ -53,6 +55,7 @@ THRUST_HOST_DEVICE
                              OutputIterator result,
                              const T &value)
 {
+  THRUST_TRACE_ALGORITHM("remove_copy", exec, first, last);
   using thrust::system::detail::generic::remove_copy;
   return remove_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, value);
 } // end remove_copy()
@@ -68,6 +71,7 @@ THRUST_HOST_DEVICE
                             ForwardIterator last,
                             Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("remove_if", exec, first, last);
   using thrust::system::detail::generic::remove_if;
   return remove_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end remove_if()
@@ -85,6 +89,7 @@ THRUST_HOST_DEVICE
                                 OutputIterator result,
                                 Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("remove_copy_if", exec, first, last);
   using thrust::system::detail::generic::remove_copy_if;
   return remove_copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred);
 } // end remove_copy_if()
@@ -102,6 +107,7 @@ THRUST_HOST_DEVICE
                             InputIterator stencil,
                             Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("remove_if", exec, first, last);
   using thrust::system::detail::generic::remove_if;
   return remove_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end remove_if()
@@ -121,6 +127,7 @@ THRUST_HOST_DEVICE
                                 OutputIterator result,
                                 Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("remove_copy_if", exec, first, last);
   using thrust::system::detail::generic::remove_copy_if;
   return remove_copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred);
 } // end remove_copy_if()
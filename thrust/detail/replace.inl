@@ -22,6 +22,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/replace.h>
 #include <thrust/system/detail/adl/replace.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -34,6 +35,7 @@ THRUST_HOST_DEVICE
                const T &old_value,
                const T &new_value)
 {
+  THRUST_TRACE_ALGORITHM("replace", exec, first, last);
   using thrust::system::detail::generic::replace;
   return replace(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, old_value, new_value);
 } // end replace()
@@ -47,6 +49,7 @@ THRUST_HOST_DEVICE
                   Predicate pred,
                   const T &new_value)
 {
+  THRUST_TRACE_ALGORITHM("replace_if", exec, first, last);
   using thrust::system::detail::generic::replace_if;
   return replace_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred, new_value);
 } // end replace_if()
@@ -61,6 +64,7 @@ THRUST_HOST_DEVICE
                   Predicate pred,
                   const T &new_value)
 {
+  THRUST_TRACE_ALGORITHM("replace_if", exec, first, last);
   using thrust::system::detail::generic::replace_if;
   return replace_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred, new_value);
 } // end replace_if()
@@ -75,6 +79,7 @@ THRUST_HOST_DEVICE
                               const T &old_value,
                               const T &new_value)
 {
+  THRUST_TRACE_ALGORITHM("replace_copy", exec, first, last);
   using thrust::system::detail::generic::replace_copy;
   return replace_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, old_value, new_value);
 } // end replace_copy()
@@ -89,6 +94,7 @@ THRUST_HOST_DEVICE
                                  Predicate pred,
                                  const T &new_value)
 {
+  THRUST_TRACE_ALGORITHM("replace_copy_if", exec, first, last);
   using thrust::system::detail::generic::replace_copy_if;
   return replace_copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred, new_value);
 } // end replace_copy_if()
@@ -104,6 +110,7 @@ THRUST_HOST_DEVICE
                                  Predicate pred,
                                  const T &new_value)
 {
+  THRUST_TRACE_ALGORITHM("replace_copy_if", exec, first, last);
   using thrust::system::detail::generic::replace_copy_if;
   return replace_copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred, new_value);
 } // end replace_copy_if()
@@ -22,6 +22,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/reverse.h>
 #include <thrust/system/detail/adl/reverse.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -33,6 +34,7 @@ THRUST_HOST_DEVICE
                BidirectionalIterator first,
                BidirectionalIterator last)
 {
+  THRUST_TRACE_ALGORITHM("reverse", exec, first, last);
   using thrust::system::detail::generic::reverse;
   return reverse(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end reverse()
@@ -46,6 +48,7 @@ THRUST_HOST_DEVICE
                               BidirectionalIterator last,
                               OutputIterator result)
 {
+  THRUST_TRACE_ALGORITHM("reverse_copy", exec, first, last);
   using thrust::system::detail::generic::reverse_copy;
   return reverse_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end reverse_copy()
@@ -24,6 +24,7 @@
 #include <thrust/system/detail/generic/scan_by_key.h>
 #include <thrust/system/detail/adl/scan.h>
 #include <thrust/system/detail/adl/scan_by_key.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -38,6 +39,7 @@ THRUST_HOST_DEVICE
                                 InputIterator last,
                                 OutputIterator result)
 {
+  THRUST_TRACE_ALGORITHM("inclusive_scan", exec, first, last);
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end inclusive_scan()
@@ -55,6 +57,7 @@ THRUST_HOST_DEVICE
                                 OutputIterator result,
                                 AssociativeOperator binary_op)
 {
+  THRUST_TRACE_ALGORITHM("inclusive_scan", exec, first, last);
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, binary_op);
 } // end inclusive_scan()
@@ -70,6 +73,7 @@ THRUST_HOST_DEVICE
                                 InputIterator last,
                                 OutputIterator result)
 {
+  THRUST_TRACE_ALGORITHM("exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end exclusive_scan()
@@ -87,6 +91,7 @@ THRUST_HOST_DEVICE
                                 OutputIterator result,
                                 T init)
 {
+  THRUST_TRACE_ALGORITHM("exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init);
 } // end exclusive_scan()
@@ -106,6 +111,7 @@ THRUST_HOST_DEVICE
                                 T init,
                                 AssociativeOperator binary_op)
 {
+  THRUST_TRACE_ALGORITHM("exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init, binary_op);
 } // end exclusive_scan()
@@ -123,6 +129,7 @@ THRUST_HOST_DEVICE
                                        InputIterator2 first2,
                                        OutputIterator result)
 {
+  THRUST_TRACE_ALGORITHM("inclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result);
 } // end inclusive_scan_by_key()
@@ -142,6 +149,7 @@ THRUST_HOST_DEVICE
                                        OutputIterator result,
                                        BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM("inclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, binary_pred);
 } // end inclusive_scan_by_key()
@@ -163,6 +171,7 @@ THRUST_HOST_DEVICE
                                        BinaryPredicate binary_pred,
                                        AssociativeOperator binary_op)
 {
+  THRUST_TRACE_ALGORITHM("inclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, binary_pred, binary_op);
 } // end inclusive_scan_by_key()
@@ -180,6 +189,7 @@ THRUST_HOST_DEVICE
                                        InputIterator2 first2,
                                        OutputIterator result)
 {
+  THRUST_TRACE_ALGORITHM("exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result);
 } // end exclusive_scan_by_key()
@@ -199,6 +209,7 @@ THRUST_HOST_DEVICE
                                        OutputIterator result,
                                        T init)
 {
+  THRUST_TRACE_ALGORITHM("exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init);
 } // end exclusive_scan_by_key()
@@ -220,6 +231,7 @@ THRUST_HOST_DEVICE
                                        T init,
                                        BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM("exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init, binary_pred);
 } // end exclusive_scan_by_key()
@@ -243,6 +255,7 @@ THRUST_HOST_DEVICE
                                        BinaryPredicate binary_pred,
                                        AssociativeOperator binary_op)
 {
+  THRUST_TRACE_ALGORITHM("exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init, binary_pred, binary_op);
 } // end exclusive_scan_by_key()
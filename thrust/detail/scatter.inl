@@ -23,6 +23,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/scatter.h>
 #include <thrust/system/detail/adl/scatter.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -39,6 +40,7 @@ THRUST_HOST_DEVICE
                InputIterator2 map,
                RandomAccessIterator output)
 {
+  THRUST_TRACE_ALGORITHM("scatter", exec, first, last);
   using thrust::system::detail::generic::scatter;
   return scatter(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, output);
 } // end scatter()
@@ -58,6 +60,7 @@ THRUST_HOST_DEVICE
                   InputIterator3 stencil,
                   RandomAccessIterator output)
 {
+  THRUST_TRACE_ALGORITHM("scatter_if", exec, first, last);
   using thrust::system::detail::generic::scatter_if;
   return scatter_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, stencil, output);
 } // end scatter_if()
@@ -79,6 +82,7 @@ THRUST_HOST_DEVICE
                   RandomAccessIterator output,
                   Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("scatter_if", exec, first, last);
   using thrust::system::detail::generic::scatter_if;
   return scatter_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, stencil, output, pred);
 } // end scatter_if()
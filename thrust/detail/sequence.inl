@@ -22,6 +22,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/sequence.h>
 #include <thrust/system/detail/adl/sequence.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -33,6 +34,7 @@ THRUST_HOST_DEVICE
                 ForwardIterator first,
                 ForwardIterator last)
 {
+  THRUST_TRACE_ALGORITHM("sequence", exec, first, last);
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end sequence()
@@ -46,6 +48,7 @@ THRUST_HOST_DEVICE
                 ForwardIterator last,
                 T init)
 {
+  THRUST_TRACE_ALGORITHM("sequence", exec, first, last);
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init);
 } // end sequence()
@@ -60,6 +63,7 @@ THRUST_HOST_DEVICE
                 T init,
                 T step)
 {
+  THRUST_TRACE_ALGORITHM("sequence", exec, first, last);
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init, step);
 } // end sequence()
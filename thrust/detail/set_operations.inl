@@ -21,6 +21,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/set_operations.h>
 #include <thrust/system/detail/adl/set_operations.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -38,6 +39,7 @@ OutputIterator set_difference(const thrust::detail::execution_policy_base<Derive
                               InputIterator2                                              last2,
                               OutputIterator                                              result)
 {
+  THRUST_TRACE_ALGORITHM("set_difference", exec, first1, last1);
   using thrust::system::detail::generic::set_difference;
   return set_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
 } // end set_difference()
@@ -58,6 +60,7 @@ OutputIterator set_difference(const thrust::detail::execution_policy_base<Derive
                               OutputIterator                                              result,
                               StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM("set_difference", exec, first1, last1);
   using thrust::system::detail::generic::set_difference;
   return set_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
 } // end set_difference()
@@ -83,6 +86,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                         OutputIterator1                                             keys_result,
                         OutputIterator2                                             values_result)
 {
+  THRUST_TRACE_ALGORITHM("set_difference_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_difference_by_key;
   return set_difference_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result);
 } // end set_difference_by_key()
@@ -110,6 +114,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                         OutputIterator2                                             values_result,
                         StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM("set_difference_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_difference_by_key;
   return set_difference_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result, comp);
 } // end set_difference_by_key()
@@ -128,6 +133,7 @@ OutputIterator set_intersection(const thrust::detail::execution_policy_base<Deri
                                 InputIterator2                                              last2,
                                 OutputIterator                                              result)
 {
+  THRUST_TRACE_ALGORITHM("set_intersection", exec, first1, last1);
   using thrust::system::detail::generic::set_intersection;
   return set_intersection(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
 } // end set_intersection()
@@ -148,6 +154,7 @@ OutputIterator set_intersection(const thrust::detail::execution_policy_base<Deri
                                 OutputIterator                                              result,
                                 StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM("set_intersection", exec, first1, last1);
   using thrust::system::detail::generic::set_intersection;
   return set_intersection(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
 } // end set_intersection()
@@ -171,6 +178,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                           OutputIterator1                                             keys_result,
                           OutputIterator2                                             values_result)
 {
+  THRUST_TRACE_ALGORITHM("set_intersection_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_intersection_by_key;
   return set_intersection_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, keys_result, values_result);
 } // end set_intersection_by_key()
@@ -196,6 +204,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                           OutputIterator2                                             values_result,
                           StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM("set_intersection_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_intersection_by_key;
   return set_intersection_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, keys_result, values_result, comp);
 } // end set_intersection_by_key()
@@ -214,6 +223,7 @@ OutputIterator set_symmetric_difference(const thrust::detail::execution_policy_b
                                         InputIterator2                                              last2,
                                         OutputIterator                                              result)
 {
+  THRUST_TRACE_ALGORITHM("set_symmetric_difference", exec, first1, last1);
   using thrust::system::detail::generic::set_symmetric_difference;
   return set_symmetric_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
 } // end set_symmetric_difference()
@@ -234,6 +244,7 @@ OutputIterator set_symmetric_difference(const thrust::detail::execution_policy_b
                                         OutputIterator                                              result,
                                         StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM("set_symmetric_difference", exec, first1, last1);
   using thrust::system::detail::generic::set_symmetric_difference;
   return set_symmetric_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
 } // end set_symmetric_difference()
@@ -259,6 +270,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                                   OutputIterator1                                             keys_result,
                                   OutputIterator2                                             values_result)
 {
+  THRUST_TRACE_ALGORITHM("set_symmetric_difference_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_symmetric_difference_by_key;
   return set_symmetric_difference_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result);
 } // end set_symmetric_difference_by_key()
@@ -286,6 +298,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                                   OutputIterator2                                             values_result,
                                   StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM("set_symmetric_difference_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_symmetric_difference_by_key;
   return set_symmetric_difference_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result, comp);
 } // end set_symmetric_difference_by_key()
@@ -304,6 +317,7 @@ OutputIterator set_union(const thrust::detail::execution_policy_base<DerivedPoli
                          InputIterator2                                              last2,
                          OutputIterator                                              result)
 {
+  THRUST_TRACE_ALGORITHM("set_union", exec, first1, last1);
   using thrust::system::detail::generic::set_union;
   return set_union(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
 } // end set_union()
@@ -324,6 +338,7 @@ OutputIterator set_union(const thrust::detail::execution_policy_base<DerivedPoli
                          OutputIterator                                              result,
                          StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM("set_union", exec, first1, last1);
   using thrust::system::detail::generic::set_union;
   return set_union(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
 } // end set_union()
@@ -349,6 +364,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                    OutputIterator1                                             keys_result,
                    OutputIterator2                                             values_result)
 {
+  THRUST_TRACE_ALGORITHM("set_union_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_union_by_key;
   return set_union_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result);
 } // end set_union_by_key()
@@ -376,6 +392,7 @@ thrust::pair<OutputIterator1,OutputIterator2>
                    OutputIterator2                                             values_result,
                    StrictWeakCompare                                           comp)
 {
+  THRUST_TRACE_ALGORITHM("set_union_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_union_by_key;
   return set_union_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result, comp);
 } // end set_union_by_key()
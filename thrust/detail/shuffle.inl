@@ -24,6 +24,8 @@
 #include <thrust/shuffle.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/adl/shuffle.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -32,6 +34,7 @@ template <typename DerivedPolicy, typename RandomIterator, typename URBG>
 THRUST_HOST_DEVICE void shuffle(
     const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
     RandomIterator first, RandomIterator last, URBG&& g) {
+  THRUST_TRACE_ALGORITHM("shuffle", exec, first, last);
   using thrust::system::detail::generic::shuffle;
   return shuffle(
       thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -56,6 +59,7 @@ THRUST_HOST_DEVICE void shuffle_copy(
     const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
     RandomIterator first, RandomIterator last, OutputIterator result,
     URBG&& g) {
+  THRUST_TRACE_ALGORITHM("shuffle_copy", exec, first, last);
   using thrust::system::detail::generic::shuffle_copy;
   return shuffle_copy(
       thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -22,6 +22,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/sort.h>
 #include <thrust/system/detail/adl/sort.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -33,6 +34,7 @@ THRUST_HOST_DEVICE
             RandomAccessIterator first,
             RandomAccessIterator last)
 {
+  THRUST_TRACE_ALGORITHM("sort", exec, first, last);
   using thrust::system::detail::generic::sort;
   return sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end sort()
@@ -48,6 +50,7 @@ THRUST_HOST_DEVICE
             RandomAccessIterator last,
             StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM("sort", exec, first, last);
   using thrust::system::detail::generic::sort;
   return sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end sort()
@@ -60,6 +63,7 @@ THRUST_HOST_DEVICE
                    RandomAccessIterator first,
                    RandomAccessIterator last)
 {
+  THRUST_TRACE_ALGORITHM("stable_sort", exec, first, last);
   using thrust::system::detail::generic::stable_sort;
   return stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end stable_sort()
@@ -75,6 +79,7 @@ THRUST_HOST_DEVICE
                    RandomAccessIterator last,
                    StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM("stable_sort", exec, first, last);
   using thrust::system::detail::generic::stable_sort;
   return stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end stable_sort()
@@ -90,6 +95,7 @@ THRUST_HOST_DEVICE
                    RandomAccessIterator1 keys_last,
                    RandomAccessIterator2 values_first)
 {
+  THRUST_TRACE_ALGORITHM("sort_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::sort_by_key;
   return sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
 } // end sort_by_key()
@@ -107,6 +113,7 @@ THRUST_HOST_DEVICE
                    RandomAccessIterator2 values_first,
                    StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM("sort_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::sort_by_key;
   return sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, comp);
 } // end sort_by_key()
@@ -122,6 +129,7 @@ THRUST_HOST_DEVICE
                           RandomAccessIterator1 keys_last,
                           RandomAccessIterator2 values_first)
 {
+  THRUST_TRACE_ALGORITHM("stable_sort_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::stable_sort_by_key;
   return stable_sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
 } // end stable_sort_by_key()
@@ -139,6 +147,7 @@ THRUST_HOST_DEVICE
                           RandomAccessIterator2 values_first,
                           StrictWeakOrdering comp)
 {
+  THRUST_TRACE_ALGORITHM("stable_sort_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::stable_sort_by_key;
   return stable_sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, comp);
 } // end stable_sort_by_key()
@@ -151,6 +160,7 @@ THRUST_HOST_DEVICE
                  ForwardIterator first,
                  ForwardIterator last)
 {
+  THRUST_TRACE_ALGORITHM("is_sorted", exec, first, last);
   using thrust::system::detail::generic::is_sorted;
   return is_sorted(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end is_sorted()
@@ -164,6 +174,7 @@ THRUST_HOST_DEVICE
                  ForwardIterator last,
                  Compare comp)
 {
+  THRUST_TRACE_ALGORITHM("is_sorted", exec, first, last);
   using thrust::system::detail::generic::is_sorted;
   return is_sorted(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end is_sorted()
@@ -176,6 +187,7 @@ THRUST_HOST_DEVICE
                                   ForwardIterator first,
                                   ForwardIterator last)
 {
+  THRUST_TRACE_ALGORITHM("is_sorted_until", exec, first, last);
   using thrust::system::detail::generic::is_sorted_until;
   return is_sorted_until(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end is_sorted_until()
@@ -189,6 +201,7 @@ THRUST_HOST_DEVICE
                                   ForwardIterator last,
                                   Compare comp)
 {
+  THRUST_TRACE_ALGORITHM("is_sorted_until", exec, first, last);
   using thrust::system::detail::generic::is_sorted_until;
   return is_sorted_until(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end is_sorted_until()
@@ -22,6 +22,10 @@
 #include <thrust/detail/pointer.h>
 #include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/execute_with_allocator.h>
+#include <thrust/detail/execute_with_temporary_memory_limit.h>
+#include <thrust/detail/nv_target.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/temporary_memory.h>
 #include <thrust/system/detail/generic/temporary_buffer.h>
 #include <thrust/system/detail/adl/temporary_buffer.h>
 
@@ -56,7 +60,18 @@ THRUST_HOST_DEVICE
   using thrust::detail::get_temporary_buffer; // execute_with_allocator
   using thrust::system::detail::generic::get_temporary_buffer;
 
-  return thrust::detail::down_cast_pair<T,DerivedPolicy>(get_temporary_buffer<T>(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), n));
+  thrust::pair<thrust::pointer<T,DerivedPolicy>, typename thrust::pointer<T,DerivedPolicy>::difference_type> result =
+    thrust::detail::down_cast_pair<T,DerivedPolicy>(get_temporary_buffer<T>(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), n));
+
+  // a failed allocation returns a null pointer and a size of 0
+  NV_IF_TARGET(NV_IS_HOST, (
+    if(result.second > 0)
+    {
+      thrust::detail::temporary_memory_allocated(static_cast<std::size_t>(result.second) * sizeof(T));
+    }
+  ));
+
+  return result;
 } // end get_temporary_buffer()
 
 
@@ -68,6 +83,14 @@ THRUST_HOST_DEVICE
   using thrust::detail::return_temporary_buffer; // execute_with_allocator
   using thrust::system::detail::generic::return_temporary_buffer;
 
+  NV_IF_TARGET(NV_IS_HOST, (
+    if(thrust::raw_pointer_cast(p) && n > 0)
+    {
+      thrust::detail::temporary_memory_deallocated(
+        static_cast<std::size_t>(n) * thrust::detail::temporary_element_size<typename thrust::detail::pointer_traits<Pointer>::element_type>::value);
+    }
+  ));
+
   return return_temporary_buffer(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), p, n);
 } // end return_temporary_buffer()
 
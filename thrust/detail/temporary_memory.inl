@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/temporary_memory.h>
+#include <thrust/detail/type_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+
+template<typename T>
+  struct temporary_element_size
+    : thrust::detail::integral_constant<std::size_t, sizeof(T)>
+{};
+
+// storage returned through a void pointer is counted in bytes
+template<>
+  struct temporary_element_size<void>
+    : thrust::detail::integral_constant<std::size_t, 1>
+{};
+
+
+inline temporary_memory_stats & get_temporary_memory_state()
+{
+  // zero initialized, like every thread_local of a trivial type
+  static thread_local temporary_memory_stats state;
+  return state;
+}
+
+
+inline void temporary_memory_allocated(std::size_t bytes)
+{
+  temporary_memory_stats & state = get_temporary_memory_state();
+
+  state.current_bytes += bytes;
+  state.cumulative_bytes += bytes;
+  ++state.allocations;
+  if (state.current_bytes > state.peak_bytes)
+  {
+    state.peak_bytes = state.current_bytes;
+  }
+}
+
+
+inline void temporary_memory_deallocated(std::size_t bytes)
+{
+  temporary_memory_stats & state = get_temporary_memory_state();
+
+  state.current_bytes = state.current_bytes > bytes ? state.current_bytes - bytes : 0;
+}
+
+
+} // end detail
+
+
+inline temporary_memory_stats get_temporary_memory_stats()
+{
+  return thrust::detail::get_temporary_memory_state();
+}
+
+
+inline void reset_temporary_memory_stats()
+{
+  temporary_memory_stats & state = thrust::detail::get_temporary_memory_state();
+
+  state.peak_bytes = state.current_bytes;
+  state.cumulative_bytes = 0;
+  state.allocations = 0;
+}
+
+
+THRUST_NAMESPACE_END
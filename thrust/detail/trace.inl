@@ -0,0 +1,257 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/trace.h>
+
+#include <atomic>
+#include <chrono>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+
+struct trace_state
+{
+  trace_state()
+    : active(false), cb(NULL), user_data(NULL)
+  {}
+
+  // checked without the lock, so that no lock is taken while nothing is listening
+  std::atomic<bool> active;
+
+  std::mutex mutex;
+  trace::callback cb;
+  void * user_data;
+};
+
+
+inline trace_state & get_trace_state()
+{
+  static trace_state state;
+  return state;
+}
+
+
+// set while the callback runs on this thread, so that algorithms called by the callback do not recurse into it
+inline bool & trace_in_callback()
+{
+  static thread_local bool in_callback = false;
+  return in_callback;
+}
+
+
+inline std::uint64_t trace_thread_id()
+{
+  static std::atomic<std::uint64_t> next_id(1);
+  static thread_local std::uint64_t id = next_id.fetch_add(1, std::memory_order_relaxed);
+  return id;
+}
+
+
+inline std::uint64_t trace_now()
+{
+  return static_cast<std::uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+inline bool trace_listening()
+{
+  return get_trace_state().active.load(std::memory_order_acquire) && !trace_in_callback();
+}
+
+
+inline void trace_emit(const trace::event & e)
+{
+  trace_state & state = get_trace_state();
+
+  struct in_callback_guard
+  {
+    in_callback_guard() { trace_in_callback() = true; }
+    ~in_callback_guard() { trace_in_callback() = false; }
+  } guard;
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (state.cb)
+  {
+    state.cb(e, state.user_data);
+  }
+}
+
+
+} // end detail
+
+
+namespace trace
+{
+
+
+inline void set_callback(callback cb, void * user_data)
+{
+  thrust::detail::trace_state & state = thrust::detail::get_trace_state();
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.cb = cb;
+  state.user_data = user_data;
+  state.active.store(cb != NULL, std::memory_order_release);
+}
+
+
+inline callback get_callback()
+{
+  thrust::detail::trace_state & state = thrust::detail::get_trace_state();
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.cb;
+}
+
+
+inline chrome_trace_writer::chrome_trace_writer(const char * path)
+  : m_file(std::fopen(path, "w")),
+    m_start(thrust::detail::trace_now()),
+    m_first(true)
+{
+  if (m_file)
+  {
+    std::fputs("{\"traceEvents\":[", m_file);
+  }
+}
+
+
+inline chrome_trace_writer::~chrome_trace_writer()
+{
+  close();
+}
+
+
+inline void chrome_trace_writer::install()
+{
+  set_callback(&chrome_trace_writer::dispatch, this);
+}
+
+
+inline void chrome_trace_writer::close()
+{
+  thrust::detail::trace_state & state = thrust::detail::get_trace_state();
+
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.cb == &chrome_trace_writer::dispatch && state.user_data == this)
+    {
+      state.cb = NULL;
+      state.user_data = NULL;
+      state.active.store(false, std::memory_order_release);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_file)
+  {
+    // end the slices of the algorithms still running, innermost first
+    const std::uint64_t now = thrust::detail::trace_now();
+    while (!m_open.empty())
+    {
+      event e = m_open.back();
+      e.phase = phase::end;
+      e.count = 0;
+      e.value_size = 0;
+      e.timestamp = now;
+      write_locked(e);
+    }
+
+    std::fputs("\n],\"displayTimeUnit\":\"ns\"}\n", m_file);
+    std::fclose(m_file);
+    m_file = NULL;
+  }
+}
+
+
+inline void chrome_trace_writer::write(const event & e)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_file)
+  {
+    return;
+  }
+
+  write_locked(e);
+}
+
+
+inline void chrome_trace_writer::write_locked(const event & e)
+{
+  if (e.phase == phase::begin)
+  {
+    m_open.push_back(e);
+  }
+  else
+  {
+    // the innermost open slice of the thread is the one ending
+    std::vector<event>::iterator i = m_open.end();
+    while (i != m_open.begin() && (i - 1)->thread != e.thread)
+    {
+      --i;
+    }
+    if (i == m_open.begin())
+    {
+      return;
+    }
+    m_open.erase(i - 1);
+  }
+
+  // the format wants microseconds; events from before the writer was opened are clamped to its start
+  const std::uint64_t ns = e.timestamp > m_start ? e.timestamp - m_start : 0;
+
+  std::fprintf(m_file,
+    "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%s\",\"ts\":%llu.%03u,\"pid\":0,\"tid\":%llu",
+    m_first ? "" : ",",
+    e.algorithm,
+    e.backend,
+    e.phase == phase::begin ? "B" : "E",
+    static_cast<unsigned long long>(ns / 1000),
+    static_cast<unsigned>(ns % 1000),
+    static_cast<unsigned long long>(e.thread));
+
+  if (e.phase == phase::begin)
+  {
+    std::fprintf(m_file, ",\"args\":{\"count\":%llu,\"value_size\":%llu}}",
+      static_cast<unsigned long long>(e.count),
+      static_cast<unsigned long long>(e.value_size));
+  }
+  else
+  {
+    std::fprintf(m_file, ",\"args\":{\"temporary_bytes\":%llu,\"peak_temporary_bytes\":%llu}}",
+      static_cast<unsigned long long>(e.temporary_bytes),
+      static_cast<unsigned long long>(e.peak_temporary_bytes));
+  }
+
+  m_first = false;
+}
+
+
+inline void chrome_trace_writer::dispatch(const event & e, void * user_data)
+{
+  static_cast<chrome_trace_writer *>(user_data)->write(e);
+}
+
+
+} // end trace
+THRUST_NAMESPACE_END
@@ -0,0 +1,263 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+// The algorithm entry points in thrust/detail/*.inl open a trace_scope with
+// THRUST_TRACE_ALGORITHM(name, exec, first, last) or
+// THRUST_TRACE_ALGORITHM_N(name, exec, first, n). Unless
+// THRUST_ENABLE_TRACING is defined, the macros expand to nothing and nothing
+// of thrust/trace.h is included.
+
+#if defined(THRUST_ENABLE_TRACING)
+
+#include <thrust/trace.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/nv_target.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/temporary_memory.h>
+#include <thrust/type_traits/void_t.h>
+
+THRUST_NAMESPACE_BEGIN
+
+// the tags of the other systems are only compared against, so declaring them
+// is enough, and does not pull in the headers of systems that are not used
+namespace system
+{
+namespace cpp { namespace detail { struct tag; } }
+namespace omp { namespace detail { struct tag; } }
+namespace tbb { namespace detail { struct tag; } }
+} // end system
+namespace hip_rocprim { struct tag; }
+namespace cuda_cub { struct tag; }
+
+namespace detail
+{
+
+
+// the tags of the cpp, omp and tbb systems have no tag_type and stand for themselves
+template<typename Policy, typename = void>
+  struct trace_system_tag
+{
+  typedef Policy type;
+};
+
+template<typename Policy>
+  struct trace_system_tag<Policy, thrust::void_t<typename Policy::tag_type> >
+{
+  typedef typename Policy::tag_type type;
+};
+
+
+template<typename Policy>
+  struct trace_system_name
+{
+  static const char * value()
+  {
+    typedef typename trace_system_tag<Policy>::type tag;
+
+    if (thrust::detail::is_same<tag, thrust::system::cpp::detail::tag>::value)
+    {
+      return "cpp";
+    }
+    if (thrust::detail::is_same<tag, thrust::system::omp::detail::tag>::value)
+    {
+      return "omp";
+    }
+    if (thrust::detail::is_same<tag, thrust::system::tbb::detail::tag>::value)
+    {
+      return "tbb";
+    }
+    if (thrust::detail::is_same<tag, thrust::hip_rocprim::tag>::value)
+    {
+      return "hip";
+    }
+    if (thrust::detail::is_same<tag, thrust::cuda_cub::tag>::value)
+    {
+      return "cuda";
+    }
+    if (thrust::detail::is_base_of<thrust::system::detail::sequential::execution_policy<Policy>, Policy>::value)
+    {
+      return "seq";
+    }
+    return "unknown";
+  }
+};
+
+
+template<typename T>
+  struct trace_value_size
+    : thrust::detail::integral_constant<std::size_t, sizeof(T)>
+{};
+
+// output iterators such as std::back_insert_iterator have no value type
+template<>
+  struct trace_value_size<void>
+    : thrust::detail::integral_constant<std::size_t, 0>
+{};
+
+
+template<typename Iterator>
+std::size_t trace_range_count(Iterator first, Iterator last, thrust::detail::true_type)
+{
+  return last > first ? static_cast<std::size_t>(last - first) : 0;
+}
+
+// counting a range that is not random access would walk it
+template<typename Iterator>
+std::size_t trace_range_count(Iterator, Iterator, thrust::detail::false_type)
+{
+  return 0;
+}
+
+
+struct trace_count_n {};
+
+
+class trace_scope
+{
+public:
+  template<typename DerivedPolicy, typename Iterator>
+  THRUST_HOST_DEVICE
+  trace_scope(const char * name, const thrust::detail::execution_policy_base<DerivedPolicy> &, Iterator first, Iterator last)
+    : m_name(NULL)
+  {
+    NV_IF_TARGET(NV_IS_HOST, (
+      typedef typename thrust::detail::is_convertible<
+        typename thrust::iterator_traversal<Iterator>::type,
+        thrust::random_access_traversal_tag
+      >::type is_random_access;
+
+      begin(name,
+            trace_system_name<DerivedPolicy>::value(),
+            trace_range_count(first, last, is_random_access()),
+            trace_value_size<typename thrust::iterator_value<Iterator>::type>::value);
+    ));
+  }
+
+  template<typename DerivedPolicy, typename Iterator, typename Size>
+  THRUST_HOST_DEVICE
+  trace_scope(const char * name, const thrust::detail::execution_policy_base<DerivedPolicy> &, Iterator, Size n, trace_count_n)
+    : m_name(NULL)
+  {
+    NV_IF_TARGET(NV_IS_HOST, (
+      begin(name,
+            trace_system_name<DerivedPolicy>::value(),
+            n > Size(0) ? static_cast<std::size_t>(n) : 0,
+            trace_value_size<typename thrust::iterator_value<Iterator>::type>::value);
+    ));
+  }
+
+  THRUST_HOST_DEVICE
+  ~trace_scope()
+  {
+    NV_IF_TARGET(NV_IS_HOST, (
+      end();
+    ));
+  }
+
+private:
+  trace_scope(const trace_scope &);
+  trace_scope & operator=(const trace_scope &);
+
+  void begin(const char * name, const char * backend, std::size_t count, std::size_t value_size)
+  {
+    if (!trace_listening())
+    {
+      return;
+    }
+
+    // the peak of the thread restarts from the storage in use, to measure the peak of this call
+    temporary_memory_stats & temporary = get_temporary_memory_state();
+    m_name = name;
+    m_backend = backend;
+    m_temporary_bytes = temporary.cumulative_bytes;
+    m_temporary_base = temporary.current_bytes;
+    m_temporary_peak = temporary.peak_bytes;
+    temporary.peak_bytes = temporary.current_bytes;
+
+    trace::event e;
+    e.phase = trace::phase::begin;
+    e.algorithm = name;
+    e.backend = backend;
+    e.count = count;
+    e.value_size = value_size;
+    e.temporary_bytes = 0;
+    e.peak_temporary_bytes = 0;
+    e.timestamp = trace_now();
+    e.thread = trace_thread_id();
+    trace_emit(e);
+  }
+
+  void end()
+  {
+    if (!m_name)
+    {
+      return;
+    }
+
+    // and then goes on from the higher of the two peaks
+    temporary_memory_stats & temporary = get_temporary_memory_state();
+    const std::size_t peak = temporary.peak_bytes;
+    if (m_temporary_peak > temporary.peak_bytes)
+    {
+      temporary.peak_bytes = m_temporary_peak;
+    }
+
+    // the end event is emitted whenever the begin event was, even if the callback has been unset or replaced since,
+    // so that the callback sees balanced events
+    trace::event e;
+    e.phase = trace::phase::end;
+    e.algorithm = m_name;
+    e.backend = m_backend;
+    e.count = 0;
+    e.value_size = 0;
+    // reset_temporary_memory_stats() may have been called meanwhile
+    e.temporary_bytes = temporary.cumulative_bytes >= m_temporary_bytes ? temporary.cumulative_bytes - m_temporary_bytes
+                                                                        : temporary.cumulative_bytes;
+    e.peak_temporary_bytes = peak > m_temporary_base ? peak - m_temporary_base : 0;
+    e.timestamp = trace_now();
+    e.thread = trace_thread_id();
+    trace_emit(e);
+  }
+
+  const char * m_name;
+  const char * m_backend;
+  std::size_t m_temporary_bytes;
+  std::size_t m_temporary_base;
+  std::size_t m_temporary_peak;
+};
+
+
+} // end detail
+THRUST_NAMESPACE_END
+
+#define THRUST_TRACE_ALGORITHM(name, exec, first, last) \
+  thrust::detail::trace_scope thrust_trace_scope(name, exec, first, last)
+
+#define THRUST_TRACE_ALGORITHM_N(name, exec, first, n) \
+  thrust::detail::trace_scope thrust_trace_scope(name, exec, first, n, thrust::detail::trace_count_n())
+
+#else // THRUST_ENABLE_TRACING
+
+#define THRUST_TRACE_ALGORITHM(name, exec, first, last)
+#define THRUST_TRACE_ALGORITHM_N(name, exec, first, n)
+
+#endif // THRUST_ENABLE_TRACING
@@ -23,6 +23,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/transform.h>
 #include <thrust/system/detail/adl/transform.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -38,6 +39,7 @@ THRUST_HOST_DEVICE
                            OutputIterator result,
                            UnaryFunction op)
 {
+  THRUST_TRACE_ALGORITHM("transform", exec, first, last);
   using thrust::system::detail::generic::transform;
   return transform(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, op);
 } // end transform()
@@ -56,6 +58,7 @@ THRUST_HOST_DEVICE
                            OutputIterator result,
                            BinaryFunction op)
 {
+  THRUST_TRACE_ALGORITHM("transform", exec, first1, last1);
   using thrust::system::detail::generic::transform;
   return transform(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, op);
 } // end transform()
@@ -74,6 +77,7 @@ THRUST_HOST_DEVICE
                                UnaryFunction op,
                                Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("transform_if", exec, first, last);
   using thrust::system::detail::generic::transform_if;
   return transform_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, op, pred);
 } // end transform_if()
@@ -94,6 +98,7 @@ THRUST_HOST_DEVICE
                                UnaryFunction op,
                                Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("transform_if", exec, first, last);
   using thrust::system::detail::generic::transform_if;
   return transform_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, op, pred);
 } // end transform_if()
@@ -116,6 +121,7 @@ THRUST_HOST_DEVICE
                                BinaryFunction binary_op,
                                Predicate pred)
 {
+  THRUST_TRACE_ALGORITHM("transform_if", exec, first1, last1);
   using thrust::system::detail::generic::transform_if;
   return transform_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, stencil, result, binary_op, pred);
 } // end transform_if()
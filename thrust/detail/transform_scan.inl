@@ -23,6 +23,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/transform_scan.h>
 #include <thrust/system/detail/adl/transform_scan.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -41,6 +42,7 @@ THRUST_HOST_DEVICE
                                           UnaryFunction unary_op,
                                           AssociativeOperator binary_op)
 {
+  THRUST_TRACE_ALGORITHM("transform_inclusive_scan", exec, first, last);
   using thrust::system::detail::generic::transform_inclusive_scan;
   return transform_inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, unary_op, binary_op);
 } // end transform_inclusive_scan()
@@ -62,6 +64,7 @@ THRUST_HOST_DEVICE
                                           T init,
                                           AssociativeOperator binary_op)
 {
+  THRUST_TRACE_ALGORITHM("transform_exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::transform_exclusive_scan;
   return transform_exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, unary_op, init, binary_op);
 } // end transform_exclusive_scan()
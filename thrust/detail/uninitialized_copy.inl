@@ -23,6 +23,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/uninitialized_copy.h>
 #include <thrust/system/detail/adl/uninitialized_copy.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -35,6 +36,7 @@ THRUST_HOST_DEVICE
                                      InputIterator last,
                                      ForwardIterator result)
 {
+  THRUST_TRACE_ALGORITHM("uninitialized_copy", exec, first, last);
   using thrust::system::detail::generic::uninitialized_copy;
   return uninitialized_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end uninitialized_copy()
@@ -48,6 +50,7 @@ THRUST_HOST_DEVICE
                                        Size n,
                                        ForwardIterator result)
 {
+  THRUST_TRACE_ALGORITHM_N("uninitialized_copy_n", exec, first, n);
   using thrust::system::detail::generic::uninitialized_copy_n;
   return uninitialized_copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, result);
 } // end uninitialized_copy_n()
@@ -23,6 +23,7 @@
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/uninitialized_fill.h>
 #include <thrust/system/detail/adl/uninitialized_fill.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -35,6 +36,7 @@ THRUST_HOST_DEVICE
                           ForwardIterator last,
                           const T &x)
 {
+  THRUST_TRACE_ALGORITHM("uninitialized_fill", exec, first, last);
   using thrust::system::detail::generic::uninitialized_fill;
   return uninitialized_fill(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, x);
 } // end uninitialized_fill()
@@ -48,6 +50,7 @@ THRUST_HOST_DEVICE
                                        Size n,
                                        const T &x)
 {
+  THRUST_TRACE_ALGORITHM_N("uninitialized_fill_n", exec, first, n);
   using thrust::system::detail::generic::uninitialized_fill_n;
   return uninitialized_fill_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, x);
 } // end uninitialized_fill_n()
@@ -24,6 +24,7 @@
 #include <thrust/system/detail/generic/unique_by_key.h>
 #include <thrust/system/detail/adl/unique.h>
 #include <thrust/system/detail/adl/unique_by_key.h>
+#include <thrust/detail/trace_scope.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -36,6 +37,7 @@ ForwardIterator unique(const thrust::detail::execution_policy_base<DerivedPolicy
                        ForwardIterator first,
                        ForwardIterator last)
 {
+  THRUST_TRACE_ALGORITHM("unique", exec, first, last);
   using thrust::system::detail::generic::unique;
   return unique(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end unique()
@@ -51,6 +53,7 @@ ForwardIterator unique(const thrust::detail::execution_policy_base<DerivedPolicy
                        ForwardIterator last,
                        BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM("unique", exec, first, last);
   using thrust::system::detail::generic::unique;
   return unique(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, binary_pred);
 } // end unique()
@@ -66,6 +69,7 @@ OutputIterator unique_copy(const thrust::detail::execution_policy_base<DerivedPo
                            InputIterator last,
                            OutputIterator output)
 {
+  THRUST_TRACE_ALGORITHM("unique_copy", exec, first, last);
   using thrust::system::detail::generic::unique_copy;
   return unique_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, output);
 } // end unique_copy()
@@ -83,6 +87,7 @@ OutputIterator unique_copy(const thrust::detail::execution_policy_base<DerivedPo
                            OutputIterator output,
                            BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM("unique_copy", exec, first, last);
   using thrust::system::detail::generic::unique_copy;
   return unique_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, output, binary_pred);
 } // end unique_copy()
@@ -99,6 +104,7 @@ THRUST_HOST_DEVICE
                 ForwardIterator1 keys_last,
                 ForwardIterator2 values_first)
 {
+  THRUST_TRACE_ALGORITHM("unique_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key;
   return unique_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
 } // end unique_by_key()
@@ -117,6 +123,7 @@ THRUST_HOST_DEVICE
                 ForwardIterator2 values_first,
                 BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM("unique_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key;
   return unique_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, binary_pred);
 } // end unique_by_key()
@@ -137,6 +144,7 @@ THRUST_HOST_DEVICE
                      OutputIterator1 keys_output,
                      OutputIterator2 values_output)
 {
+  THRUST_TRACE_ALGORITHM("unique_by_key_copy", exec, keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key_copy;
   return unique_by_key_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, keys_output, values_output);
 } // end unique_by_key_copy()
@@ -159,6 +167,7 @@ THRUST_HOST_DEVICE
                      OutputIterator2 values_output,
                      BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM("unique_by_key_copy", exec, keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key_copy;
   return unique_by_key_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
 } // end unique_by_key_copy()
@@ -338,6 +347,7 @@ THRUST_HOST_DEVICE
                  ForwardIterator last,
                  BinaryPredicate binary_pred)
 {
+  THRUST_TRACE_ALGORITHM("unique_count", exec, first, last);
   using thrust::system::detail::generic::unique_count;
   return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, binary_pred);
 } // end unique_count()
@@ -351,6 +361,7 @@ THRUST_HOST_DEVICE
                  ForwardIterator first,
                  ForwardIterator last)
 {
+  THRUST_TRACE_ALGORITHM("unique_count", exec, first, last);
   using thrust::system::detail::generic::unique_count;
   return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end unique_count()
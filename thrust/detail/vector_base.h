@@ -28,6 +28,7 @@
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/config.h>
 #include <thrust/detail/contiguous_storage.h>
+#include <thrust/detail/no_init.h>
 #include <thrust/sequence_access.h>
 
 #include <initializer_list>
@@ -83,6 +84,21 @@ template<typename T, typename Alloc>
      */
     explicit vector_base(size_type n, const Alloc &alloc);
 
+    /*! This constructor creates a vector_base with uninitialized elements,
+     *  unless their type or the allocator requires construction, in which
+     *  case they are default-constructed.
+     *  \param n The number of elements to create.
+     */
+    vector_base(size_type n, no_init_t);
+
+    /*! This constructor creates a vector_base with uninitialized elements,
+     *  unless their type or the allocator requires construction, in which
+     *  case they are default-constructed.
+     *  \param n The number of elements to create.
+     *  \param alloc The allocator to use by this vector_base.
+     */
+    vector_base(size_type n, no_init_t, const Alloc &alloc);
+
     /*! This constructor creates a vector_base with copies
      *  of an exemplar element.
      *  \param n The number of elements to initially create.
@@ -219,6 +235,18 @@ template<typename T, typename Alloc>
      */
     void resize(size_type new_size, const value_type &x);
 
+    /*! \brief Resizes this vector_base to the specified number of elements.
+     *  \param new_size Number of elements this vector_base should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  This method will resize this vector_base to the specified number of
+     *  elements. If the number is smaller than this vector_base's current
+     *  size this vector_base is truncated, otherwise this vector_base is
+     *  extended and new elements are left uninitialized, unless their type
+     *  or the allocator requires construction.
+     */
+    void resize(size_type new_size, no_init_t);
+
     /*! Returns the number of elements in this vector_base.
      */
     THRUST_HOST_DEVICE
@@ -514,7 +542,8 @@ template<typename T, typename Alloc>
     template<typename ForwardIterator>
       void range_init(ForwardIterator first, ForwardIterator last, thrust::random_access_traversal_tag);
 
-    void default_init(size_type n);
+    // value_init is false for no_init
+    void default_init(size_type n, bool value_init = true);
 
     void fill_init(size_type n, const T &x);
 
@@ -526,8 +555,14 @@ template<typename T, typename Alloc>
     template<typename InputIteratorOrIntegralType>
       void insert_dispatch(iterator position, InputIteratorOrIntegralType n, InputIteratorOrIntegralType x, true_type);
 
-    // this method appends n default-constructed elements at the end
-    void append(size_type n);
+    // this method appends n default-constructed elements at the end, or
+    // uninitialized ones if value_init is false
+    void append(size_type n, bool value_init = true);
+
+    // this method grows the storage to new_capacity by moving the elements bitwise,
+    // remapping the storage when the allocator can; returns false, leaving the storage
+    // untouched, unless the elements are trivially relocatable
+    bool relocate_storage(size_type new_capacity);
 
     // this method performs insertion from a fill value
     void fill_insert(iterator position, size_type n, const T &x);
@@ -27,6 +27,7 @@
 #include <thrust/detail/minmax.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/detail/allocator/relocate_range.h>
 
 #include <stdexcept>
 
@@ -71,6 +72,24 @@ template<typename T, typename Alloc>
   default_init(n);
 } // end vector_base::vector_base()
 
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, no_init_t)
+      :m_storage(),
+       m_size(0)
+{
+  default_init(n, false);
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, no_init_t, const Alloc &alloc)
+      :m_storage(alloc),
+       m_size(0)
+{
+  default_init(n, false);
+} // end vector_base::vector_base()
+
 template<typename T, typename Alloc>
   vector_base<T,Alloc>
     ::vector_base(size_type n, const value_type &value)
@@ -231,14 +250,21 @@ template<typename T, typename Alloc>
 
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
-    ::default_init(size_type n)
+    ::default_init(size_type n, bool value_init)
 {
   if(n > 0)
   {
     m_storage.allocate(n);
     m_size = n;
 
-    m_storage.default_construct_n(begin(), size());
+    if(value_init)
+    {
+      m_storage.default_construct_n(begin(), size());
+    }
+    else
+    {
+      m_storage.default_init_n(begin(), size());
+    }
   } // end if
 } // end vector_base::default_init()
 
@@ -362,6 +388,22 @@ template<typename T, typename Alloc>
   } // end else
 } // end vector_base::resize()
 
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::resize(size_type new_size, no_init_t)
+{
+  if(new_size < size())
+  {
+    iterator new_end = begin();
+    thrust::advance(new_end, new_size);
+    erase(new_end, end());
+  } // end if
+  else
+  {
+    append(new_size - size(), false);
+  } // end else
+} // end vector_base::resize()
+
 template<typename T, typename Alloc>
   THRUST_HOST_DEVICE
   typename vector_base<T,Alloc>::size_type
@@ -392,6 +434,12 @@ template<typename T, typename Alloc>
     // do not exceed maximum storage
     new_capacity = thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
 
+    // trivially relocatable elements are moved without copying them
+    if(relocate_storage(new_capacity))
+    {
+      return;
+    } // end if
+
     // create new storage
     storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
@@ -875,34 +923,60 @@ template<typename T, typename Alloc>
 
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
-      // record how many constructors we invoke in the try block below
-      iterator new_end = new_storage.begin();
-
-      try
+      if(is_trivially_relocatable_with_allocator<Alloc,T>::value)
       {
-        // construct copy elements before the insertion to the beginning of the newly
-        // allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), position, new_storage.begin());
-
-        // construct copy elements to insert
-        new_end = m_storage.uninitialized_copy(first, last, new_end);
-
-        // construct copy displaced elements from the old storage to the new storage
-        // remember [position, end()) refers to the old storage
-        new_end = m_storage.uninitialized_copy(position, end(), new_end);
-      } // end try
-      catch(...)
+        // the new elements are constructed first, in the gap they will occupy
+        const size_type num_leading_elements = position - begin();
+
+        try
+        {
+          m_storage.uninitialized_copy(first, last, new_storage.begin() + num_leading_elements);
+        } // end try
+        catch(...)
+        {
+          // something went wrong, so deallocate the new storage
+          new_storage.deallocate();
+
+          // rethrow
+          throw;
+        } // end catch
+
+        // then the existing elements are moved around them, and the old storage is
+        // deallocated without calling destructors
+        m_storage.relocate(begin(), position, new_storage.begin());
+        m_storage.relocate(position, end(), new_storage.begin() + num_leading_elements + num_new_elements);
+      } // end if
+      else
       {
-        // something went wrong, so destroy & deallocate the new storage
-        m_storage.destroy(new_storage.begin(), new_end);
-        new_storage.deallocate();
-
-        // rethrow
-        throw;
-      } // end catch
-
-      // call destructors on the elements in the old storage
-      m_storage.destroy(begin(), end());
+        // record how many constructors we invoke in the try block below
+        iterator new_end = new_storage.begin();
+
+        try
+        {
+          // construct copy elements before the insertion to the beginning of the newly
+          // allocated storage
+          new_end = m_storage.uninitialized_copy(begin(), position, new_storage.begin());
+
+          // construct copy elements to insert
+          new_end = m_storage.uninitialized_copy(first, last, new_end);
+
+          // construct copy displaced elements from the old storage to the new storage
+          // remember [position, end()) refers to the old storage
+          new_end = m_storage.uninitialized_copy(position, end(), new_end);
+        } // end try
+        catch(...)
+        {
+          // something went wrong, so destroy & deallocate the new storage
+          m_storage.destroy(new_storage.begin(), new_end);
+          new_storage.deallocate();
+
+          // rethrow
+          throw;
+        } // end catch
+
+        // call destructors on the elements in the old storage
+        m_storage.destroy(begin(), end());
+      } // end else
 
       // record the vector's new state
       m_storage.swap(new_storage);
@@ -913,7 +987,7 @@ template<typename T, typename Alloc>
 
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
-    ::append(size_type n)
+    ::append(size_type n, bool value_init)
 {
   if(n != 0)
   {
@@ -922,7 +996,14 @@ template<typename T, typename Alloc>
       // we've got room for all of them
 
       // default construct new elements at the end of the vector
-      m_storage.default_construct_n(end(), n);
+      if(value_init)
+      {
+        m_storage.default_construct_n(end(), n);
+      }
+      else
+      {
+        m_storage.default_init_n(end(), n);
+      }
 
       // extend the size
       m_size += n;
@@ -940,6 +1021,14 @@ template<typename T, typename Alloc>
       // do not exceed maximum storage
       new_capacity = thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
 
+      // trivially relocatable elements are moved without copying them, which
+      // leaves room for the new elements
+      if(relocate_storage(new_capacity))
+      {
+        append(n, value_init);
+        return;
+      } // end if
+
       // create new storage
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
@@ -952,7 +1041,14 @@ template<typename T, typename Alloc>
         new_end = m_storage.uninitialized_copy(begin(), end(), new_storage.begin());
 
         // construct new elements to insert
-        new_storage.default_construct_n(new_end, n);
+        if(value_init)
+        {
+          new_storage.default_construct_n(new_end, n);
+        }
+        else
+        {
+          new_storage.default_init_n(new_end, n);
+        }
         new_end += n;
       } // end try
       catch(...)
@@ -975,6 +1071,31 @@ template<typename T, typename Alloc>
   } // end if
 } // end vector_base::append()
 
+template<typename T, typename Alloc>
+  bool vector_base<T,Alloc>
+    ::relocate_storage(size_type new_capacity)
+{
+  if(!is_trivially_relocatable_with_allocator<Alloc,T>::value)
+  {
+    return false;
+  } // end if
+
+  // the allocator may be able to resize the storage without copying it, for instance
+  // by remapping its pages
+  if(m_storage.reallocate(new_capacity))
+  {
+    return true;
+  } // end if
+
+  // otherwise, the elements are copied bitwise into new storage, which can't throw, and
+  // the old storage is deallocated without calling destructors
+  storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
+  m_storage.relocate(begin(), end(), new_storage.begin());
+  m_storage.swap(new_storage);
+
+  return true;
+} // end vector_base::relocate_storage()
+
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::fill_insert(iterator position, size_type n, const T &x)
@@ -1043,35 +1164,62 @@ template<typename T, typename Alloc>
 
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
-      // record how many constructors we invoke in the try block below
-      iterator new_end = new_storage.begin();
-
-      try
+      if(is_trivially_relocatable_with_allocator<Alloc,T>::value)
       {
-        // construct copy elements before the insertion to the beginning of the newly
-        // allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), position, new_storage.begin());
-
-        // construct new elements to insert
-        m_storage.uninitialized_fill_n(new_end, n, x);
-        new_end += n;
-
-        // construct copy displaced elements from the old storage to the new storage
-        // remember [position, end()) refers to the old storage
-        new_end = m_storage.uninitialized_copy(position, end(), new_end);
-      } // end try
-      catch(...)
+        // x may refer to an element of this vector, so the storage is not remapped; the
+        // new elements are constructed first, in the gap they will occupy
+        const size_type num_leading_elements = position - begin();
+
+        try
+        {
+          m_storage.uninitialized_fill_n(new_storage.begin() + num_leading_elements, n, x);
+        } // end try
+        catch(...)
+        {
+          // something went wrong, so deallocate the new storage
+          new_storage.deallocate();
+
+          // rethrow
+          throw;
+        } // end catch
+
+        // then the existing elements are moved around them, and the old storage is
+        // deallocated without calling destructors
+        m_storage.relocate(begin(), position, new_storage.begin());
+        m_storage.relocate(position, end(), new_storage.begin() + num_leading_elements + n);
+      } // end if
+      else
       {
-        // something went wrong, so destroy & deallocate the new storage
-        m_storage.destroy(new_storage.begin(), new_end);
-        new_storage.deallocate();
-
-        // rethrow
-        throw;
-      } // end catch
-
-      // call destructors on the elements in the old storage
-      m_storage.destroy(begin(), end());
+        // record how many constructors we invoke in the try block below
+        iterator new_end = new_storage.begin();
+
+        try
+        {
+          // construct copy elements before the insertion to the beginning of the newly
+          // allocated storage
+          new_end = m_storage.uninitialized_copy(begin(), position, new_storage.begin());
+
+          // construct new elements to insert
+          m_storage.uninitialized_fill_n(new_end, n, x);
+          new_end += n;
+
+          // construct copy displaced elements from the old storage to the new storage
+          // remember [position, end()) refers to the old storage
+          new_end = m_storage.uninitialized_copy(position, end(), new_end);
+        } // end try
+        catch(...)
+        {
+          // something went wrong, so destroy & deallocate the new storage
+          m_storage.destroy(new_storage.begin(), new_end);
+          new_storage.deallocate();
+
+          // rethrow
+          throw;
+        } // end catch
+
+        // call destructors on the elements in the old storage
+        m_storage.destroy(begin(), end());
+      } // end else
 
       // record the vector's new state
       m_storage.swap(new_storage);
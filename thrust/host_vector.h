@@ -101,6 +101,25 @@ template<typename T, typename Alloc = std::allocator<T> >
     explicit host_vector(size_type n, const Alloc &alloc)
       :Parent(n,alloc) {}
 
+    /*! This constructor creates a \p host_vector with the given size, and
+     *  leaves its elements uninitialized when their type is trivially
+     *  default constructible. Other elements are default constructed.
+     *  \param n The number of elements to initially create.
+     */
+    THRUST_HOST
+    host_vector(size_type n, no_init_t)
+      :Parent(n,no_init) {}
+
+    /*! This constructor creates a \p host_vector with the given size, and
+     *  leaves its elements uninitialized when their type is trivially
+     *  default constructible. Other elements are default constructed.
+     *  \param n The number of elements to initially create.
+     *  \param alloc The allocator to use by this host_vector.
+     */
+    THRUST_HOST
+    host_vector(size_type n, no_init_t, const Alloc &alloc)
+      :Parent(n,no_init,alloc) {}
+
     /*! This constructor creates a \p host_vector with copies
      *  of an exemplar element.
      *  \param n The number of elements to initially create.
@@ -268,6 +287,18 @@ template<typename T, typename Alloc = std::allocator<T> >
      */
     void resize(size_type new_size, const value_type &x = value_type());
 
+    /*! \brief Resizes this vector to the specified number of elements.
+     *  \param new_size Number of elements this vector should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  This method will resize this vector to the specified number of
+     *  elements.  If the number is smaller than this vector's current
+     *  size this vector is truncated, otherwise this vector is
+     *  extended and new elements are left uninitialized when their type
+     *  is trivially default constructible.
+     */
+    void resize(size_type new_size, no_init_t);
+
     /*! Returns the number of elements in this vector.
      */
     size_type size(void) const;
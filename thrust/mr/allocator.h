@@ -138,6 +138,19 @@ public:
         return mem_res->do_deallocate(p, n * sizeof(T), alignof(T));
     }
 
+    /*! Resizes storage for objects of type \p T without copying it, if the memory resource is able to.
+     *
+     *  \param p pointer returned by a previous call to \p allocate
+     *  \param old_n number of elements, passed as an argument to the \p allocate call that produced \p p
+     *  \param new_n number of elements the storage is resized to
+     *  \return a pointer to the resized storage, which replaces \p p, or a null pointer if \p p is left untouched.
+     */
+    THRUST_HOST
+    pointer reallocate(pointer p, size_type old_n, size_type new_n)
+    {
+        return static_cast<pointer>(mem_res->do_reallocate(p, old_n * sizeof(T), new_n * sizeof(T), alignof(T)));
+    }
+
     /*! Extracts the memory resource used by this allocator.
      *
      *  \return the memory resource used by this allocator.
@@ -0,0 +1,316 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief Mapping of host memory pages, used by the huge page and NUMA memory resources.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/system/detail/bad_alloc.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__linux__)
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  define THRUST_MR_HOST_PAGES_MMAP 1
+#else
+#  define THRUST_MR_HOST_PAGES_MMAP 0
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+// pages are mapped directly from the operating system where it is possible; everywhere
+// else, the resources built on top of this fall back to operator new
+struct host_pages
+{
+    static const bool available = THRUST_MR_HOST_PAGES_MMAP != 0;
+
+    // the interleave policy of the mbind system call, from <numaif.h>, which is only
+    // present where libnuma is installed
+    static const int mpol_interleave = 3;
+
+    static std::size_t round_up(std::size_t bytes, std::size_t granularity)
+    {
+        return (bytes + granularity - 1) / granularity * granularity;
+    }
+
+    static std::size_t page_size()
+    {
+#if THRUST_MR_HOST_PAGES_MMAP
+        static const std::size_t size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return size;
+#else
+        return 4096;
+#endif
+    }
+
+    // the size of the default huge pages, which is also the size transparent huge pages
+    // are made of; 2 MiB when the system doesn't say
+    static std::size_t huge_page_size()
+    {
+        static const std::size_t size = read_huge_page_size();
+        return size;
+    }
+
+    // maps zero-initialized pages of at least the given size, aligned to alignment, which
+    // must be a multiple of the page size; returns nullptr on failure
+    static void * map(std::size_t bytes, std::size_t alignment)
+    {
+#if THRUST_MR_HOST_PAGES_MMAP
+        // map more than needed, and unmap the unaligned head and the tail
+        std::size_t length = bytes + alignment - page_size();
+        void * p = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        char * begin = static_cast<char *>(p);
+        char * aligned = begin + (alignment - reinterpret_cast<std::size_t>(begin) % alignment) % alignment;
+        if (aligned != begin)
+        {
+            ::munmap(begin, aligned - begin);
+        }
+        if (aligned + bytes != begin + length)
+        {
+            ::munmap(aligned + bytes, begin + length - (aligned + bytes));
+        }
+
+        return aligned;
+#else
+        (void)bytes;
+        (void)alignment;
+        return nullptr;
+#endif
+    }
+
+    // maps pages from the pool of explicit huge pages; bytes must be a multiple of the
+    // huge page size. Returns nullptr when there are not enough free huge pages
+    static void * map_huge(std::size_t bytes)
+    {
+#if THRUST_MR_HOST_PAGES_MMAP && defined(MAP_HUGETLB)
+        void * p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        return p == MAP_FAILED ? nullptr : p;
+#else
+        (void)bytes;
+        return nullptr;
+#endif
+    }
+
+    static void unmap(void * p, std::size_t bytes)
+    {
+#if THRUST_MR_HOST_PAGES_MMAP
+        ::munmap(p, bytes);
+#else
+        (void)p;
+        (void)bytes;
+#endif
+    }
+
+    // resizes a mapping made by map, keeping its contents without copying them: the pages
+    // are grown in place when the address range after them is free, and moved to a new
+    // range, aligned to alignment, otherwise. Both sizes must be multiples of the page size.
+    // Returns nullptr, leaving the mapping untouched, on failure
+    static void * remap(void * p, std::size_t old_bytes, std::size_t new_bytes, std::size_t alignment)
+    {
+#if THRUST_MR_HOST_PAGES_MMAP && defined(MREMAP_MAYMOVE) && defined(MREMAP_FIXED)
+        void * q = ::mremap(p, old_bytes, new_bytes, 0);
+        if (q != MAP_FAILED)
+        {
+            return q;
+        }
+
+        // mremap can't align the range it moves the pages to, so an aligned range is mapped
+        // first, and the old pages are moved over its head
+        q = map(new_bytes, alignment);
+        if (!q)
+        {
+            return nullptr;
+        }
+        if (::mremap(p, old_bytes, old_bytes, MREMAP_MAYMOVE | MREMAP_FIXED, q) == MAP_FAILED)
+        {
+            unmap(q, new_bytes);
+            return nullptr;
+        }
+
+        return q;
+#else
+        (void)p;
+        (void)old_bytes;
+        (void)new_bytes;
+        (void)alignment;
+        return nullptr;
+#endif
+    }
+
+    // asks for the pages to be backed by transparent huge pages; only a hint, so failures
+    // (a kernel without THP, or with THP disabled) are ignored
+    static void advise_huge(void * p, std::size_t bytes)
+    {
+#if THRUST_MR_HOST_PAGES_MMAP && defined(MADV_HUGEPAGE)
+        ::madvise(p, bytes, MADV_HUGEPAGE);
+#else
+        (void)p;
+        (void)bytes;
+#endif
+    }
+
+    // interleaves the pages across all NUMA nodes that have memory; does nothing on systems
+    // with a single node, or without NUMA support
+    static void interleave(void * p, std::size_t bytes)
+    {
+#if THRUST_MR_HOST_PAGES_MMAP && defined(SYS_mbind)
+        static const node_mask nodes = read_node_mask();
+        if (nodes.count < 2)
+        {
+            return;
+        }
+
+        // the kernel ignores the last bit of the mask, so it is given one bit more, like libnuma does
+        ::syscall(SYS_mbind, p, bytes, mpol_interleave, nodes.bits, nodes.max_node + 2, 0);
+#else
+        (void)p;
+        (void)bytes;
+#endif
+    }
+
+    static void * map_or_throw(std::size_t bytes, std::size_t alignment)
+    {
+        void * p = map(bytes, alignment);
+        if (!p)
+        {
+            throw thrust::system::detail::bad_alloc("host_pages::map: mmap failed");
+        }
+        return p;
+    }
+
+    // the nodes the memory can be interleaved across
+    struct node_mask
+    {
+        static const std::size_t max_nodes = 1024;
+        static const std::size_t bits_per_word = sizeof(unsigned long) * 8;
+
+        unsigned long bits[max_nodes / bits_per_word];
+        std::size_t max_node;
+        std::size_t count;
+    };
+
+    // parses a list of ranges, like "0-3,8-11", as printed in sysfs
+    static node_mask parse_node_list(const char * list)
+    {
+        node_mask mask;
+        std::memset(&mask, 0, sizeof(mask));
+
+        const char * p = list;
+        while (*p >= '0' && *p <= '9')
+        {
+            std::size_t first = 0;
+            while (*p >= '0' && *p <= '9')
+            {
+                first = first * 10 + static_cast<std::size_t>(*p++ - '0');
+            }
+
+            std::size_t last = first;
+            if (*p == '-')
+            {
+                ++p;
+                last = 0;
+                while (*p >= '0' && *p <= '9')
+                {
+                    last = last * 10 + static_cast<std::size_t>(*p++ - '0');
+                }
+            }
+
+            for (std::size_t node = first; node <= last && node < node_mask::max_nodes; ++node)
+            {
+                mask.bits[node / node_mask::bits_per_word] |= 1ul << (node % node_mask::bits_per_word);
+                mask.max_node = node;
+                ++mask.count;
+            }
+
+            if (*p == ',')
+            {
+                ++p;
+            }
+        }
+
+        return mask;
+    }
+
+private:
+    static std::size_t read_huge_page_size()
+    {
+        std::size_t size = 0;
+
+#if THRUST_MR_HOST_PAGES_MMAP
+        std::FILE * meminfo = std::fopen("/proc/meminfo", "r");
+        if (meminfo)
+        {
+            char line[128];
+            while (std::fgets(line, sizeof(line), meminfo))
+            {
+                unsigned long kib;
+                if (std::sscanf(line, "Hugepagesize: %lu kB", &kib) == 1)
+                {
+                    size = static_cast<std::size_t>(kib) * 1024;
+                    break;
+                }
+            }
+            std::fclose(meminfo);
+        }
+#endif
+
+        return size ? size : static_cast<std::size_t>(2) << 20;
+    }
+
+    static node_mask read_node_mask()
+    {
+        char list[256] = "";
+
+#if THRUST_MR_HOST_PAGES_MMAP
+        // only the nodes that have memory can hold pages
+        std::FILE * file = std::fopen("/sys/devices/system/node/has_normal_memory", "r");
+        if (!file)
+        {
+            file = std::fopen("/sys/devices/system/node/online", "r");
+        }
+        if (file)
+        {
+            if (!std::fgets(list, sizeof(list), file))
+            {
+                list[0] = '\0';
+            }
+            std::fclose(file);
+        }
+#endif
+
+        return parse_node_list(list);
+    }
+};
+
+} // end detail
+THRUST_NAMESPACE_END
+
+#undef THRUST_MR_HOST_PAGES_MMAP
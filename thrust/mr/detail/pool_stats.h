@@ -0,0 +1,259 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief The counters behind the statistics of the pooling resource adaptors.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/mr/pool_stats.h>
+
+#include <cstddef>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+// kept in host memory by the pools; every update is a no-op unless the statistics
+// were enabled through pool_options::collect_stats
+class pool_stats_recorder
+{
+public:
+    pool_stats_recorder()
+        : m_enabled(false),
+        m_oversized_cached_bytes(0),
+        m_callback(NULL),
+        m_user_data(NULL)
+    {
+        m_stats = mr::pool_stats();
+    }
+
+    void init(bool enabled, std::size_t smallest_block_log2, std::size_t bucket_count)
+    {
+        m_enabled = enabled;
+
+        if (m_enabled)
+        {
+            m_stats.buckets.resize(bucket_count);
+            for (std::size_t i = 0; i < bucket_count; ++i)
+            {
+                m_stats.buckets[i].block_size = static_cast<std::size_t>(1) << (smallest_block_log2 + i);
+                m_stats.buckets[i].blocks = 0;
+                m_stats.buckets[i].blocks_in_use = 0;
+            }
+        }
+    }
+
+    void set_callback(mr::pool_upstream_callback callback, void * user_data)
+    {
+        m_callback = callback;
+        m_user_data = user_data;
+    }
+
+    void allocated_block(std::size_t bucket_idx, bool hit)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        ++m_stats.buckets[bucket_idx].blocks_in_use;
+        allocated(m_stats.buckets[bucket_idx].block_size, hit);
+    }
+
+    void deallocated_block(std::size_t bucket_idx)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        --m_stats.buckets[bucket_idx].blocks_in_use;
+        ++m_stats.deallocations;
+        m_stats.bytes_in_use -= m_stats.buckets[bucket_idx].block_size;
+    }
+
+    // a new chunk of blocks for a bucket
+    void carved_blocks(std::size_t bucket_idx, std::size_t count)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        m_stats.buckets[bucket_idx].blocks += count;
+    }
+
+    // a chunk of blocks for a bucket was returned to upstream
+    void released_blocks(std::size_t bucket_idx, std::size_t count)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        m_stats.buckets[bucket_idx].blocks -= count;
+    }
+
+    void allocated_oversized(std::size_t bytes, bool hit)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        allocated(bytes, hit);
+    }
+
+    void deallocated_oversized(std::size_t bytes)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        ++m_stats.deallocations;
+        m_stats.bytes_in_use -= bytes;
+    }
+
+    // an oversized block of the given full size entered or left the cache
+    void cached_oversized(std::size_t size)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        ++m_stats.oversized_blocks_cached;
+        m_oversized_cached_bytes += size;
+    }
+
+    void reused_oversized(std::size_t size)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        --m_stats.oversized_blocks_cached;
+        m_oversized_cached_bytes -= size;
+    }
+
+    void upstream_allocated(std::size_t bytes, std::size_t alignment, bool oversized)
+    {
+        if (m_callback)
+        {
+            m_callback(bytes, alignment, oversized, m_user_data);
+        }
+
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        ++m_stats.upstream_allocations;
+        m_stats.bytes_upstream += bytes;
+        if (m_stats.bytes_upstream > m_stats.bytes_upstream_high_water)
+        {
+            m_stats.bytes_upstream_high_water = m_stats.bytes_upstream;
+        }
+
+        if (oversized)
+        {
+            ++m_stats.oversized_blocks;
+        }
+    }
+
+    void upstream_deallocated(std::size_t bytes, bool oversized)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        ++m_stats.upstream_deallocations;
+        m_stats.bytes_upstream -= bytes;
+
+        if (oversized)
+        {
+            --m_stats.oversized_blocks;
+        }
+    }
+
+    // everything was returned to upstream; the cumulative counters are kept
+    void released()
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        for (std::size_t i = 0; i < m_stats.buckets.size(); ++i)
+        {
+            m_stats.buckets[i].blocks = 0;
+            m_stats.buckets[i].blocks_in_use = 0;
+        }
+
+        m_stats.bytes_in_use = 0;
+        m_stats.oversized_blocks_cached = 0;
+        m_oversized_cached_bytes = 0;
+    }
+
+    mr::pool_stats snapshot() const
+    {
+        mr::pool_stats ret = m_stats;
+
+        ret.bytes_cached = m_oversized_cached_bytes;
+        for (std::size_t i = 0; i < ret.buckets.size(); ++i)
+        {
+            ret.bytes_cached += (ret.buckets[i].blocks - ret.buckets[i].blocks_in_use) * ret.buckets[i].block_size;
+        }
+
+        return ret;
+    }
+
+private:
+    void allocated(std::size_t bytes, bool hit)
+    {
+        ++m_stats.allocations;
+        if (hit)
+        {
+            ++m_stats.cache_hits;
+        }
+
+        m_stats.bytes_in_use += bytes;
+        if (m_stats.bytes_in_use > m_stats.bytes_in_use_high_water)
+        {
+            m_stats.bytes_in_use_high_water = m_stats.bytes_in_use;
+        }
+    }
+
+    bool m_enabled;
+    std::size_t m_oversized_cached_bytes;
+
+    mr::pool_upstream_callback m_callback;
+    void * m_user_data;
+
+    mr::pool_stats m_stats;
+};
+
+} // end detail
+THRUST_NAMESPACE_END
+
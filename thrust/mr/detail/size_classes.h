@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief Size classes used by the pooling resource adaptors to segregate cached oversized blocks.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+// sizes are segregated into four classes for every power of two; every size in a
+// class is smaller than every size in the classes above it
+struct pool_size_classes
+{
+    static const std::size_t bits = sizeof(std::size_t) * 8;
+    static const std::size_t count = bits * 4;
+
+    // a binary search for the leading one, which is cheaper on the host than detail::log2
+    static std::size_t floor_log2(std::size_t x)
+    {
+        std::size_t result = 0;
+        for (std::size_t shift = bits / 2; shift > 0; shift /= 2)
+        {
+            if (x >> shift)
+            {
+                x >>= shift;
+                result += shift;
+            }
+        }
+        return result;
+    }
+
+    static std::size_t of(std::size_t size)
+    {
+        if (size < 4)
+        {
+            return size;
+        }
+
+        // the power of two, followed by the two bits after the leading one
+        std::size_t size_log2 = floor_log2(size);
+        return (size_log2 << 2) | ((size >> (size_log2 - 2)) & 3);
+    }
+
+    // the smallest size in a class
+    static std::size_t smallest_size(std::size_t cls)
+    {
+        if (cls < 4)
+        {
+            return cls;
+        }
+
+        return static_cast<std::size_t>(4 | (cls & 3)) << ((cls >> 2) - 2);
+    }
+};
+
+// a set of size classes, used to find the next class that has cached blocks
+class pool_size_class_bitmap
+{
+public:
+    void reset()
+    {
+        for (std::size_t i = 0; i < words; ++i)
+        {
+            m_words[i] = 0;
+        }
+    }
+
+    void insert(std::size_t cls)
+    {
+        m_words[cls / pool_size_classes::bits] |= static_cast<std::size_t>(1) << (cls % pool_size_classes::bits);
+    }
+
+    void erase(std::size_t cls)
+    {
+        m_words[cls / pool_size_classes::bits] &= ~(static_cast<std::size_t>(1) << (cls % pool_size_classes::bits));
+    }
+
+    // the first class in the set, starting from cls; pool_size_classes::count if there's none
+    std::size_t next(std::size_t cls) const
+    {
+        std::size_t word = cls / pool_size_classes::bits;
+        if (word >= words)
+        {
+            return pool_size_classes::count;
+        }
+
+        std::size_t bits = m_words[word] & (~static_cast<std::size_t>(0) << (cls % pool_size_classes::bits));
+        while (!bits)
+        {
+            if (++word == words)
+            {
+                return pool_size_classes::count;
+            }
+            bits = m_words[word];
+        }
+
+        // the position of the lowest set bit
+        return word * pool_size_classes::bits + pool_size_classes::floor_log2(bits & (static_cast<std::size_t>(0) - bits));
+    }
+
+private:
+    static const std::size_t words = pool_size_classes::count / pool_size_classes::bits;
+
+    std::size_t m_words[words];
+};
+
+} // end detail
+THRUST_NAMESPACE_END
+
@@ -31,8 +31,13 @@
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/pool_options.h>
+#include <thrust/mr/pool_stats.h>
+#include <thrust/mr/detail/pool_stats.h>
+#include <thrust/mr/detail/size_classes.h>
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -96,6 +101,12 @@ public:
         ret.cached_size_cutoff_factor = 16;
         ret.cached_alignment_cutoff_factor = 16;
 
+        ret.collect_stats = false;
+
+        ret.high_watermark = 0;
+        ret.low_watermark = 0;
+        ret.max_cached_age = 0;
+
         return ret;
     }
 
@@ -114,13 +125,24 @@ public:
         m_pools(m_bookkeeper),
         m_allocated(m_bookkeeper),
         m_cached_oversized(m_bookkeeper),
-        m_oversized(m_bookkeeper)
+        m_oversized(m_bookkeeper),
+        m_oversized_count(0),
+        m_upstream_bytes(0),
+        m_trim_threshold(m_options.high_watermark),
+        m_clock(0),
+        m_last_sweep(0)
     {
         assert(m_options.validate());
 
         pointer_vector free(m_bookkeeper);
         pool p(free);
         m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+        oversized_block_vector cached(m_bookkeeper);
+        m_cached_oversized.resize(size_classes::count, cached);
+        m_cached_classes.reset();
+
+        m_stats.init(m_options.collect_stats, m_smallest_block_log2, m_pools.size());
     }
 
     // TODO: C++11: use delegating constructors
@@ -137,13 +159,24 @@ public:
         m_pools(m_bookkeeper),
         m_allocated(m_bookkeeper),
         m_cached_oversized(m_bookkeeper),
-        m_oversized(m_bookkeeper)
+        m_oversized(m_bookkeeper),
+        m_oversized_count(0),
+        m_upstream_bytes(0),
+        m_trim_threshold(m_options.high_watermark),
+        m_clock(0),
+        m_last_sweep(0)
     {
         assert(m_options.validate());
 
         pointer_vector free(m_bookkeeper);
         pool p(free);
         m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+        oversized_block_vector cached(m_bookkeeper);
+        m_cached_oversized.resize(size_classes::count, cached);
+        m_cached_classes.reset();
+
+        m_stats.init(m_options.collect_stats, m_smallest_block_log2, m_pools.size());
     }
 
     /*! Destructor. Releases all held memory to upstream.
@@ -161,6 +194,8 @@ private:
     {
         std::size_t size;
         void_ptr pointer;
+        // whether the last look for stale memory found none of the blocks in use
+        bool unused_at_last_sweep;
     };
 
     typedef thrust::host_vector<
@@ -173,6 +208,8 @@ private:
         std::size_t size;
         std::size_t alignment;
         void_ptr pointer;
+        // the number of allocations made from the pool when the block was cached
+        std::size_t cached_at;
 
         THRUST_HOST_DEVICE
         bool operator==(const oversized_block_descriptor & other) const
@@ -187,24 +224,6 @@ private:
         }
     };
 
-    struct equal_pointers
-    {
-    public:
-        THRUST_HOST_DEVICE
-        equal_pointers(void_ptr p) : p(p)
-        {
-        }
-
-        THRUST_HOST_DEVICE
-        bool operator()(const oversized_block_descriptor & desc) const
-        {
-            return desc.pointer == p;
-        }
-
-    private:
-        void_ptr p;
-    };
-
     struct matching_alignment
     {
     public:
@@ -228,6 +247,11 @@ private:
         allocator<oversized_block_descriptor, Bookkeeper>
     > oversized_block_vector;
 
+    typedef thrust::host_vector<
+        oversized_block_vector,
+        allocator<oversized_block_vector, Bookkeeper>
+    > oversized_class_vector;
+
     typedef thrust::host_vector<
         void_ptr,
         allocator<void_ptr, Bookkeeper>
@@ -273,10 +297,328 @@ private:
     pool_vector m_pools;
     // list of all allocations from upstream for the above
     chunk_vector m_allocated;
-    // list of all cached oversized/overaligned blocks that have been returned to the pool to cache
-    oversized_block_vector m_cached_oversized;
-    // list of all oversized/overaligned allocations from upstream
+    // lists of all cached oversized/overaligned blocks that have been returned to the pool to cache,
+    // one for each size class, each sorted by size and alignment; every block in a class is smaller
+    // than every block in the classes above it, and the nonempty classes are found with a bitmap
+    typedef thrust::detail::pool_size_classes size_classes;
+
+    oversized_class_vector m_cached_oversized;
+    thrust::detail::pool_size_class_bitmap m_cached_classes;
+    // all oversized/overaligned allocations from upstream, in an open addressing hash table keyed
+    // by pointer, with linear probing; a slot is empty when its size is 0
     oversized_block_vector m_oversized;
+    std::size_t m_oversized_count;
+
+    thrust::detail::pool_stats_recorder m_stats;
+
+    // the number of bytes held from upstream, and the number above which the cache is trimmed
+    // before allocating more
+    std::size_t m_upstream_bytes;
+    std::size_t m_trim_threshold;
+
+    // the number of allocations made from the pool, which the age of cached memory is measured in,
+    // and its value when stale memory was last looked for
+    std::size_t m_clock;
+    std::size_t m_last_sweep;
+
+    std::size_t oversized_home(void_ptr p) const
+    {
+        unsigned long long address = static_cast<unsigned long long>(
+            reinterpret_cast<detail::intmax_t>(detail::pointer_traits<void_ptr>::get(p)));
+
+        // the low bits of the addresses are mostly zero, so take the middle bits of
+        // a multiplicative hash
+        return static_cast<std::size_t>((address * 0x9E3779B97F4A7C15ull) >> 32) & (m_oversized.size() - 1);
+    }
+
+    std::size_t oversized_find(void_ptr p) const
+    {
+        std::size_t mask = m_oversized.size() - 1;
+        std::size_t slot = oversized_home(p);
+        while (!(m_oversized[slot].pointer == p))
+        {
+            assert(m_oversized[slot].size != 0);
+            slot = (slot + 1) & mask;
+        }
+
+        return slot;
+    }
+
+    void oversized_place(const oversized_block_descriptor & desc)
+    {
+        std::size_t mask = m_oversized.size() - 1;
+        std::size_t slot = oversized_home(desc.pointer);
+        while (m_oversized[slot].size != 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+
+        m_oversized[slot] = desc;
+    }
+
+    void oversized_insert(const oversized_block_descriptor & desc)
+    {
+        // keep the table at most half full
+        if ((m_oversized_count + 1) * 2 > m_oversized.size())
+        {
+            oversized_block_vector old(m_bookkeeper);
+            old.swap(m_oversized);
+
+            oversized_block_descriptor empty = { 0, 0, void_ptr(), 0 };
+            m_oversized.resize(old.empty() ? 16 : old.size() * 2, empty);
+
+            for (std::size_t i = 0; i < old.size(); ++i)
+            {
+                if (old[i].size != 0)
+                {
+                    oversized_place(old[i]);
+                }
+            }
+        }
+
+        oversized_place(desc);
+        ++m_oversized_count;
+    }
+
+    void oversized_erase(std::size_t slot)
+    {
+        std::size_t mask = m_oversized.size() - 1;
+
+        // shift the following entries of the probe sequence back, so that no lookup
+        // stops early at the emptied slot
+        for (std::size_t next = (slot + 1) & mask; m_oversized[next].size != 0; next = (next + 1) & mask)
+        {
+            std::size_t home = oversized_home(m_oversized[next].pointer);
+            bool reachable = slot <= next ? (slot < home && home <= next) : (slot < home || home <= next);
+            if (!reachable)
+            {
+                m_oversized[slot] = m_oversized[next];
+                slot = next;
+            }
+        }
+
+        oversized_block_descriptor empty = { 0, 0, void_ptr(), 0 };
+        m_oversized[slot] = empty;
+        --m_oversized_count;
+    }
+
+    static detail::intmax_t address_of(void_ptr p)
+    {
+        return reinterpret_cast<detail::intmax_t>(detail::pointer_traits<void_ptr>::get(p));
+    }
+
+    void release_oversized(const oversized_block_descriptor & desc)
+    {
+        oversized_erase(oversized_find(desc.pointer));
+
+        m_upstream->do_deallocate(desc.pointer, desc.size, desc.alignment);
+        m_upstream_bytes -= desc.size;
+
+        m_stats.reused_oversized(desc.size);
+        m_stats.upstream_deallocated(desc.size, true);
+    }
+
+    // releases cached oversized blocks, the largest first; if stale_only, those cached for at least
+    // max_cached_age allocations, and otherwise until at most target_bytes are held from upstream
+    void release_cached_oversized(std::size_t target_bytes, bool stale_only)
+    {
+        for (std::size_t cls = size_classes::count; cls-- > 0;)
+        {
+            if (!stale_only && m_upstream_bytes <= target_bytes)
+            {
+                return;
+            }
+
+            oversized_block_vector & blocks = m_cached_oversized[cls];
+            if (blocks.empty())
+            {
+                continue;
+            }
+
+            if (stale_only)
+            {
+                std::size_t kept = 0;
+                for (std::size_t i = 0; i < blocks.size(); ++i)
+                {
+                    oversized_block_descriptor desc = blocks[i];
+                    if (m_clock - desc.cached_at >= m_options.max_cached_age)
+                    {
+                        release_oversized(desc);
+                    }
+                    else
+                    {
+                        blocks[kept++] = desc;
+                    }
+                }
+                blocks.resize(kept);
+            }
+            else
+            {
+                while (!blocks.empty() && m_upstream_bytes > target_bytes)
+                {
+                    oversized_block_descriptor desc = blocks.back();
+                    blocks.pop_back();
+                    release_oversized(desc);
+                }
+            }
+
+            if (blocks.empty())
+            {
+                m_cached_classes.erase(cls);
+            }
+        }
+    }
+
+    struct chunk_usage
+    {
+        detail::intmax_t begin;
+        std::size_t chunk_idx;
+        std::size_t bucket_idx;
+        std::size_t free_bytes;
+        bool released;
+    };
+
+    // the chunk containing the given address, looked up in chunks sorted by address
+    static chunk_usage & chunk_containing(std::vector<chunk_usage> & chunks, detail::intmax_t address)
+    {
+        typename std::vector<chunk_usage>::iterator it = std::upper_bound(chunks.begin(), chunks.end(), address,
+            [](detail::intmax_t a, const chunk_usage & usage) { return a < usage.begin; });
+        assert(it != chunks.begin());
+        return *(it - 1);
+    }
+
+    // releases chunks none of whose blocks are in use; if stale_only, those that the previous look
+    // for stale memory found unused too, and otherwise until at most target_bytes are held from upstream
+    void release_free_chunks(std::size_t target_bytes, bool stale_only)
+    {
+        std::vector<chunk_usage> chunks(m_allocated.size());
+        for (std::size_t i = 0; i < m_allocated.size(); ++i)
+        {
+            chunks[i].begin = address_of(m_allocated[i].pointer);
+            chunks[i].chunk_idx = i;
+            chunks[i].bucket_idx = 0;
+            chunks[i].free_bytes = 0;
+            chunks[i].released = false;
+        }
+
+        std::sort(chunks.begin(), chunks.end(),
+            [](const chunk_usage & a, const chunk_usage & b) { return a.begin < b.begin; });
+
+        // a chunk is unused when all of its blocks are in the free list of its bucket
+        for (std::size_t i = 0; i < m_pools.size(); ++i)
+        {
+            const pointer_vector & free_blocks = m_pools[i].free_blocks;
+            for (std::size_t j = 0; j < free_blocks.size(); ++j)
+            {
+                chunk_usage & usage = chunk_containing(chunks, address_of(free_blocks[j]));
+                usage.bucket_idx = i;
+                usage.free_bytes += static_cast<std::size_t>(1) << (m_smallest_block_log2 + i);
+            }
+        }
+
+        std::size_t held = m_upstream_bytes;
+        bool any_released = false;
+
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            chunk_descriptor & desc = m_allocated[chunks[i].chunk_idx];
+            bool unused = chunks[i].free_bytes == desc.size;
+
+            if (stale_only)
+            {
+                chunks[i].released = unused && desc.unused_at_last_sweep;
+                desc.unused_at_last_sweep = unused;
+            }
+            else if (unused && held > target_bytes)
+            {
+                chunks[i].released = true;
+                held -= desc.size;
+            }
+
+            any_released = any_released || chunks[i].released;
+        }
+
+        if (!any_released)
+        {
+            return;
+        }
+
+        // remove the blocks of the released chunks from the free lists
+        for (std::size_t i = 0; i < m_pools.size(); ++i)
+        {
+            pointer_vector & free_blocks = m_pools[i].free_blocks;
+
+            std::size_t kept = 0;
+            for (std::size_t j = 0; j < free_blocks.size(); ++j)
+            {
+                void_ptr block = free_blocks[j];
+                if (!chunk_containing(chunks, address_of(block)).released)
+                {
+                    free_blocks[kept++] = block;
+                }
+            }
+            free_blocks.resize(kept);
+        }
+
+        std::vector<bool> released(m_allocated.size(), false);
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            if (!chunks[i].released)
+            {
+                continue;
+            }
+
+            chunk_descriptor desc = m_allocated[chunks[i].chunk_idx];
+            released[chunks[i].chunk_idx] = true;
+
+            m_upstream->do_deallocate(desc.pointer, desc.size, m_options.alignment);
+            m_upstream_bytes -= desc.size;
+
+            m_stats.released_blocks(chunks[i].bucket_idx, desc.size >> (m_smallest_block_log2 + chunks[i].bucket_idx));
+            m_stats.upstream_deallocated(desc.size, false);
+        }
+
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < m_allocated.size(); ++i)
+        {
+            if (!released[i])
+            {
+                m_allocated[kept++] = m_allocated[i];
+            }
+        }
+        m_allocated.resize(kept);
+    }
+
+    void reset_trim_threshold()
+    {
+        m_trim_threshold = (std::max)(
+            m_options.high_watermark,
+            m_upstream_bytes + (m_options.high_watermark - m_options.low_watermark));
+    }
+
+    // called before allocating the given number of bytes from upstream; if the cache can't be
+    // trimmed below the low watermark, it's tried again once the pool has grown by as much as
+    // the distance between the watermarks, and not on every allocation
+    void make_room(std::size_t bytes)
+    {
+        if (m_options.high_watermark != 0 && m_upstream_bytes + bytes > m_trim_threshold)
+        {
+            trim(m_options.low_watermark);
+        }
+    }
+
+    // called once every max_cached_age allocations
+    void release_stale()
+    {
+        release_cached_oversized(0, true);
+        release_free_chunks(0, true);
+
+        m_last_sweep = m_clock;
+        if (m_options.high_watermark != 0)
+        {
+            reset_trim_threshold();
+        }
+    }
 
 public:
     /*! Releases all held memory to upstream.
@@ -297,20 +639,83 @@ public:
                 m_allocated[i].pointer,
                 m_allocated[i].size,
                 m_options.alignment);
+            m_stats.upstream_deallocated(m_allocated[i].size, false);
         }
 
         // deallocate cached oversized/overaligned memory
         for (std::size_t i = 0; i < m_oversized.size(); ++i)
         {
+            if (m_oversized[i].size == 0)
+            {
+                continue;
+            }
+
             m_upstream->do_deallocate(
                 m_oversized[i].pointer,
                 m_oversized[i].size,
                 m_oversized[i].alignment);
+            m_stats.upstream_deallocated(m_oversized[i].size, true);
+        }
+
+        for (std::size_t cls = m_cached_classes.next(0);
+            cls < size_classes::count;
+            cls = m_cached_classes.next(cls + 1))
+        {
+            m_cached_oversized[cls].clear();
         }
 
         m_allocated.clear();
         m_oversized.clear();
-        m_cached_oversized.clear();
+        m_oversized_count = 0;
+        m_cached_classes.reset();
+        m_stats.released();
+
+        m_upstream_bytes = 0;
+        m_trim_threshold = m_options.high_watermark;
+    }
+
+    /*! Releases cached memory to upstream until at most \p target_bytes are held from upstream, or no more cached memory
+     *      can be released: first cached oversized and overaligned blocks, the largest first, then chunks none of whose
+     *      blocks are in use. Unlike with \p release(), the memory in use stays valid.
+     *
+     *  \param target_bytes the number of bytes to keep held from upstream
+     *  \returns the number of bytes returned to upstream
+     */
+    std::size_t trim(std::size_t target_bytes = 0)
+    {
+        std::size_t held = m_upstream_bytes;
+
+        release_cached_oversized(target_bytes, false);
+        if (m_upstream_bytes > target_bytes)
+        {
+            release_free_chunks(target_bytes, false);
+        }
+
+        if (m_options.high_watermark != 0)
+        {
+            reset_trim_threshold();
+        }
+
+        return held - m_upstream_bytes;
+    }
+
+    /*! Returns a snapshot of the statistics of this pool. Unless \p pool_options::collect_stats was set when the pool was
+     *      constructed, every counter is 0.
+     */
+    pool_stats stats() const
+    {
+        return m_stats.snapshot();
+    }
+
+    /*! Sets a function to be called whenever this pool allocates from its upstream resource, or unsets it if \p callback
+     *      is null.
+     *
+     *  \param callback the function to call
+     *  \param user_data a pointer passed to each call of \p callback
+     */
+    void set_upstream_callback(pool_upstream_callback callback, void * user_data = NULL)
+    {
+        m_stats.set_callback(callback, user_data);
     }
 
     THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
@@ -318,61 +723,92 @@ public:
         bytes = (std::max)(bytes, m_options.smallest_block_size);
         assert(detail::is_power_of_2(alignment));
 
+        if (m_options.max_cached_age != 0 && ++m_clock - m_last_sweep >= m_options.max_cached_age)
+        {
+            release_stale();
+        }
+
         // an oversized and/or overaligned allocation requested; needs to be allocated separately
         if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
         {
             oversized_block_descriptor oversized;
             oversized.size = bytes;
             oversized.alignment = alignment;
+            oversized.cached_at = 0;
 
-            if (m_options.cache_oversized && !m_cached_oversized.empty())
+            if (m_options.cache_oversized)
             {
-                typename oversized_block_vector::iterator it = thrust::lower_bound(
-                    thrust::seq,
-                    m_cached_oversized.begin(),
-                    m_cached_oversized.end(),
-                    oversized);
-
-                // if the size is bigger than the requested size by a factor
-                // bigger than or equal to the specified cutoff for size,
-                // allocate a new block
-                if (it != m_cached_oversized.end())
+                const std::size_t first_class = size_classes::of(bytes);
+
+                // the classes are visited in the order of size, so the first block that is big
+                // and aligned enough is the best fit
+                for (std::size_t cls = m_cached_classes.next(first_class);
+                    cls < size_classes::count;
+                    cls = m_cached_classes.next(cls + 1))
                 {
+                    // if even the smallest size in the class is bigger than the requested
+                    // size by a factor bigger than or equal to the specified cutoff for size,
+                    // so is every block in this and the following classes
+                    if (size_classes::smallest_size(cls) / bytes >= m_options.cached_size_cutoff_factor)
+                    {
+                        break;
+                    }
+
+                    oversized_block_vector & blocks = m_cached_oversized[cls];
+                    typename oversized_block_vector::iterator it = blocks.begin();
+                    if (cls == first_class)
+                    {
+                        it = thrust::lower_bound(thrust::seq, blocks.begin(), blocks.end(), oversized);
+                    }
+
+                    it = find_if(it, blocks.end(), matching_alignment(alignment));
+                    if (it == blocks.end())
+                    {
+                        continue;
+                    }
+
+                    // if the size is bigger than the requested size by a factor
+                    // bigger than or equal to the specified cutoff for size,
+                    // allocate a new block
                     std::size_t size_factor = (*it).size / bytes;
                     if (size_factor >= m_options.cached_size_cutoff_factor)
                     {
-                        it = m_cached_oversized.end();
+                        break;
                     }
-                }
 
-                if (it != m_cached_oversized.end() && (*it).alignment < alignment)
-                {
-                    it = find_if(it + 1, m_cached_oversized.end(), matching_alignment(alignment));
-                }
-
-                // if the alignment is bigger than the requested one by a factor
-                // bigger than or equal to the specified cutoff for alignment,
-                // allocate a new block
-                if (it != m_cached_oversized.end())
-                {
+                    // if the alignment is bigger than the requested one by a factor
+                    // bigger than or equal to the specified cutoff for alignment,
+                    // allocate a new block
                     std::size_t alignment_factor = (*it).alignment / alignment;
                     if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
                     {
-                        it = m_cached_oversized.end();
+                        break;
                     }
-                }
 
-                if (it != m_cached_oversized.end())
-                {
+                    // take the most recently cached of the equal blocks, which is the last one,
+                    // so that reusing blocks of a single size erases from the back of the list
+                    it = thrust::upper_bound(thrust::seq, it, blocks.end(), *it) - 1;
+
                     oversized.pointer = (*it).pointer;
-                    m_cached_oversized.erase(it);
+                    m_stats.reused_oversized((*it).size);
+                    m_stats.allocated_oversized(bytes, true);
+                    blocks.erase(it);
+                    if (blocks.empty())
+                    {
+                        m_cached_classes.erase(cls);
+                    }
+
                     return oversized.pointer;
                 }
             }
 
             // no fitting cached block found; allocate a new one that's just up to the specs
+            make_room(bytes);
             oversized.pointer = m_upstream->do_allocate(bytes, alignment);
-            m_oversized.push_back(oversized);
+            m_upstream_bytes += bytes;
+            m_stats.upstream_allocated(bytes, alignment, true);
+            m_stats.allocated_oversized(bytes, false);
+            oversized_insert(oversized);
 
             return oversized.pointer;
         }
@@ -383,6 +819,8 @@ public:
         std::size_t bucket_idx = bytes_log2 - m_smallest_block_log2;
         pool & bucket = m_pools[bucket_idx];
 
+        m_stats.allocated_block(bucket_idx, !bucket.free_blocks.empty());
+
         // if the free list of the bucket has no elements, allocate a new chunk
         // and split it into blocks pushed to the free list
         if (bucket.free_blocks.empty())
@@ -418,9 +856,15 @@ public:
             assert(bytes >= m_options.min_bytes_per_chunk);
             assert(bytes <= m_options.max_bytes_per_chunk);
 
+            make_room(bytes);
+
             chunk_descriptor allocated;
             allocated.size = bytes;
             allocated.pointer = m_upstream->do_allocate(bytes, m_options.alignment);
+            allocated.unused_at_last_sweep = false;
+            m_upstream_bytes += bytes;
+            m_stats.upstream_allocated(bytes, m_options.alignment, false);
+            m_stats.carved_blocks(bucket_idx, n);
             m_allocated.push_back(allocated);
             bucket.previous_allocated_count = n;
 
@@ -451,21 +895,29 @@ public:
         // the deallocated block is oversized and/or overaligned
         if (n > m_options.largest_block_size || alignment > m_options.alignment)
         {
-            typename oversized_block_vector::iterator it = find_if(m_oversized.begin(), m_oversized.end(), equal_pointers(p));
-            assert(it != m_oversized.end());
+            std::size_t slot = oversized_find(p);
+            oversized_block_descriptor oversized = m_oversized[slot];
+            oversized.cached_at = m_clock;
 
-            oversized_block_descriptor oversized = *it;
+            m_stats.deallocated_oversized(n);
 
             if (m_options.cache_oversized)
             {
-                typename oversized_block_vector::iterator position = lower_bound(m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
-                m_cached_oversized.insert(position, oversized);
+                const std::size_t cls = size_classes::of(oversized.size);
+                oversized_block_vector & blocks = m_cached_oversized[cls];
+
+                typename oversized_block_vector::iterator position = thrust::upper_bound(thrust::seq, blocks.begin(), blocks.end(), oversized);
+                blocks.insert(position, oversized);
+                m_cached_classes.insert(cls);
+                m_stats.cached_oversized(oversized.size);
                 return;
             }
 
-            m_oversized.erase(it);
+            oversized_erase(slot);
 
             m_upstream->do_deallocate(p, oversized.size, oversized.alignment);
+            m_upstream_bytes -= oversized.size;
+            m_stats.upstream_deallocated(oversized.size, true);
 
             return;
         }
@@ -475,6 +927,8 @@ public:
         std::size_t bucket_idx = n_log2 - m_smallest_block_log2;
         pool & bucket = m_pools[bucket_idx];
 
+        m_stats.deallocated_block(bucket_idx);
+
         bucket.free_blocks.push_back(p);
     }
 };
@@ -88,6 +88,39 @@ public:
         upstream_pool.release();
     }
 
+    /*! Releases cached memory to upstream until at most \p target_bytes are held from upstream, or no more cached memory
+     *      can be released. Unlike with \p release(), the memory in use stays valid.
+     *
+     *  \param target_bytes the number of bytes to keep held from upstream
+     *  \returns the number of bytes returned to upstream
+     */
+    std::size_t trim(std::size_t target_bytes = 0)
+    {
+        lock_t lock(mtx);
+        return upstream_pool.trim(target_bytes);
+    }
+
+    /*! Returns a snapshot of the statistics of this pool. Unless \p pool_options::collect_stats was set when the pool was
+     *      constructed, every counter is 0.
+     */
+    pool_stats stats() const
+    {
+        lock_t lock(mtx);
+        return upstream_pool.stats();
+    }
+
+    /*! Sets a function to be called whenever this pool allocates from its upstream resource, or unsets it if \p callback
+     *      is null. The function is called with the mutex of the pool held, and must not use the pool.
+     *
+     *  \param callback the function to call
+     *  \param user_data a pointer passed to each call of \p callback
+     */
+    void set_upstream_callback(pool_upstream_callback callback, void * user_data = NULL)
+    {
+        lock_t lock(mtx);
+        upstream_pool.set_upstream_callback(callback, user_data);
+    }
+
     THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
     {
         lock_t lock(mtx);
@@ -101,7 +134,7 @@ public:
     }
 
 private:
-    std::mutex mtx;
+    mutable std::mutex mtx;
     unsync_pool upstream_pool;
 };
 
@@ -78,6 +78,21 @@ public:
             bytes, alignment);
     }
 
+    /*! Resizes memory that was previously allocated with this allocator, if the upstream resource can do it
+     *  without copying. Returns a null pointer otherwise.
+     * \param p - pointer to the memory that was previously allocated by \p do_allocate
+     * \param old_bytes - the size of the allocation that was requested, in bytes
+     * \param new_bytes - the requested new size of the allocation, in bytes
+     * \param alignment - specifies the alignment that was used for the allocation
+     */
+    virtual Pointer do_reallocate(Pointer p, std::size_t old_bytes, std::size_t new_bytes, std::size_t alignment) override
+    {
+        return static_cast<Pointer>(m_upstream->do_reallocate(
+            static_cast<typename Upstream::pointer>(
+                thrust::detail::pointer_traits<Pointer>::get(p)),
+            old_bytes, new_bytes, alignment));
+    }
+
 private:
     Upstream * m_upstream;
 };
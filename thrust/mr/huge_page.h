@@ -0,0 +1,160 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A host memory resource that backs large allocations with huge pages.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/detail/host_pages.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The kinds of huge pages a \p huge_page_resource can use.
+ */
+enum huge_page_mode
+{
+    /*! Ordinary pages that the kernel is asked to back with transparent huge pages, with \p madvise(MADV_HUGEPAGE).
+     */
+    transparent_huge_pages,
+    /*! Pages from the pool of explicit huge pages reserved by the administrator, with \p mmap(MAP_HUGETLB). When the pool
+     *      doesn't have enough free pages, the resource falls back to transparent huge pages.
+     */
+    explicit_huge_pages
+};
+
+/*! A host memory resource that maps large allocations directly from the operating system, backed by huge pages. For
+ *      arrays of many gigabytes, huge pages cut the number of TLB misses by orders of magnitude.
+ *
+ *  Each large allocation is rounded up to a whole number of huge pages, and aligned to the huge page size. Allocations
+ *      smaller than a given size, or with an alignment bigger than a huge page, are served by \p new_delete_resource,
+ *      and so are all allocations on systems that can't map pages directly, which currently means everything but
+ *      Linux. Huge pages are only a hint: a kernel without support for them, or with it disabled, backs the memory with
+ *      ordinary pages.
+ *
+ *  The memory is zero-initialized, and its pages are only placed on a NUMA node when first touched.
+ */
+class huge_page_resource final : public memory_resource<>
+{
+public:
+    /*! The default smallest size of the allocations backed by huge pages, which is the size of a single huge page on most
+     *      systems.
+     */
+    static const std::size_t default_min_bytes = static_cast<std::size_t>(2) << 20;
+
+    /*! Constructor.
+     *
+     *  \param mode the kind of huge pages to use
+     *  \param min_bytes the smallest size of the allocations backed by huge pages
+     */
+    huge_page_resource(huge_page_mode mode = transparent_huge_pages, std::size_t min_bytes = default_min_bytes)
+        : m_mode(mode), m_min_bytes(min_bytes)
+    {
+    }
+
+    THRUST_NODISCARD virtual void * do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        if (!uses_pages(bytes, alignment))
+        {
+            return m_fallback.do_allocate(bytes, alignment);
+        }
+
+        std::size_t huge_page_size = detail::host_pages::huge_page_size();
+        std::size_t size = detail::host_pages::round_up(bytes, huge_page_size);
+
+        if (m_mode == explicit_huge_pages)
+        {
+            void * p = detail::host_pages::map_huge(size);
+            if (p)
+            {
+                return p;
+            }
+        }
+
+        void * p = detail::host_pages::map_or_throw(size, huge_page_size);
+        detail::host_pages::advise_huge(p, size);
+        return p;
+    }
+
+    virtual void do_deallocate(void * p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        if (!uses_pages(bytes, alignment))
+        {
+            m_fallback.do_deallocate(p, bytes, alignment);
+            return;
+        }
+
+        detail::host_pages::unmap(p, detail::host_pages::round_up(bytes, detail::host_pages::huge_page_size()));
+    }
+
+    virtual void * do_reallocate(void * p, std::size_t old_bytes, std::size_t new_bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        // explicit huge pages may come from the reserved pool, whose mappings can't always be moved
+        if (m_mode == explicit_huge_pages || !uses_pages(old_bytes, alignment) || !uses_pages(new_bytes, alignment))
+        {
+            return nullptr;
+        }
+
+        std::size_t huge_page_size = detail::host_pages::huge_page_size();
+        std::size_t old_size = detail::host_pages::round_up(old_bytes, huge_page_size);
+        std::size_t new_size = detail::host_pages::round_up(new_bytes, huge_page_size);
+
+        void * q = detail::host_pages::remap(p, old_size, new_size, huge_page_size);
+        if (q && new_size > old_size)
+        {
+            detail::host_pages::advise_huge(static_cast<char *>(q) + old_size, new_size - old_size);
+        }
+        return q;
+    }
+
+    /*! Returns the kind of huge pages used by this resource.
+     */
+    huge_page_mode mode() const
+    {
+        return m_mode;
+    }
+
+private:
+    bool uses_pages(std::size_t bytes, std::size_t alignment) const
+    {
+        return detail::host_pages::available
+            && bytes >= m_min_bytes
+            && alignment <= detail::host_pages::huge_page_size();
+    }
+
+    huge_page_mode m_mode;
+    std::size_t m_min_bytes;
+
+    new_delete_resource m_fallback;
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
@@ -82,6 +82,23 @@ public:
         do_deallocate(p, bytes, alignment);
     }
 
+    /*! Resizes the allocation pointed to by \p p without copying its contents, if the resource is able to; for
+     *      instance by remapping its pages. The contents are kept up to the smaller of the two sizes.
+     *
+     *  \param p pointer to the allocation to resize
+     *  \param old_bytes the size of the allocation. This must be equivalent to the value of \p bytes that
+     *      was passed to the allocation function that returned \p p.
+     *  \param new_bytes the requested size of the allocation
+     *  \param alignment the alignment of the allocation. This must be equivalent to the value of \p alignment
+     *      that was passed to the allocation function that returned \p p.
+     *  \return A pointer to the resized allocation, which replaces \p p, or a null pointer if the allocation
+     *      can't be resized this way, in which case \p p is left untouched.
+     */
+    pointer reallocate(pointer p, std::size_t old_bytes, std::size_t new_bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT)
+    {
+        return do_reallocate(p, old_bytes, new_bytes, alignment);
+    }
+
     /*! Compares this resource to the other one. The default implementation uses identity comparison,
      *      which is often the right thing to do and doesn't require RTTI involvement.
      *
@@ -113,6 +130,24 @@ public:
      */
     virtual void do_deallocate(pointer p, std::size_t bytes, std::size_t alignment) = 0;
 
+    /*! Resizes the allocation pointed to by \p p without copying its contents, if the resource is able to. The
+     *      default implementation never is.
+     *
+     *  \param p pointer to the allocation to resize
+     *  \param old_bytes the size of the allocation
+     *  \param new_bytes the requested size of the allocation
+     *  \param alignment the alignment of the allocation
+     *  \return A pointer to the resized allocation, or a null pointer if \p p is left untouched.
+     */
+    virtual pointer do_reallocate(pointer p, std::size_t old_bytes, std::size_t new_bytes, std::size_t alignment)
+    {
+        (void)p;
+        (void)old_bytes;
+        (void)new_bytes;
+        (void)alignment;
+        return pointer();
+    }
+
     /*! Compares this resource to the other one. The default implementation uses identity comparison,
      *      which is often the right thing to do and doesn't require RTTI involvement.
      *
@@ -152,6 +187,11 @@ public:
         do_deallocate(p, bytes, alignment);
     }
 
+    pointer reallocate(pointer p, std::size_t old_bytes, std::size_t new_bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT)
+    {
+        return do_reallocate(p, old_bytes, new_bytes, alignment);
+    }
+
     THRUST_HOST_DEVICE
     bool is_equal(const memory_resource & other) const noexcept
     {
@@ -160,6 +200,10 @@ public:
 
     virtual pointer do_allocate(std::size_t bytes, std::size_t alignment) = 0;
     virtual void do_deallocate(pointer p, std::size_t bytes, std::size_t alignment) = 0;
+    virtual pointer do_reallocate(pointer, std::size_t, std::size_t, std::size_t)
+    {
+        return nullptr;
+    }
     THRUST_HOST_DEVICE
     virtual bool do_is_equal(const memory_resource & other) const noexcept
     {
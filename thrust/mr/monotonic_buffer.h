@@ -0,0 +1,286 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A memory resource that allocates by bumping a pointer through buffers obtained from upstream, and frees all of
+ *      its allocations at once.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/integer_math.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/validator.h>
+#include <thrust/system/detail/bad_alloc.h>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A memory resource adaptor that hands out consecutive pieces of large buffers, and never frees them individually. This
+ *      makes an allocation as cheap as bumping a pointer, which suits many short-lived temporary allocations that all die
+ *      at once, such as the temporary storage of the algorithms run on one batch of data.
+ *
+ *  Deallocation does nothing. The memory is reused after \p reset(), which keeps the buffers for the following
+ *      allocations, and returned to upstream by \p release() and the destructor. The resource starts from an optional
+ *      buffer provided by the user; when a buffer runs out, a new one is allocated from upstream, each one twice as big
+ *      as the previous one, or bigger if needed for the allocation.
+ *
+ *  It is not thread safe.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating the buffers
+ */
+template<typename Upstream>
+class monotonic_buffer_resource final
+    : public memory_resource<typename Upstream::pointer>,
+    private validator<Upstream>
+{
+    typedef typename Upstream::pointer void_ptr;
+    typedef typename thrust::detail::pointer_traits<void_ptr>::template rebind<char>::other char_ptr;
+
+public:
+    /*! The size of the first buffer allocated from upstream, unless specified otherwise.
+     */
+    static const std::size_t default_buffer_size = static_cast<std::size_t>(1) << 16;
+
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for allocations
+     *  \param initial_size the size of the first buffer allocated from upstream
+     */
+    monotonic_buffer_resource(Upstream * upstream, std::size_t initial_size = default_buffer_size)
+        : m_upstream(upstream),
+        m_initial_buffer(),
+        m_initial_buffer_size(0),
+        m_initial_size(initial_size ? initial_size : 1)
+    {
+        rewind();
+    }
+
+    /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+     *
+     *  \param initial_size the size of the first buffer allocated from upstream
+     */
+    explicit monotonic_buffer_resource(std::size_t initial_size = default_buffer_size)
+        : m_upstream(get_global_resource<Upstream>()),
+        m_initial_buffer(),
+        m_initial_buffer_size(0),
+        m_initial_size(initial_size ? initial_size : 1)
+    {
+        rewind();
+    }
+
+    /*! Constructor. Allocations are served from \p buffer until it runs out, and only then from buffers allocated from
+     *      upstream. \p buffer is not owned by the resource, and must outlive it.
+     *
+     *  \param buffer the memory to allocate from first
+     *  \param buffer_size the size of \p buffer
+     *  \param upstream the upstream memory resource for allocations
+     */
+    monotonic_buffer_resource(void_ptr buffer, std::size_t buffer_size, Upstream * upstream)
+        : m_upstream(upstream),
+        m_initial_buffer(buffer),
+        m_initial_buffer_size(buffer_size),
+        m_initial_size(buffer_size ? buffer_size * 2 : default_buffer_size)
+    {
+        rewind();
+    }
+
+    /*! Constructor. Allocations are served from \p buffer until it runs out, and only then from buffers allocated from
+     *      upstream, which is obtained by calling \p get_global_resource<Upstream>. \p buffer is not owned by the resource,
+     *      and must outlive it.
+     *
+     *  \param buffer the memory to allocate from first
+     *  \param buffer_size the size of \p buffer
+     */
+    monotonic_buffer_resource(void_ptr buffer, std::size_t buffer_size)
+        : m_upstream(get_global_resource<Upstream>()),
+        m_initial_buffer(buffer),
+        m_initial_buffer_size(buffer_size),
+        m_initial_size(buffer_size ? buffer_size * 2 : default_buffer_size)
+    {
+        rewind();
+    }
+
+    monotonic_buffer_resource(const monotonic_buffer_resource &) = delete;
+    monotonic_buffer_resource & operator=(const monotonic_buffer_resource &) = delete;
+
+    /*! Destructor. Releases all held memory to upstream.
+     */
+    ~monotonic_buffer_resource()
+    {
+        release();
+    }
+
+    /*! Makes the memory of all allocations available again, without returning it to upstream. The memory of all
+     *      allocations made so far must not be used after this.
+     */
+    void reset()
+    {
+        rewind();
+    }
+
+    /*! Releases all memory allocated from upstream. The memory of all allocations made so far must not be used after
+     *      this. The next allocations start from the buffer provided by the user, if any.
+     */
+    void release()
+    {
+        for (std::size_t i = 0; i < m_buffers.size(); ++i)
+        {
+            m_upstream->do_deallocate(m_buffers[i].pointer, m_buffers[i].size, m_buffers[i].alignment);
+        }
+
+        m_buffers.clear();
+        m_next_size = m_initial_size;
+        rewind();
+    }
+
+    /*! Returns the upstream memory resource.
+     */
+    Upstream * upstream_resource() const
+    {
+        return m_upstream;
+    }
+
+    THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        assert(detail::is_power_of_2(alignment));
+
+        // an empty allocation still takes a byte, so that it never returns a null pointer
+        if (bytes == 0)
+        {
+            bytes = 1;
+        }
+
+        std::size_t padding = padding_for(m_current, alignment);
+        if (padding > m_space || bytes > m_space - padding)
+        {
+            next_buffer(bytes, alignment);
+            padding = padding_for(m_current, alignment);
+        }
+
+        char_ptr ret = m_current + padding;
+        m_current = ret + bytes;
+        m_space -= padding + bytes;
+
+        return static_cast<void_ptr>(ret);
+    }
+
+    virtual void do_deallocate(void_ptr, std::size_t, std::size_t = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        // the memory is only reused after a reset or a release
+    }
+
+private:
+    struct buffer
+    {
+        void_ptr pointer;
+        std::size_t size;
+        std::size_t alignment;
+    };
+
+    Upstream * m_upstream;
+
+    void_ptr m_initial_buffer;
+    std::size_t m_initial_buffer_size;
+
+    // the size of the first buffer allocated from upstream, and of the next one
+    std::size_t m_initial_size;
+    std::size_t m_next_size;
+
+    // all buffers allocated from upstream, in the order they are used in; the ones after
+    // m_next_buffer were kept by a reset
+    std::vector<buffer> m_buffers;
+    std::size_t m_next_buffer;
+
+    char_ptr m_current;
+    std::size_t m_space;
+
+    static std::size_t padding_for(char_ptr p, std::size_t alignment)
+    {
+        std::size_t address = static_cast<std::size_t>(
+            reinterpret_cast<detail::intmax_t>(thrust::detail::pointer_traits<char_ptr>::get(p)));
+        return (alignment - address % alignment) % alignment;
+    }
+
+    void rewind()
+    {
+        if (m_buffers.empty())
+        {
+            m_next_size = m_initial_size;
+        }
+
+        m_next_buffer = 0;
+        m_current = static_cast<char_ptr>(m_initial_buffer);
+        m_space = m_initial_buffer_size;
+    }
+
+    void next_buffer(std::size_t bytes, std::size_t alignment)
+    {
+        // the buffers kept by a reset are used in order, skipping the ones too small for this allocation
+        while (m_next_buffer < m_buffers.size())
+        {
+            const buffer & b = m_buffers[m_next_buffer++];
+            std::size_t padding = padding_for(static_cast<char_ptr>(b.pointer), alignment);
+            if (padding <= b.size && bytes <= b.size - padding)
+            {
+                m_current = static_cast<char_ptr>(b.pointer);
+                m_space = b.size;
+                return;
+            }
+        }
+
+        buffer b;
+        b.size = m_next_size;
+        while (b.size < bytes)
+        {
+            if (b.size > (std::numeric_limits<std::size_t>::max)() / 2)
+            {
+                throw thrust::system::detail::bad_alloc("monotonic_buffer_resource::do_allocate: size overflow");
+            }
+            b.size *= 2;
+        }
+        b.alignment = (std::max)(alignment, static_cast<std::size_t>(THRUST_MR_DEFAULT_ALIGNMENT));
+        b.pointer = m_upstream->do_allocate(b.size, b.alignment);
+
+        m_buffers.push_back(b);
+        m_next_buffer = m_buffers.size();
+        m_next_size = b.size > (std::numeric_limits<std::size_t>::max)() / 2 ? b.size : b.size * 2;
+
+        m_current = static_cast<char_ptr>(b.pointer);
+        m_space = b.size;
+    }
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,173 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A host memory resource that controls how large allocations are placed on NUMA nodes.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/detail/host_pages.h>
+
+#include <algorithm>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The ways a \p numa_resource can place the pages of an allocation on NUMA nodes.
+ */
+enum numa_placement
+{
+    /*! The pages are spread round-robin across all nodes with memory, so that every node serves an equal share of the
+     *      accesses, whichever threads make them.
+     */
+    numa_interleave,
+    /*! Each page is placed on the node of the thread that first touches it. The memory is freshly mapped and untouched,
+     *      so initializing it in parallel with the threads that later process it keeps their accesses local.
+     */
+    numa_first_touch
+};
+
+/*! A host memory resource that maps large allocations directly from the operating system, and places their pages on NUMA
+ *      nodes according to a given policy. Allocated through \p new_delete_resource, a large array reuses pages a
+ *      single thread has already touched, or gets touched by the thread that constructs it, which puts it all on one
+ *      node whose memory bandwidth then limits every thread.
+ *
+ *  Each large allocation is rounded up to a whole number of pages, or of huge pages if requested. Allocations smaller
+ *      than a given size are served by \p new_delete_resource, and so are all allocations on systems that can't map
+ *      pages directly, which currently means everything but Linux. On machines with a single NUMA node, interleaving
+ *      does nothing. The memory is zero-initialized.
+ */
+class numa_resource final : public memory_resource<>
+{
+public:
+    /*! The default smallest size of the allocations mapped from the operating system.
+     */
+    static const std::size_t default_min_bytes = static_cast<std::size_t>(1) << 20;
+
+    /*! Constructor.
+     *
+     *  \param placement how to place the pages on NUMA nodes
+     *  \param huge_pages whether to ask for the memory to be backed by transparent huge pages
+     *  \param min_bytes the smallest size of the allocations mapped from the operating system
+     */
+    numa_resource(numa_placement placement = numa_interleave, bool huge_pages = false, std::size_t min_bytes = default_min_bytes)
+        : m_placement(placement), m_huge_pages(huge_pages), m_min_bytes(min_bytes)
+    {
+    }
+
+    THRUST_NODISCARD virtual void * do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        if (!uses_pages(bytes))
+        {
+            return m_fallback.do_allocate(bytes, alignment);
+        }
+
+        std::size_t granularity = page_granularity();
+        std::size_t size = detail::host_pages::round_up(bytes, granularity);
+
+        void * p = detail::host_pages::map_or_throw(size, (std::max)(granularity, alignment));
+        if (m_huge_pages)
+        {
+            detail::host_pages::advise_huge(p, size);
+        }
+        if (m_placement == numa_interleave)
+        {
+            detail::host_pages::interleave(p, size);
+        }
+
+        return p;
+    }
+
+    virtual void do_deallocate(void * p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        if (!uses_pages(bytes))
+        {
+            m_fallback.do_deallocate(p, bytes, alignment);
+            return;
+        }
+
+        detail::host_pages::unmap(p, detail::host_pages::round_up(bytes, page_granularity()));
+    }
+
+    virtual void * do_reallocate(void * p, std::size_t old_bytes, std::size_t new_bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        if (!uses_pages(old_bytes) || !uses_pages(new_bytes))
+        {
+            return nullptr;
+        }
+
+        std::size_t granularity = page_granularity();
+        std::size_t old_size = detail::host_pages::round_up(old_bytes, granularity);
+        std::size_t new_size = detail::host_pages::round_up(new_bytes, granularity);
+
+        void * q = detail::host_pages::remap(p, old_size, new_size, (std::max)(granularity, alignment));
+        if (q && new_size > old_size)
+        {
+            // the moved pages keep their placement; only the new ones need it
+            char * tail = static_cast<char *>(q) + old_size;
+            if (m_huge_pages)
+            {
+                detail::host_pages::advise_huge(tail, new_size - old_size);
+            }
+            if (m_placement == numa_interleave)
+            {
+                detail::host_pages::interleave(tail, new_size - old_size);
+            }
+        }
+        return q;
+    }
+
+    /*! Returns how this resource places pages on NUMA nodes.
+     */
+    numa_placement placement() const
+    {
+        return m_placement;
+    }
+
+private:
+    bool uses_pages(std::size_t bytes) const
+    {
+        return detail::host_pages::available && bytes >= m_min_bytes;
+    }
+
+    std::size_t page_granularity() const
+    {
+        return m_huge_pages ? detail::host_pages::huge_page_size() : detail::host_pages::page_size();
+    }
+
+    numa_placement m_placement;
+    bool m_huge_pages;
+    std::size_t m_min_bytes;
+
+    new_delete_resource m_fallback;
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
@@ -68,6 +68,18 @@ public:
         return upstream_resource->deallocate(p, bytes, alignment);
     }
 
+    /*! Resizes memory that was previously allocated with this allocator, if the upstream resource can do it
+     * without copying. Returns a null pointer otherwise.
+     * \param p - pointer to the memory that was previously allocated by \p do_allocate
+     * \param old_bytes - the size of the allocation that was requested, in bytes
+     * \param new_bytes - the requested new size of the allocation, in bytes
+     * \param alignment - specifies the alignment that was used for the allocation
+     */
+    virtual Pointer do_reallocate(Pointer p, std::size_t old_bytes, std::size_t new_bytes, std::size_t alignment) override
+    {
+        return upstream_resource->reallocate(p, old_bytes, new_bytes, alignment);
+    }
+
     /*! Compares this \p polymorphic_adaptor_resource with another \p memory_resource
      * to see if they are equal.
      */
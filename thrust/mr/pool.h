@@ -31,8 +31,13 @@
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/pool_options.h>
+#include <thrust/mr/pool_stats.h>
+#include <thrust/mr/detail/pool_stats.h>
+#include <thrust/mr/detail/size_classes.h>
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -93,6 +98,12 @@ public:
         ret.cached_size_cutoff_factor = 16;
         ret.cached_alignment_cutoff_factor = 16;
 
+        ret.collect_stats = false;
+
+        ret.high_watermark = 0;
+        ret.low_watermark = 0;
+        ret.max_cached_age = 0;
+
         return ret;
     }
 
@@ -108,12 +119,19 @@ public:
         m_pools(upstream),
         m_allocated(),
         m_oversized(),
-        m_cached_oversized()
+        m_upstream_bytes(0),
+        m_trim_threshold(m_options.high_watermark),
+        m_clock(0),
+        m_last_sweep(0)
     {
         assert(m_options.validate());
 
+        reset_cached_oversized();
+
         pool p = { block_descriptor_ptr(), 0 };
         m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+        m_stats.init(m_options.collect_stats, m_smallest_block_log2, m_pools.size());
     }
 
     // TODO: C++11: use delegating constructors
@@ -129,12 +147,19 @@ public:
         m_pools(get_global_resource<Upstream>()),
         m_allocated(),
         m_oversized(),
-        m_cached_oversized()
+        m_upstream_bytes(0),
+        m_trim_threshold(m_options.high_watermark),
+        m_clock(0),
+        m_last_sweep(0)
     {
         assert(m_options.validate());
 
+        reset_cached_oversized();
+
         pool p = { block_descriptor_ptr(), 0 };
         m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+        m_stats.init(m_options.collect_stats, m_smallest_block_log2, m_pools.size());
     }
 
     /*! Destructor. Releases all held memory to upstream.
@@ -145,6 +170,9 @@ public:
     }
 
 private:
+    // trims the oversized blocks held by this pool together with its own chunks
+    template<typename> friend class sharded_pool_resource;
+
     typedef typename Upstream::pointer void_ptr;
     typedef thrust::detail::pointer_traits<void_ptr> void_ptr_traits;
     typedef typename void_ptr_traits::template rebind<char>::other char_ptr;
@@ -167,12 +195,14 @@ private:
     {
         std::size_t size;
         chunk_descriptor_ptr next;
+        // whether the last look for stale memory found none of the blocks in use
+        bool unused_at_last_sweep;
     };
 
     // this was originally a forward list, but I made it a doubly linked list
     // because that way deallocation when not caching is faster and doesn't require
-    // traversal of a linked list (it's still a forward list for the cached list,
-    // because allocation from that list already traverses)
+    // traversal of a linked list (it's still a forward list for the cached lists,
+    // because allocation from those lists already traverses)
     //
     // TODO: investigate whether it's better to have this be a doubly-linked list
     // with fast do_deallocate when !m_options.cache_oversized, or to have this be
@@ -189,6 +219,8 @@ private:
         oversized_block_descriptor_ptr next;
         oversized_block_descriptor_ptr next_cached;
         std::size_t current_size;
+        // the number of allocations made from the pool when the block was cached
+        std::size_t cached_at;
     };
 
     struct pool
@@ -207,10 +239,342 @@ private:
     pool_options m_options;
     std::size_t m_smallest_block_log2;
 
+    // cached oversized blocks are segregated by size class; every block in a class
+    // above the class of a request is large enough for it, so only the list of the
+    // request's own class is searched for a fit, and the next nonempty class is found
+    // with a bitmap
+    typedef thrust::detail::pool_size_classes size_classes;
+
     pool_vector m_pools;
     chunk_descriptor_ptr m_allocated;
     oversized_block_descriptor_ptr m_oversized;
-    oversized_block_descriptor_ptr m_cached_oversized;
+    oversized_block_descriptor_ptr m_cached_oversized[size_classes::count];
+    thrust::detail::pool_size_class_bitmap m_cached_classes;
+
+    thrust::detail::pool_stats_recorder m_stats;
+
+    // the number of bytes held from upstream, and the number above which the cache is trimmed
+    // before allocating more
+    std::size_t m_upstream_bytes;
+    std::size_t m_trim_threshold;
+
+    // the number of allocations made from the pool, which the age of cached memory is measured in,
+    // and its value when stale memory was last looked for
+    std::size_t m_clock;
+    std::size_t m_last_sweep;
+
+    bool cached_is_good(oversized_block_descriptor_ptr ptr, std::size_t bytes, std::size_t alignment) const
+    {
+        oversized_block_descriptor desc = *ptr;
+        bool is_good = desc.size >= bytes && desc.alignment >= alignment;
+
+        // if the size is bigger than the requested size by a factor
+        // bigger than or equal to the specified cutoff for size,
+        // allocate a new block
+        if (is_good)
+        {
+            std::size_t size_factor = desc.size / bytes;
+            if (size_factor >= m_options.cached_size_cutoff_factor)
+            {
+                is_good = false;
+            }
+        }
+
+        // if the alignment is bigger than the requested one by a factor
+        // bigger than or equal to the specified cutoff for alignment,
+        // allocate a new block
+        if (is_good)
+        {
+            std::size_t alignment_factor = desc.alignment / alignment;
+            if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
+            {
+                is_good = false;
+            }
+        }
+
+        return is_good;
+    }
+
+    // removes the cached block *previous from the list of class cls, and returns
+    // it for an allocation of the given size
+    void_ptr cached_take(std::size_t cls, oversized_block_descriptor_ptr * previous, std::size_t bytes)
+    {
+        oversized_block_descriptor_ptr ptr = *previous;
+        oversized_block_descriptor desc = *ptr;
+
+        *previous = desc.next_cached;
+        if (!oversized_block_ptr_traits::get(m_cached_oversized[cls]))
+        {
+            m_cached_classes.erase(cls);
+        }
+
+        desc.next_cached = oversized_block_descriptor_ptr();
+
+        m_stats.reused_oversized(desc.size);
+        m_stats.allocated_oversized(bytes, true);
+
+        auto ret =
+            static_cast<char_ptr>(static_cast<void_ptr>(ptr)) -
+            desc.size;
+
+        if (bytes != desc.size) {
+            desc.current_size = bytes;
+
+            ptr = static_cast<oversized_block_descriptor_ptr>(
+                static_cast<void_ptr>(ret + bytes));
+
+            if (oversized_block_ptr_traits::get(desc.prev)) {
+                thrust::raw_reference_cast(*desc.prev).next = ptr;
+            } else {
+                m_oversized = ptr;
+            }
+
+            if (oversized_block_ptr_traits::get(desc.next)) {
+                thrust::raw_reference_cast(*desc.next).prev = ptr;
+            }
+        }
+
+        *ptr = desc;
+
+        return static_cast<void_ptr>(ret);
+    }
+
+    void reset_cached_oversized()
+    {
+        for (std::size_t i = 0; i < size_classes::count; ++i)
+        {
+            m_cached_oversized[i] = oversized_block_descriptor_ptr();
+        }
+
+        m_cached_classes.reset();
+    }
+
+    static detail::intmax_t address_of(void_ptr p)
+    {
+        return reinterpret_cast<detail::intmax_t>(void_ptr_traits::get(p));
+    }
+
+    // the distance between consecutive blocks of the given size in a chunk
+    std::size_t block_stride(std::size_t bytes) const
+    {
+        std::size_t descriptor_size = (std::max)(sizeof(block_descriptor), m_options.alignment);
+        std::size_t block_size = bytes + descriptor_size;
+        block_size += m_options.alignment - block_size % m_options.alignment;
+        return block_size;
+    }
+
+    // releases cached oversized blocks, the largest first; if stale_only, those cached for at least
+    // max_cached_age allocations, and otherwise until at most target_bytes are held from upstream
+    void release_cached_oversized(std::size_t target_bytes, bool stale_only)
+    {
+        for (std::size_t cls = size_classes::count; cls-- > 0;)
+        {
+            if (!stale_only && m_upstream_bytes <= target_bytes)
+            {
+                return;
+            }
+
+            oversized_block_descriptor_ptr * previous = &m_cached_oversized[cls];
+            while (oversized_block_ptr_traits::get(*previous) && (stale_only || m_upstream_bytes > target_bytes))
+            {
+                oversized_block_descriptor_ptr block = *previous;
+                oversized_block_descriptor desc = *block;
+
+                if (stale_only && m_clock - desc.cached_at < m_options.max_cached_age)
+                {
+                    previous = &thrust::raw_reference_cast(*block).next_cached;
+                    continue;
+                }
+
+                *previous = desc.next_cached;
+
+                if (oversized_block_ptr_traits::get(desc.prev)) {
+                    thrust::raw_reference_cast(*desc.prev).next = desc.next;
+                } else {
+                    m_oversized = desc.next;
+                }
+
+                if (oversized_block_ptr_traits::get(desc.next)) {
+                    thrust::raw_reference_cast(*desc.next).prev = desc.prev;
+                }
+
+                void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(block)) - desc.size);
+                m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+                m_upstream_bytes -= desc.size + sizeof(oversized_block_descriptor);
+
+                m_stats.reused_oversized(desc.size);
+                m_stats.upstream_deallocated(desc.size + sizeof(oversized_block_descriptor), true);
+            }
+
+            if (!oversized_block_ptr_traits::get(m_cached_oversized[cls]))
+            {
+                m_cached_classes.erase(cls);
+            }
+        }
+    }
+
+    struct chunk_usage
+    {
+        detail::intmax_t begin;
+        chunk_descriptor_ptr chunk;
+        std::size_t bucket_idx;
+        std::size_t free_bytes;
+        bool released;
+    };
+
+    // the chunk containing the given address, looked up in chunks sorted by address
+    static chunk_usage & chunk_containing(std::vector<chunk_usage> & chunks, detail::intmax_t address)
+    {
+        typename std::vector<chunk_usage>::iterator it = std::upper_bound(chunks.begin(), chunks.end(), address,
+            [](detail::intmax_t a, const chunk_usage & usage) { return a < usage.begin; });
+        assert(it != chunks.begin());
+        return *(it - 1);
+    }
+
+    // releases chunks none of whose blocks are in use; if stale_only, those that the previous look
+    // for stale memory found unused too, and otherwise until at most target_bytes are held from upstream
+    void release_free_chunks(std::size_t target_bytes, bool stale_only)
+    {
+        std::vector<chunk_usage> chunks;
+        for (chunk_descriptor_ptr chunk = m_allocated;
+            detail::pointer_traits<chunk_descriptor_ptr>::get(chunk);
+            chunk = thrust::raw_reference_cast(*chunk).next)
+        {
+            chunk_usage usage;
+            usage.begin = address_of(static_cast<void_ptr>(chunk)) - thrust::raw_reference_cast(*chunk).size;
+            usage.chunk = chunk;
+            usage.bucket_idx = 0;
+            usage.free_bytes = 0;
+            usage.released = false;
+            chunks.push_back(usage);
+        }
+
+        std::sort(chunks.begin(), chunks.end(),
+            [](const chunk_usage & a, const chunk_usage & b) { return a.begin < b.begin; });
+
+        // a chunk is unused when all of its blocks are in the free list of its bucket
+        for (std::size_t i = 0; i < m_pools.size(); ++i)
+        {
+            std::size_t stride = block_stride(static_cast<std::size_t>(1) << (m_smallest_block_log2 + i));
+
+            for (block_descriptor_ptr block = thrust::raw_reference_cast(m_pools[i]).free_list;
+                detail::pointer_traits<block_descriptor_ptr>::get(block);
+                block = thrust::raw_reference_cast(*block).next)
+            {
+                chunk_usage & usage = chunk_containing(chunks, address_of(static_cast<void_ptr>(block)));
+                usage.bucket_idx = i;
+                usage.free_bytes += stride;
+            }
+        }
+
+        std::size_t held = m_upstream_bytes;
+        bool any_released = false;
+
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            chunk_descriptor & desc = thrust::raw_reference_cast(*chunks[i].chunk);
+            bool unused = chunks[i].free_bytes == desc.size;
+
+            if (stale_only)
+            {
+                chunks[i].released = unused && desc.unused_at_last_sweep;
+                desc.unused_at_last_sweep = unused;
+            }
+            else if (unused && held > target_bytes)
+            {
+                chunks[i].released = true;
+                held -= desc.size + sizeof(chunk_descriptor);
+            }
+
+            any_released = any_released || chunks[i].released;
+        }
+
+        if (!any_released)
+        {
+            return;
+        }
+
+        // unlink the released chunks, and their blocks from the free lists
+        for (std::size_t i = 0; i < m_pools.size(); ++i)
+        {
+            block_descriptor_ptr * previous = &thrust::raw_reference_cast(m_pools[i]).free_list;
+            while (detail::pointer_traits<block_descriptor_ptr>::get(*previous))
+            {
+                if (chunk_containing(chunks, address_of(static_cast<void_ptr>(*previous))).released)
+                {
+                    *previous = thrust::raw_reference_cast(**previous).next;
+                }
+                else
+                {
+                    previous = &thrust::raw_reference_cast(**previous).next;
+                }
+            }
+        }
+
+        chunk_descriptor_ptr * previous = &m_allocated;
+        while (detail::pointer_traits<chunk_descriptor_ptr>::get(*previous))
+        {
+            if (chunk_containing(chunks, address_of(static_cast<void_ptr>(*previous))).released)
+            {
+                *previous = thrust::raw_reference_cast(**previous).next;
+            }
+            else
+            {
+                previous = &thrust::raw_reference_cast(**previous).next;
+            }
+        }
+
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            if (!chunks[i].released)
+            {
+                continue;
+            }
+
+            std::size_t chunk_size = thrust::raw_reference_cast(*chunks[i].chunk).size;
+            std::size_t stride = block_stride(static_cast<std::size_t>(1) << (m_smallest_block_log2 + chunks[i].bucket_idx));
+            void_ptr p = static_cast<void_ptr>(
+                static_cast<char_ptr>(static_cast<void_ptr>(chunks[i].chunk)) - chunk_size
+            );
+
+            m_upstream->do_deallocate(p, chunk_size + sizeof(chunk_descriptor), m_options.alignment);
+            m_upstream_bytes -= chunk_size + sizeof(chunk_descriptor);
+
+            m_stats.released_blocks(chunks[i].bucket_idx, chunk_size / stride);
+            m_stats.upstream_deallocated(chunk_size + sizeof(chunk_descriptor), false);
+        }
+    }
+
+    void reset_trim_threshold()
+    {
+        m_trim_threshold = (std::max)(
+            m_options.high_watermark,
+            m_upstream_bytes + (m_options.high_watermark - m_options.low_watermark));
+    }
+
+    // called before allocating the given number of bytes from upstream; if the cache can't be
+    // trimmed below the low watermark, it's tried again once the pool has grown by as much as
+    // the distance between the watermarks, and not on every allocation
+    void make_room(std::size_t bytes)
+    {
+        if (m_options.high_watermark != 0 && m_upstream_bytes + bytes > m_trim_threshold)
+        {
+            trim(m_options.low_watermark);
+        }
+    }
+
+    // called once every max_cached_age allocations
+    void release_stale()
+    {
+        release_cached_oversized(0, true);
+        release_free_chunks(0, true);
+
+        m_last_sweep = m_clock;
+        if (m_options.high_watermark != 0)
+        {
+            reset_trim_threshold();
+        }
+    }
 
 public:
     /*! Releases all held memory to upstream.
@@ -235,7 +599,9 @@ public:
                     static_cast<void_ptr>(alloc)
                 ) - thrust::raw_reference_cast(*alloc).size
             );
-            m_upstream->do_deallocate(p, thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor), m_options.alignment);
+            std::size_t size = thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor);
+            m_upstream->do_deallocate(p, size, m_options.alignment);
+            m_stats.upstream_deallocated(size, false);
         }
 
         // deallocate cached oversized/overaligned memory
@@ -253,9 +619,58 @@ public:
             m_upstream->do_deallocate(
                 p, desc.size + sizeof(oversized_block_descriptor),
                 desc.alignment);
+            m_stats.upstream_deallocated(desc.size + sizeof(oversized_block_descriptor), true);
+        }
+
+        reset_cached_oversized();
+        m_stats.released();
+
+        m_upstream_bytes = 0;
+        m_trim_threshold = m_options.high_watermark;
+    }
+
+    /*! Releases cached memory to upstream until at most \p target_bytes are held from upstream, or no more cached memory
+     *      can be released: first cached oversized and overaligned blocks, the largest first, then chunks none of whose
+     *      blocks are in use. Unlike with \p release(), the memory in use stays valid.
+     *
+     *  \param target_bytes the number of bytes to keep held from upstream
+     *  \returns the number of bytes returned to upstream
+     */
+    std::size_t trim(std::size_t target_bytes = 0)
+    {
+        std::size_t held = m_upstream_bytes;
+
+        release_cached_oversized(target_bytes, false);
+        if (m_upstream_bytes > target_bytes)
+        {
+            release_free_chunks(target_bytes, false);
         }
 
-        m_cached_oversized = oversized_block_descriptor_ptr();
+        if (m_options.high_watermark != 0)
+        {
+            reset_trim_threshold();
+        }
+
+        return held - m_upstream_bytes;
+    }
+
+    /*! Returns a snapshot of the statistics of this pool. Unless \p pool_options::collect_stats was set when the pool was
+     *      constructed, every counter is 0.
+     */
+    pool_stats stats() const
+    {
+        return m_stats.snapshot();
+    }
+
+    /*! Sets a function to be called whenever this pool allocates from its upstream resource, or unsets it if \p callback
+     *      is null.
+     *
+     *  \param callback the function to call
+     *  \param user_data a pointer passed to each call of \p callback
+     */
+    void set_upstream_callback(pool_upstream_callback callback, void * user_data = NULL)
+    {
+        m_stats.set_callback(callback, user_data);
     }
 
     THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
@@ -263,88 +678,73 @@ public:
         bytes = (std::max)(bytes, m_options.smallest_block_size);
         assert(detail::is_power_of_2(alignment));
 
+        if (m_options.max_cached_age != 0 && ++m_clock - m_last_sweep >= m_options.max_cached_age)
+        {
+            release_stale();
+        }
+
         // an oversized and/or overaligned allocation requested; needs to be allocated separately
         if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
         {
             if (m_options.cache_oversized)
             {
-                oversized_block_descriptor_ptr ptr = m_cached_oversized;
-                oversized_block_descriptor_ptr * previous = &m_cached_oversized;
-                while (oversized_block_ptr_traits::get(ptr))
+                const std::size_t first_class = size_classes::of(bytes);
+                oversized_block_descriptor_ptr * previous = &m_cached_oversized[first_class];
+
+                // the most recently cached block of the request's own class is the most
+                // likely one to have exactly the requested size
+                if (oversized_block_ptr_traits::get(*previous) && cached_is_good(*previous, bytes, alignment))
                 {
-                    oversized_block_descriptor desc = *ptr;
-                    bool is_good = desc.size >= bytes && desc.alignment >= alignment;
+                    return cached_take(first_class, previous, bytes);
+                }
 
-                    // if the size is bigger than the requested size by a factor
-                    // bigger than or equal to the specified cutoff for size,
-                    // allocate a new block
-                    if (is_good)
+                // every block in a larger class is big enough
+                for (std::size_t cls = m_cached_classes.next(first_class + 1);
+                    cls < size_classes::count;
+                    cls = m_cached_classes.next(cls + 1))
+                {
+                    // if even the smallest size in the class is bigger than the requested
+                    // size by a factor bigger than or equal to the specified cutoff for size,
+                    // so is every block in this and the following classes
+                    if (size_classes::smallest_size(cls) / bytes >= m_options.cached_size_cutoff_factor)
                     {
-                        std::size_t size_factor = desc.size / bytes;
-                        if (size_factor >= m_options.cached_size_cutoff_factor)
-                        {
-                            is_good = false;
-                        }
+                        break;
                     }
 
-                    // if the alignment is bigger than the requested one by a factor
-                    // bigger than or equal to the specified cutoff for alignment,
-                    // allocate a new block
-                    if (is_good)
+                    oversized_block_descriptor_ptr * previous_in_class = &m_cached_oversized[cls];
+                    while (oversized_block_ptr_traits::get(*previous_in_class))
                     {
-                        std::size_t alignment_factor = desc.alignment / alignment;
-                        if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
+                        if (cached_is_good(*previous_in_class, bytes, alignment))
                         {
-                            is_good = false;
+                            return cached_take(cls, previous_in_class, bytes);
                         }
+
+                        previous_in_class = &thrust::raw_reference_cast(**previous_in_class).next_cached;
                     }
+                }
 
-                    if (is_good)
+                // finally, look through the rest of the request's own class
+                if (oversized_block_ptr_traits::get(*previous))
+                {
+                    previous = &thrust::raw_reference_cast(**previous).next_cached;
+                    while (oversized_block_ptr_traits::get(*previous))
                     {
-                        if (previous != &m_cached_oversized)
+                        if (cached_is_good(*previous, bytes, alignment))
                         {
-                            *previous = desc.next_cached;
+                            return cached_take(first_class, previous, bytes);
                         }
-                        else
-                        {
-                            m_cached_oversized = desc.next_cached;
-                        }
-
-                        desc.next_cached = oversized_block_descriptor_ptr();
 
-                        auto ret =
-                            static_cast<char_ptr>(static_cast<void_ptr>(ptr)) -
-                            desc.size;
-
-                        if (bytes != desc.size) {
-                            desc.current_size = bytes;
-
-                            ptr = static_cast<oversized_block_descriptor_ptr>(
-                                static_cast<void_ptr>(ret + bytes));
-
-                            if (oversized_block_ptr_traits::get(desc.prev)) {
-                                thrust::raw_reference_cast(*desc.prev).next = ptr;
-                            } else {
-                                m_oversized = ptr;
-                            }
-
-                            if (oversized_block_ptr_traits::get(desc.next)) {
-                                thrust::raw_reference_cast(*desc.next).prev = ptr;
-                            }
-                        }
-
-                        *ptr = desc;
-
-                        return static_cast<void_ptr>(ret);
+                        previous = &thrust::raw_reference_cast(**previous).next_cached;
                     }
-
-                    previous = &thrust::raw_reference_cast(*ptr).next_cached;
-                    ptr = *previous;
                 }
             }
 
             // no fitting cached block found; allocate a new one that's just up to the specs
+            make_room(bytes + sizeof(oversized_block_descriptor));
             void_ptr allocated = m_upstream->do_allocate(bytes + sizeof(oversized_block_descriptor), alignment);
+            m_upstream_bytes += bytes + sizeof(oversized_block_descriptor);
+            m_stats.upstream_allocated(bytes + sizeof(oversized_block_descriptor), alignment, true);
+            m_stats.allocated_oversized(bytes, false);
             oversized_block_descriptor_ptr block = static_cast<oversized_block_descriptor_ptr>(
                 static_cast<void_ptr>(
                     static_cast<char_ptr>(allocated) + bytes
@@ -358,6 +758,7 @@ public:
             desc.next = m_oversized;
             desc.next_cached = oversized_block_descriptor_ptr();
             desc.current_size = bytes;
+            desc.cached_at = 0;
             *block = desc;
             m_oversized = block;
 
@@ -379,6 +780,8 @@ public:
 
         bytes = static_cast<std::size_t>(1) << bytes_log2;
 
+        m_stats.allocated_block(bucket_idx, detail::pointer_traits<block_descriptor_ptr>::get(bucket.free_list) != NULL);
+
         // if the free list of the bucket has no elements, allocate a new chunk
         // and split it into blocks pushed to the free list
         if (!detail::pointer_traits<block_descriptor_ptr>::get(bucket.free_list))
@@ -405,12 +808,14 @@ public:
                 }
             }
 
-            std::size_t descriptor_size = (std::max)(sizeof(block_descriptor), m_options.alignment);
-            std::size_t block_size = bytes + descriptor_size;
-            block_size += m_options.alignment - block_size % m_options.alignment;
+            std::size_t block_size = block_stride(bytes);
             std::size_t chunk_size = block_size * n;
 
+            make_room(chunk_size + sizeof(chunk_descriptor));
             void_ptr allocated = m_upstream->do_allocate(chunk_size + sizeof(chunk_descriptor), m_options.alignment);
+            m_upstream_bytes += chunk_size + sizeof(chunk_descriptor);
+            m_stats.upstream_allocated(chunk_size + sizeof(chunk_descriptor), m_options.alignment, false);
+            m_stats.carved_blocks(bucket_idx, n);
             chunk_descriptor_ptr chunk = static_cast<chunk_descriptor_ptr>(
                 static_cast<void_ptr>(
                     static_cast<char_ptr>(allocated) + chunk_size
@@ -420,6 +825,7 @@ public:
             chunk_descriptor chunk_desc;
             chunk_desc.size = chunk_size;
             chunk_desc.next = m_allocated;
+            chunk_desc.unused_at_last_sweep = false;
             *chunk = chunk_desc;
             m_allocated = chunk;
 
@@ -467,11 +873,16 @@ public:
 
             oversized_block_descriptor desc = *block;
             assert(desc.current_size == n);
-            assert(desc.alignment == alignment);
+            // a cached block may be reused for a request with a smaller alignment
+            assert(desc.alignment >= alignment);
+
+            m_stats.deallocated_oversized(n);
 
             if (m_options.cache_oversized)
             {
-                desc.next_cached = m_cached_oversized;
+                const std::size_t cls = size_classes::of(desc.size);
+                desc.next_cached = m_cached_oversized[cls];
+                desc.cached_at = m_clock;
 
                 if (desc.size != n) {
                     desc.current_size = desc.size;
@@ -489,9 +900,12 @@ public:
                     }
                 }
 
-                m_cached_oversized = block;
+                m_cached_oversized[cls] = block;
+                m_cached_classes.insert(cls);
                 *block = desc;
 
+                m_stats.cached_oversized(desc.size);
+
                 return;
             }
 
@@ -507,6 +921,8 @@ public:
             }
 
             m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+            m_upstream_bytes -= desc.size + sizeof(oversized_block_descriptor);
+            m_stats.upstream_deallocated(desc.size + sizeof(oversized_block_descriptor), true);
 
             return;
         }
@@ -516,6 +932,8 @@ public:
         std::size_t bucket_idx = n_log2 - m_smallest_block_log2;
         pool & bucket = thrust::raw_reference_cast(m_pools[bucket_idx]);
 
+        m_stats.deallocated_block(bucket_idx);
+
         n = static_cast<std::size_t>(1) << n_log2;
 
         block_descriptor_ptr block = static_cast<block_descriptor_ptr>(
@@ -90,6 +90,30 @@ struct pool_options
      */
     std::size_t cached_alignment_cutoff_factor;
 
+    /*! Decides whether the pool resource keeps counters of its use of memory, reported by its \p stats() member function.
+     *      Keeping them costs a few additions on every allocation and deallocation.
+     */
+    bool collect_stats;
+
+    /*! The number of bytes held from upstream above which the pool resource releases cached memory before allocating more
+     *      from upstream, down to \p low_watermark if it can. 0 means that cached memory is never released this way.
+     */
+    std::size_t high_watermark;
+    /*! The number of bytes held from upstream that the pool resource trims its cache down to when it goes above
+     *      \p high_watermark.
+     */
+    std::size_t low_watermark;
+
+    /*! The number of allocations after which a cached oversized or overaligned block, or a chunk none of whose blocks are
+     *      in use, is considered stale and returned to upstream. The pool looks for stale memory once in this many
+     *      allocations, so memory may stay cached for up to twice as long. 0 means that cached memory never goes stale.
+     *
+     *  The age is counted in allocations from the pool, not in time: a pool that makes no further allocations never
+     *      finds its cached memory stale, however long it stays idle. Call \p trim() to return the cache of an idle pool to
+     *      upstream.
+     */
+    std::size_t max_cached_age;
+
     /*! Checks if the options are self-consistent.
      *
      *  /returns true if the options are self-consitent, false otherwise.
@@ -116,6 +140,8 @@ struct pool_options
 
         if (alignment > smallest_block_size) return false;
 
+        if (high_watermark != 0 && low_watermark > high_watermark) return false;
+
         return true;
     }
 };
@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief Types used by the pooling resource adaptors to report statistics about their use of memory.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <thrust/detail/config.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! Statistics of a single bucket of a pooling resource adaptor, that is of the blocks of one of the pooled sizes.
+ */
+struct pool_bucket_stats
+{
+    /*! The size of the blocks in this bucket.
+     */
+    std::size_t block_size;
+    /*! The number of blocks of this size carved out of chunks allocated from upstream.
+     */
+    std::size_t blocks;
+    /*! The number of blocks of this size currently handed out by the pool.
+     */
+    std::size_t blocks_in_use;
+};
+
+/*! A snapshot of the statistics of a pooling resource adaptor, returned by its \p stats() member function. The statistics
+ *      are only collected when \p pool_options::collect_stats is true; otherwise, every counter stays 0.
+ *
+ *  The cumulative counters and the high-water marks keep counting across calls to \p release(); everything else describes
+ *      the current state of the pool.
+ */
+struct pool_stats
+{
+    /*! The number of allocations requested from the pool.
+     */
+    std::size_t allocations;
+    /*! The number of deallocations requested from the pool.
+     */
+    std::size_t deallocations;
+    /*! The number of allocations that were served from memory already held by the pool, without allocating from upstream.
+     */
+    std::size_t cache_hits;
+
+    /*! The number of allocations requested from the upstream resource, both for chunks of pooled blocks and for oversized
+     *      and overaligned blocks.
+     */
+    std::size_t upstream_allocations;
+    /*! The number of deallocations requested from the upstream resource.
+     */
+    std::size_t upstream_deallocations;
+
+    /*! The number of bytes currently held from the upstream resource.
+     */
+    std::size_t bytes_upstream;
+    /*! The largest number of bytes ever held from the upstream resource at once.
+     */
+    std::size_t bytes_upstream_high_water;
+
+    /*! The number of bytes currently handed out by the pool. Pooled allocations count as the size of their block, and
+     *      oversized and overaligned allocations as the requested size.
+     */
+    std::size_t bytes_in_use;
+    /*! The largest number of bytes ever handed out by the pool at once.
+     */
+    std::size_t bytes_in_use_high_water;
+    /*! The number of bytes held by the pool and free for reuse: free pooled blocks and cached oversized blocks.
+     */
+    std::size_t bytes_cached;
+
+    /*! The number of oversized and overaligned blocks currently held from the upstream resource, either in use or cached.
+     */
+    std::size_t oversized_blocks;
+    /*! The number of oversized and overaligned blocks currently cached for reuse.
+     */
+    std::size_t oversized_blocks_cached;
+
+    /*! The statistics of each bucket of pooled blocks, from the smallest block size to the largest one.
+     */
+    std::vector<pool_bucket_stats> buckets;
+
+    /*! The ratio of allocations served without allocating from upstream to all allocations, or 0 if there were none.
+     */
+    double hit_rate() const
+    {
+        return allocations ? static_cast<double>(cache_hits) / static_cast<double>(allocations) : 0.0;
+    }
+};
+
+/*! The type of a function called by a pooling resource adaptor whenever it allocates from its upstream resource, set with
+ *      its \p set_upstream_callback() member function. It is called regardless of \p pool_options::collect_stats.
+ *
+ *  \param bytes the number of bytes allocated from upstream
+ *  \param alignment the alignment of the allocation
+ *  \param oversized true if the allocation is an oversized or overaligned block, false if it is a chunk of pooled blocks
+ *  \param user_data the pointer passed to \p set_upstream_callback()
+ */
+typedef void (*pool_upstream_callback)(std::size_t bytes, std::size_t alignment, bool oversized, void * user_data);
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
+
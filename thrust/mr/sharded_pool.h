@@ -0,0 +1,692 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A pooling memory resource adaptor for concurrent use, with a lock for each pooled size and a cache of blocks
+ *      in each thread.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cpp11_required.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <thrust/mr/pool.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A pooling memory resource adaptor which can be used from many threads at once without serializing them, as an
+ *      alternative to \p synchronized_pool_resource. Uses \p std::mutex and \p thread_local, and therefore requires C++11.
+ *
+ *  Blocks of the pooled sizes are kept in one free list for each size, each guarded by its own mutex, so threads only
+ *      contend when they allocate blocks of the same size. In front of those, every thread keeps a small cache of blocks of
+ *      each size, which serves most allocations and deallocations without taking any lock; it is refilled from, and
+ *      flushed to, the shared free list in batches. Any two blocks of the same size are interchangeable, so a block may be
+ *      deallocated on a different thread than the one it was allocated on; it simply joins the cache of the deallocating
+ *      thread. The cache of a thread is returned to the shared free lists when the thread exits.
+ *
+ *  Oversized and overaligned blocks are handled by an \p unsynchronized_pool_resource behind a single mutex, which is
+ *      also held whenever memory is allocated from or returned to \p Upstream; \p Upstream is therefore never used by two
+ *      threads at once.
+ *
+ *  \p pool_options::high_watermark and \p pool_options::max_cached_age only apply to the oversized and overaligned blocks;
+ *      chunks of pooled blocks are only returned to upstream by \p trim() and \p release().
+ *
+ *  When \p pool_options::collect_stats is set, every allocation and deallocation also updates counters behind a mutex
+ *      shared by all threads, which makes the pool contended again; it is meant for diagnostics. Blocks held in the caches of
+ *      threads are counted as cached, not as in use.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory
+ */
+template<typename Upstream>
+class sharded_pool_resource : public memory_resource<typename Upstream::pointer>
+{
+    typedef unsynchronized_pool_resource<Upstream> unsync_pool;
+    typedef std::lock_guard<std::mutex> lock_t;
+
+    typedef typename Upstream::pointer void_ptr;
+    typedef typename thrust::detail::pointer_traits<void_ptr>::template rebind<char>::other char_ptr;
+
+public:
+    /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
+     *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+     *      just a slight departure from the defaults is easy.
+     */
+    static pool_options get_default_options()
+    {
+        return unsync_pool::get_default_options();
+    }
+
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for allocations
+     *  \param options pool options to use
+     */
+    sharded_pool_resource(Upstream * upstream, pool_options options = get_default_options())
+        : m_upstream(upstream),
+        m_options(options),
+        m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size)),
+        m_bucket_count(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1),
+        m_buckets(new bucket[m_bucket_count]),
+        m_generation(0),
+        m_state(std::make_shared<shared_state>(this)),
+        m_chunk_bytes(0),
+        m_oversized(upstream, options)
+    {
+        assert(m_options.validate());
+
+        m_stats.init(m_options.collect_stats, m_smallest_block_log2, m_bucket_count);
+    }
+
+    /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+     *
+     *  \param options pool options to use
+     */
+    sharded_pool_resource(pool_options options = get_default_options())
+        : m_upstream(get_global_resource<Upstream>()),
+        m_options(options),
+        m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size)),
+        m_bucket_count(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1),
+        m_buckets(new bucket[m_bucket_count]),
+        m_generation(0),
+        m_state(std::make_shared<shared_state>(this)),
+        m_chunk_bytes(0),
+        m_oversized(m_upstream, options)
+    {
+        assert(m_options.validate());
+
+        m_stats.init(m_options.collect_stats, m_smallest_block_log2, m_bucket_count);
+    }
+
+    /*! Destructor. Releases all held memory to upstream.
+     */
+    ~sharded_pool_resource()
+    {
+        {
+            // threads that exit from now on drop their caches of this pool
+            lock_t lock(m_state->mtx);
+            m_state->resource = NULL;
+        }
+
+        release();
+    }
+
+    /*! Releases all held memory to upstream. The blocks held in the caches of threads are dropped.
+     */
+    void release()
+    {
+        for (std::size_t i = 0; i < m_bucket_count; ++i)
+        {
+            m_buckets[i].mtx.lock();
+        }
+
+        {
+            lock_t lock(m_upstream_mtx);
+
+            // the caches of threads are emptied the next time they're used
+            m_generation.fetch_add(1, std::memory_order_acq_rel);
+
+            for (std::size_t i = 0; i < m_bucket_count; ++i)
+            {
+                m_buckets[i].free_blocks.clear();
+                m_buckets[i].previous_allocated_count = 0;
+            }
+
+            lock_t stats_lock(m_stats_mtx);
+
+            for (std::size_t i = 0; i < m_allocated.size(); ++i)
+            {
+                m_upstream->do_deallocate(
+                    m_allocated[i].pointer,
+                    m_allocated[i].size,
+                    m_options.alignment);
+                m_stats.upstream_deallocated(m_allocated[i].size, false);
+            }
+
+            m_allocated.clear();
+            m_chunk_bytes = 0;
+            m_oversized.release();
+            m_stats.released();
+        }
+
+        for (std::size_t i = m_bucket_count; i-- > 0;)
+        {
+            m_buckets[i].mtx.unlock();
+        }
+    }
+
+    /*! Releases cached memory to upstream until at most \p target_bytes are held from upstream, or no more cached memory
+     *      can be released: first cached oversized and overaligned blocks, the largest first, then chunks none of whose
+     *      blocks are in use. Blocks held in the caches of threads count as in use. Unlike with \p release(), the memory
+     *      in use stays valid.
+     *
+     *  \param target_bytes the number of bytes to keep held from upstream
+     *  \returns the number of bytes returned to upstream
+     */
+    std::size_t trim(std::size_t target_bytes = 0)
+    {
+        for (std::size_t i = 0; i < m_bucket_count; ++i)
+        {
+            m_buckets[i].mtx.lock();
+        }
+
+        std::size_t released = 0;
+
+        {
+            lock_t lock(m_upstream_mtx);
+            lock_t stats_lock(m_stats_mtx);
+
+            released += m_oversized.trim(target_bytes > m_chunk_bytes ? target_bytes - m_chunk_bytes : 0);
+
+            std::size_t oversized_bytes = m_oversized.m_upstream_bytes;
+            if (m_chunk_bytes + oversized_bytes > target_bytes)
+            {
+                released += release_free_chunks(target_bytes > oversized_bytes ? target_bytes - oversized_bytes : 0);
+            }
+        }
+
+        for (std::size_t i = m_bucket_count; i-- > 0;)
+        {
+            m_buckets[i].mtx.unlock();
+        }
+
+        return released;
+    }
+
+    /*! Returns a snapshot of the statistics of this pool. Unless \p pool_options::collect_stats was set when the pool was
+     *      constructed, every counter is 0. The pooled and the oversized blocks are counted separately, and the high-water
+     *      marks are the sums of their high-water marks, so they may be larger than any amount ever held at once.
+     */
+    pool_stats stats() const
+    {
+        lock_t lock(m_upstream_mtx);
+        lock_t stats_lock(m_stats_mtx);
+
+        pool_stats ret = m_stats.snapshot();
+        pool_stats oversized = m_oversized.stats();
+
+        ret.allocations += oversized.allocations;
+        ret.deallocations += oversized.deallocations;
+        ret.cache_hits += oversized.cache_hits;
+        ret.upstream_allocations += oversized.upstream_allocations;
+        ret.upstream_deallocations += oversized.upstream_deallocations;
+        ret.bytes_upstream += oversized.bytes_upstream;
+        ret.bytes_upstream_high_water += oversized.bytes_upstream_high_water;
+        ret.bytes_in_use += oversized.bytes_in_use;
+        ret.bytes_in_use_high_water += oversized.bytes_in_use_high_water;
+        ret.bytes_cached += oversized.bytes_cached;
+        ret.oversized_blocks = oversized.oversized_blocks;
+        ret.oversized_blocks_cached = oversized.oversized_blocks_cached;
+
+        return ret;
+    }
+
+    /*! Sets a function to be called whenever this pool allocates from its upstream resource, or unsets it if \p callback
+     *      is null. The function is called with the mutex guarding \p Upstream held, and must not use the pool.
+     *
+     *  \param callback the function to call
+     *  \param user_data a pointer passed to each call of \p callback
+     */
+    void set_upstream_callback(pool_upstream_callback callback, void * user_data = NULL)
+    {
+        lock_t lock(m_upstream_mtx);
+        lock_t stats_lock(m_stats_mtx);
+
+        m_stats.set_callback(callback, user_data);
+        m_oversized.set_upstream_callback(callback, user_data);
+    }
+
+    THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        bytes = (std::max)(bytes, m_options.smallest_block_size);
+        assert(detail::is_power_of_2(alignment));
+
+        // an oversized and/or overaligned allocation requested; needs to be allocated separately
+        if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
+        {
+            lock_t lock(m_upstream_mtx);
+            return m_oversized.do_allocate(bytes, alignment);
+        }
+
+        std::size_t bytes_log2 = thrust::detail::log2_ri(bytes);
+        std::size_t bucket_idx = bytes_log2 - m_smallest_block_log2;
+        std::vector<void_ptr> & cached = local_cache().blocks[bucket_idx];
+
+        bool hit = true;
+        if (cached.empty())
+        {
+            hit = refill(bucket_idx, cached);
+        }
+
+        if (m_options.collect_stats)
+        {
+            lock_t lock(m_stats_mtx);
+            m_stats.allocated_block(bucket_idx, hit);
+        }
+
+        void_ptr ret = cached.back();
+        cached.pop_back();
+        return ret;
+    }
+
+    virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        n = (std::max)(n, m_options.smallest_block_size);
+        assert(detail::is_power_of_2(alignment));
+
+        // the deallocated block is oversized and/or overaligned
+        if (n > m_options.largest_block_size || alignment > m_options.alignment)
+        {
+            lock_t lock(m_upstream_mtx);
+            m_oversized.do_deallocate(p, n, alignment);
+            return;
+        }
+
+        std::size_t n_log2 = thrust::detail::log2_ri(n);
+        std::size_t bucket_idx = n_log2 - m_smallest_block_log2;
+        std::vector<void_ptr> & cached = local_cache().blocks[bucket_idx];
+
+        if (m_options.collect_stats)
+        {
+            lock_t lock(m_stats_mtx);
+            m_stats.deallocated_block(bucket_idx);
+        }
+
+        cached.push_back(p);
+
+        // keep the most recently deallocated blocks, which are the most likely to be in the CPU caches
+        if (cached.size() > cache_limit(bucket_idx))
+        {
+            flush(bucket_idx, cached, cached.size() - batch_size(bucket_idx));
+        }
+    }
+
+private:
+    // the number of bytes of blocks of each size kept in the cache of a thread, and
+    // the most blocks of each size kept there
+    static const std::size_t thread_cache_bytes = static_cast<std::size_t>(1) << 18;
+    static const std::size_t thread_cache_blocks = 64;
+
+    struct chunk_descriptor
+    {
+        std::size_t size;
+        void_ptr pointer;
+    };
+
+    // buckets are used by different threads, so each gets its own cache line
+    struct alignas(64) bucket
+    {
+        bucket() : previous_allocated_count(0)
+        {
+        }
+
+        std::mutex mtx;
+        std::vector<void_ptr> free_blocks;
+        std::size_t previous_allocated_count;
+    };
+
+    struct thread_cache
+    {
+        std::size_t generation;
+        std::vector<std::vector<void_ptr> > blocks;
+    };
+
+    // outlives the pool for as long as a thread has a cache of it
+    struct shared_state
+    {
+        shared_state(sharded_pool_resource * resource) : resource(resource)
+        {
+        }
+
+        std::mutex mtx;
+        sharded_pool_resource * resource;
+    };
+
+    struct thread_cache_entry
+    {
+        std::shared_ptr<shared_state> state;
+        thread_cache cache;
+    };
+
+    // the caches of one thread, for every pool of this type it has used
+    struct thread_caches
+    {
+        ~thread_caches()
+        {
+            for (std::size_t i = 0; i < entries.size(); ++i)
+            {
+                lock_t lock(entries[i].state->mtx);
+                if (entries[i].state->resource)
+                {
+                    entries[i].state->resource->flush_all(entries[i].cache);
+                }
+            }
+        }
+
+        std::vector<thread_cache_entry> entries;
+    };
+
+    Upstream * m_upstream;
+
+    pool_options m_options;
+    std::size_t m_smallest_block_log2;
+
+    std::size_t m_bucket_count;
+    std::unique_ptr<bucket[]> m_buckets;
+
+    // incremented by release, to invalidate the caches of threads
+    std::atomic<std::size_t> m_generation;
+    std::shared_ptr<shared_state> m_state;
+
+    // guards the upstream resource, the list of chunks and the pool of oversized blocks
+    mutable std::mutex m_upstream_mtx;
+    std::vector<chunk_descriptor> m_allocated;
+    std::size_t m_chunk_bytes;
+    unsync_pool m_oversized;
+
+    // the statistics of the pooled blocks; taken after m_upstream_mtx when both are needed
+    mutable std::mutex m_stats_mtx;
+    thrust::detail::pool_stats_recorder m_stats;
+
+    std::size_t cache_limit(std::size_t bucket_idx) const
+    {
+        std::size_t limit = thread_cache_bytes >> (bucket_idx + m_smallest_block_log2);
+        return limit < 1 ? 1 : (limit > thread_cache_blocks ? thread_cache_blocks : limit);
+    }
+
+    // the number of blocks moved between the cache of a thread and the shared free list at once
+    std::size_t batch_size(std::size_t bucket_idx) const
+    {
+        return (cache_limit(bucket_idx) + 1) / 2;
+    }
+
+    thread_cache & local_cache()
+    {
+        static thread_local thread_caches caches;
+
+        std::size_t generation = m_generation.load(std::memory_order_acquire);
+
+        for (std::size_t i = 0; i < caches.entries.size(); ++i)
+        {
+            if (caches.entries[i].state == m_state)
+            {
+                thread_cache & cache = caches.entries[i].cache;
+
+                // the pool was released since the cache was last used
+                if (cache.generation != generation)
+                {
+                    for (std::size_t j = 0; j < m_bucket_count; ++j)
+                    {
+                        cache.blocks[j].clear();
+                    }
+                    cache.generation = generation;
+                }
+
+                return cache;
+            }
+        }
+
+        // the first use of this pool by this thread; drop the caches of pools destroyed since the last one
+        for (std::size_t i = caches.entries.size(); i-- > 0;)
+        {
+            bool destroyed;
+            {
+                lock_t lock(caches.entries[i].state->mtx);
+                destroyed = !caches.entries[i].state->resource;
+            }
+
+            if (destroyed)
+            {
+                caches.entries.erase(caches.entries.begin() + i);
+            }
+        }
+
+        thread_cache_entry entry;
+        entry.state = m_state;
+        entry.cache.generation = generation;
+        entry.cache.blocks.resize(m_bucket_count);
+        caches.entries.push_back(entry);
+
+        return caches.entries.back().cache;
+    }
+
+    // returns false if a new chunk had to be allocated from upstream
+    bool refill(std::size_t bucket_idx, std::vector<void_ptr> & cached)
+    {
+        bucket & b = m_buckets[bucket_idx];
+        lock_t lock(b.mtx);
+
+        bool hit = true;
+        if (b.free_blocks.empty())
+        {
+            allocate_chunk(bucket_idx, b);
+            hit = false;
+        }
+
+        std::size_t count = (std::min)(batch_size(bucket_idx), b.free_blocks.size());
+        cached.insert(cached.end(), b.free_blocks.end() - count, b.free_blocks.end());
+        b.free_blocks.resize(b.free_blocks.size() - count);
+
+        return hit;
+    }
+
+    void flush(std::size_t bucket_idx, std::vector<void_ptr> & cached, std::size_t count)
+    {
+        bucket & b = m_buckets[bucket_idx];
+        lock_t lock(b.mtx);
+
+        b.free_blocks.insert(b.free_blocks.end(), cached.begin(), cached.begin() + count);
+        cached.erase(cached.begin(), cached.begin() + count);
+    }
+
+    // called when a thread exits
+    void flush_all(thread_cache & cache)
+    {
+        if (cache.generation != m_generation.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        for (std::size_t i = 0; i < m_bucket_count; ++i)
+        {
+            if (!cache.blocks[i].empty())
+            {
+                flush(i, cache.blocks[i], cache.blocks[i].size());
+            }
+        }
+    }
+
+    struct chunk_usage
+    {
+        detail::intmax_t begin;
+        std::size_t chunk_idx;
+        std::size_t bucket_idx;
+        std::size_t free_bytes;
+        bool released;
+    };
+
+    static detail::intmax_t address_of(void_ptr p)
+    {
+        return reinterpret_cast<detail::intmax_t>(detail::pointer_traits<void_ptr>::get(p));
+    }
+
+    // the chunk containing the given address, looked up in chunks sorted by address
+    static chunk_usage & chunk_containing(std::vector<chunk_usage> & chunks, detail::intmax_t address)
+    {
+        typename std::vector<chunk_usage>::iterator it = std::upper_bound(chunks.begin(), chunks.end(), address,
+            [](detail::intmax_t a, const chunk_usage & usage) { return a < usage.begin; });
+        assert(it != chunks.begin());
+        return *(it - 1);
+    }
+
+    // releases chunks none of whose blocks are in the shared free lists, until at most target_bytes
+    // of chunks are held from upstream; called with every mutex held
+    std::size_t release_free_chunks(std::size_t target_bytes)
+    {
+        std::vector<chunk_usage> chunks(m_allocated.size());
+        for (std::size_t i = 0; i < m_allocated.size(); ++i)
+        {
+            chunks[i].begin = address_of(m_allocated[i].pointer);
+            chunks[i].chunk_idx = i;
+            chunks[i].bucket_idx = 0;
+            chunks[i].free_bytes = 0;
+            chunks[i].released = false;
+        }
+
+        std::sort(chunks.begin(), chunks.end(),
+            [](const chunk_usage & a, const chunk_usage & b) { return a.begin < b.begin; });
+
+        for (std::size_t i = 0; i < m_bucket_count; ++i)
+        {
+            const std::vector<void_ptr> & free_blocks = m_buckets[i].free_blocks;
+            for (std::size_t j = 0; j < free_blocks.size(); ++j)
+            {
+                chunk_usage & usage = chunk_containing(chunks, address_of(free_blocks[j]));
+                usage.bucket_idx = i;
+                usage.free_bytes += static_cast<std::size_t>(1) << (m_smallest_block_log2 + i);
+            }
+        }
+
+        std::size_t released = 0;
+        for (std::size_t i = 0; i < chunks.size() && m_chunk_bytes - released > target_bytes; ++i)
+        {
+            if (chunks[i].free_bytes == m_allocated[chunks[i].chunk_idx].size)
+            {
+                chunks[i].released = true;
+                released += m_allocated[chunks[i].chunk_idx].size;
+            }
+        }
+
+        if (released == 0)
+        {
+            return 0;
+        }
+
+        for (std::size_t i = 0; i < m_bucket_count; ++i)
+        {
+            std::vector<void_ptr> & free_blocks = m_buckets[i].free_blocks;
+            free_blocks.erase(
+                std::remove_if(free_blocks.begin(), free_blocks.end(),
+                    [&chunks](void_ptr block) { return chunk_containing(chunks, address_of(block)).released; }),
+                free_blocks.end());
+        }
+
+        std::vector<bool> is_released(m_allocated.size(), false);
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            if (!chunks[i].released)
+            {
+                continue;
+            }
+
+            chunk_descriptor desc = m_allocated[chunks[i].chunk_idx];
+            is_released[chunks[i].chunk_idx] = true;
+
+            m_upstream->do_deallocate(desc.pointer, desc.size, m_options.alignment);
+
+            m_stats.released_blocks(chunks[i].bucket_idx, desc.size >> (m_smallest_block_log2 + chunks[i].bucket_idx));
+            m_stats.upstream_deallocated(desc.size, false);
+        }
+
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < m_allocated.size(); ++i)
+        {
+            if (!is_released[i])
+            {
+                m_allocated[kept++] = m_allocated[i];
+            }
+        }
+        m_allocated.resize(kept);
+        m_chunk_bytes -= released;
+
+        return released;
+    }
+
+    // called with the mutex of the bucket held
+    void allocate_chunk(std::size_t bucket_idx, bucket & b)
+    {
+        std::size_t bytes_log2 = bucket_idx + m_smallest_block_log2;
+        std::size_t bucket_size = static_cast<std::size_t>(1) << bytes_log2;
+
+        std::size_t n = b.previous_allocated_count;
+        if (n == 0)
+        {
+            n = m_options.min_blocks_per_chunk;
+            if (n < (m_options.min_bytes_per_chunk >> bytes_log2))
+            {
+                n = m_options.min_bytes_per_chunk >> bytes_log2;
+            }
+        }
+        else
+        {
+            n = n * 3 / 2;
+            if (n > (m_options.max_bytes_per_chunk >> bytes_log2))
+            {
+                n = m_options.max_bytes_per_chunk >> bytes_log2;
+            }
+            if (n > m_options.max_blocks_per_chunk)
+            {
+                n = m_options.max_blocks_per_chunk;
+            }
+        }
+
+        chunk_descriptor allocated;
+        allocated.size = n << bytes_log2;
+
+        {
+            lock_t lock(m_upstream_mtx);
+            allocated.pointer = m_upstream->do_allocate(allocated.size, m_options.alignment);
+            m_allocated.push_back(allocated);
+            m_chunk_bytes += allocated.size;
+
+            lock_t stats_lock(m_stats_mtx);
+            m_stats.upstream_allocated(allocated.size, m_options.alignment, false);
+            m_stats.carved_blocks(bucket_idx, n);
+        }
+
+        b.previous_allocated_count = n;
+
+        // the blocks are taken from the back, so push them so that the start of the chunk is used first
+        for (std::size_t i = n; i-- > 0;)
+        {
+            b.free_blocks.push_back(
+                static_cast<void_ptr>(
+                    static_cast<char_ptr>(allocated.pointer) + i * bucket_size
+                )
+            );
+        }
+    }
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
+
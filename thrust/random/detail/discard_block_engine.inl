@@ -95,11 +95,34 @@ template<typename Engine, size_t p, size_t r>
   void discard_block_engine<Engine,p,r>
     ::discard(unsigned long long z)
 {
-  // XXX this should be accelerated
-  for(; z > 0; --z)
+  if(z == 0)
+    return;
+
+  // count the steps of the base engine, keeping operator()'s lazy skip of
+  // the unused part of a block
+  unsigned long long steps = 0;
+
+  if(m_n < used_block)
+  {
+    const unsigned long long left = used_block - m_n;
+    const unsigned long long n    = z < left ? z : left;
+    steps += n;
+    m_n   += static_cast<unsigned int>(n);
+    z     -= n;
+  }
+
+  if(z > 0)
   {
-    this->operator()();
-  } // end for
+    // the first call skips the rest of the current block, and every
+    // used_block calls after that skip a whole block
+    const unsigned long long blocks = (z - 1) / used_block;
+    const unsigned long long n      = z - blocks * used_block;
+
+    steps += (block_size - m_n) + blocks * block_size + n;
+    m_n    = static_cast<unsigned int>(n);
+  }
+
+  m_e.discard(steps);
 }
 
 
@@ -0,0 +1,299 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/random/generate.h>
+#include <thrust/random/linear_congruential_engine.h>
+#include <thrust/random/linear_feedback_shift_engine.h>
+#include <thrust/random/normal_distribution.h>
+#include <thrust/random/simd_engine.h>
+#include <thrust/random/uniform_real_distribution.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+#include <cmath>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// Engine values are drawn in batches of this many into a local array, and then
+// converted by a loop without a dependency between iterations
+const size_t generate_batch_size = 64;
+
+// Each chunk positions its own copy of the engine with discard, so chunks are
+// made large enough to amortize engines with a logarithmic discard
+const size_t generate_min_chunk_size = 4096;
+const size_t generate_max_chunks     = 1 << 14;
+
+// The number of lanes of a simd_engine used to fill a chunk. Each lane fills
+// a contiguous part of the chunk, so the results do not depend on it. Engines
+// with a single word of state are stepped in lanes, everything else one at a time.
+template<typename Engine>
+  struct generate_lanes
+{
+  static const size_t value = 1;
+}; // end generate_lanes
+
+template<typename UIntType, UIntType a, UIntType c, UIntType m>
+  struct generate_lanes<linear_congruential_engine<UIntType,a,c,m> >
+{
+  static const size_t value = 8;
+}; // end generate_lanes
+
+template<typename UIntType, size_t w, size_t k, size_t q, size_t s>
+  struct generate_lanes<linear_feedback_shift_engine<UIntType,w,k,q,s> >
+{
+  static const size_t value = 8;
+}; // end generate_lanes
+
+template<typename Engine1, size_t s1, typename Engine2, size_t s2>
+  struct generate_lanes<xor_combine_engine<Engine1,s1,Engine2,s2> >
+{
+  static const size_t value =
+    (generate_lanes<Engine1>::value > 1 && generate_lanes<Engine2>::value > 1) ? 8 : 1;
+}; // end generate_lanes
+
+// replays a batch of engine values to a distribution
+template<typename Engine>
+  struct replay_engine
+{
+  typedef typename Engine::result_type result_type;
+
+  static const result_type min = Engine::min;
+  static const result_type max = Engine::max;
+
+  const result_type *m_values;
+
+  THRUST_HOST_DEVICE
+  result_type operator()(void)
+  {
+    return *m_values++;
+  }
+}; // end replay_engine
+
+
+// converts count engine values to results, one value per result
+template<typename Engine, typename Distribution>
+  struct generate_batch
+{
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename RandomAccessIterator>
+  THRUST_HOST_DEVICE
+  static void apply(const Distribution &dist,
+                    const typename Engine::result_type *values,
+                    size_t count,
+                    RandomAccessIterator result)
+  {
+    Distribution d = dist;
+    replay_engine<Engine> urng = {values};
+
+    for(size_t i = 0; i < count; ++i)
+    {
+      result[i] = d(urng);
+    }
+  }
+}; // end generate_batch
+
+
+// the Box-Muller transform of pairs of engine values, keeping both results
+template<typename Engine, typename RealType>
+  struct generate_batch<Engine, normal_distribution<RealType> >
+{
+  THRUST_EXEC_CHECK_DISABLE
+  template<typename RandomAccessIterator>
+  THRUST_HOST_DEVICE
+  static void apply(const normal_distribution<RealType> &dist,
+                    const typename Engine::result_type *values,
+                    size_t count,
+                    RandomAccessIterator result)
+  {
+    // allow for Koenig lookup
+    using std::sqrt; using std::log; using std::sin; using std::cos;
+
+    const RealType mean   = dist.mean();
+    const RealType stddev = dist.stddev();
+    const RealType two_pi = RealType(2) * RealType(3.14159265358979323846);
+
+    uniform_real_distribution<RealType> u01;
+    replay_engine<Engine> urng = {values};
+
+    for(size_t i = 0; i < count; i += 2)
+    {
+      const RealType r1  = u01(urng);
+      const RealType r2  = u01(urng);
+      const RealType rho = sqrt(-RealType(2) * log(RealType(1) - r2));
+
+      result[i] = mean + stddev * rho * cos(two_pi * r1);
+      if(i + 1 < count)
+      {
+        result[i + 1] = mean + stddev * rho * sin(two_pi * r1);
+      }
+    }
+  }
+}; // end generate_batch
+
+
+// the number of engine values used for n results
+template<typename Distribution>
+THRUST_HOST_DEVICE
+  unsigned long long generate_draws(const Distribution &, unsigned long long n)
+{
+  return n;
+} // end generate_draws()
+
+template<typename RealType>
+THRUST_HOST_DEVICE
+  unsigned long long generate_draws(const normal_distribution<RealType> &, unsigned long long n)
+{
+  // values are used in pairs
+  return n + (n & 1);
+} // end generate_draws()
+
+
+template<typename RandomAccessIterator, typename Engine, typename Distribution, typename Size>
+  struct generate_chunk
+{
+  RandomAccessIterator first;
+  Engine engine;
+  Distribution dist;
+  Size n;
+  Size chunk_size;
+
+  THRUST_EXEC_CHECK_DISABLE
+  THRUST_HOST_DEVICE
+  void operator()(Size chunk) const
+  {
+    const size_t lanes = generate_lanes<Engine>::value;
+    const size_t batch = generate_batch_size / lanes;
+
+    // lane j fills [begin + j * lane_size, begin + (j + 1) * lane_size)
+    const Size begin = chunk * chunk_size;
+    const Size end   = (n - begin < chunk_size) ? n : begin + chunk_size;
+
+    // rounded up to the batch size, so that the parts start at an even position
+    Size lane_size = (end - begin + static_cast<Size>(lanes) - 1) / static_cast<Size>(lanes);
+    lane_size = (lane_size + static_cast<Size>(batch) - 1) / static_cast<Size>(batch) * static_cast<Size>(batch);
+
+    Engine e = engine;
+    e.discard(static_cast<unsigned long long>(begin));
+
+    simd_engine<Engine,lanes> lane_engine(e, static_cast<unsigned long long>(lane_size));
+
+    typename Engine::result_type step[lanes];
+    typename Engine::result_type values[lanes][batch];
+
+    for(Size i = 0; i < lane_size && begin + i < end; i += static_cast<Size>(batch))
+    {
+      // draw an even number of values so that pairs never straddle a batch,
+      // the values past the end of the range are never used
+      for(size_t k = 0; k < batch; ++k)
+      {
+        lane_engine(step);
+        for(size_t j = 0; j < lanes; ++j)
+        {
+          values[j][k] = step[j];
+        }
+      }
+
+      for(size_t j = 0; j < lanes; ++j)
+      {
+        const Size start = begin + static_cast<Size>(j) * lane_size + i;
+        if(start >= end)
+        {
+          break;
+        }
+
+        const size_t count = (end - start < static_cast<Size>(batch))
+                           ? static_cast<size_t>(end - start) : batch;
+
+        generate_batch<Engine,Distribution>::apply(dist, values[j], count, first + start);
+      }
+    }
+  }
+}; // end generate_chunk
+
+} // end detail
+
+
+THRUST_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy, typename RandomAccessIterator, typename Engine, typename Distribution>
+THRUST_HOST_DEVICE
+  void generate(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                Engine &engine,
+                const Distribution &dist)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  const Size n = last - first;
+  if(n <= 0)
+  {
+    return;
+  }
+
+  // the results do not depend on the chunk size, as long as chunks and the
+  // parts filled by each lane start at an even multiple of the batch size
+  const Size batch      = static_cast<Size>(detail::generate_batch_size);
+  const Size max_chunks = static_cast<Size>(detail::generate_max_chunks);
+
+  Size chunk_size = (n + max_chunks - 1) / max_chunks;
+  if(chunk_size < static_cast<Size>(detail::generate_min_chunk_size))
+  {
+    chunk_size = static_cast<Size>(detail::generate_min_chunk_size);
+  }
+  chunk_size = (chunk_size + batch - 1) / batch * batch;
+
+  const Size num_chunks = (n + chunk_size - 1) / chunk_size;
+
+  detail::generate_chunk<RandomAccessIterator, Engine, Distribution, Size> f =
+    {first, engine, dist, n, chunk_size};
+
+  thrust::for_each_n(exec, thrust::counting_iterator<Size>(0), num_chunks, f);
+
+  engine.discard(detail::generate_draws(dist, static_cast<unsigned long long>(n)));
+} // end generate()
+
+
+template<typename RandomAccessIterator, typename Engine, typename Distribution>
+  void generate(RandomAccessIterator first,
+                RandomAccessIterator last,
+                Engine &engine,
+                const Distribution &dist)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+  System system;
+
+  thrust::random::generate(select_system(system), first, last, engine, dist);
+} // end generate()
+
+
+} // end random
+
+THRUST_NAMESPACE_END
+
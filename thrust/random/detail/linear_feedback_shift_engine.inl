@@ -25,6 +25,26 @@ THRUST_NAMESPACE_BEGIN
 namespace random
 {
 
+namespace detail
+{
+
+// returns the product of the w x w GF(2) matrix whose columns are
+// columns[0..w) with the vector v
+template<typename UIntType, size_t w>
+  THRUST_HOST_DEVICE
+  UIntType linear_feedback_shift_engine_apply(const UIntType *columns, UIntType v)
+{
+  UIntType result = 0;
+  for(size_t j = 0; j < w; ++j)
+  {
+    // all ones if bit j of v is set
+    result ^= columns[j] & (UIntType(0) - ((v >> j) & 1));
+  }
+  return result;
+} // end linear_feedback_shift_engine_apply()
+
+} // end detail
+
 template<typename UIntType, size_t w, size_t k, size_t q, size_t s>
   THRUST_HOST_DEVICE
   linear_feedback_shift_engine<UIntType,w,k,q,s>
@@ -59,10 +79,40 @@ template<typename UIntType, size_t w, size_t k, size_t q, size_t s>
   void linear_feedback_shift_engine<UIntType,w,k,q,s>
     ::discard(unsigned long long z)
 {
-  for(; z > 0; --z)
+  // below this, stepping is cheaper than squaring the w x w step matrix
+  if(z < 64 * w)
+  {
+    for(; z > 0; --z)
+    {
+      this->operator()();
+    } // end for
+    return;
+  }
+
+  // the step is linear over GF(2), so jump ahead by repeated squaring of its
+  // matrix, stored as the images of the w unit vectors
+  UIntType step[w];
+  for(size_t j = 0; j < w; ++j)
+  {
+    linear_feedback_shift_engine unit(static_cast<UIntType>(UIntType(1) << j));
+    step[j] = unit();
+  }
+
+  for(;;)
   {
-    this->operator()();
-  } // end for
+    if(z & 1)
+      m_value = detail::linear_feedback_shift_engine_apply<UIntType,w>(step, m_value);
+
+    z >>= 1;
+    if(z == 0)
+      break;
+
+    UIntType squared[w];
+    for(size_t j = 0; j < w; ++j)
+      squared[j] = detail::linear_feedback_shift_engine_apply<UIntType,w>(step, step[j]);
+    for(size_t j = 0; j < w; ++j)
+      step[j] = squared[j];
+  }
 } // end linear_feedback_shift_engine::discard()
 
 
@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cstdint.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// computes the high and low w bits of the 2w-bit product a * b,
+// where a and b are w-bit words stored in a T
+template<typename T, size_t w>
+  struct mulhilo;
+
+template<typename T>
+  struct mulhilo<T,32>
+{
+  THRUST_HOST_DEVICE
+  static void apply(T a, T b, T &hi, T &lo)
+  {
+    const thrust::detail::uint64_t product =
+      thrust::detail::uint64_t(a) * thrust::detail::uint64_t(b);
+    hi = static_cast<T>(product >> 32);
+    lo = static_cast<T>(product & 0xffffffffu);
+  }
+}; // end mulhilo
+
+template<typename T>
+  struct mulhilo<T,64>
+{
+  THRUST_HOST_DEVICE
+  static void apply(T a, T b, T &hi, T &lo)
+  {
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 product = (unsigned __int128)a * b;
+    hi = static_cast<T>(product >> 64);
+    lo = static_cast<T>(product);
+#else
+    // schoolbook multiplication with 32-bit halves
+    const thrust::detail::uint64_t mask = 0xffffffffu;
+    const thrust::detail::uint64_t a_lo = a & mask, a_hi = a >> 32;
+    const thrust::detail::uint64_t b_lo = b & mask, b_hi = b >> 32;
+
+    const thrust::detail::uint64_t ll = a_lo * b_lo;
+    const thrust::detail::uint64_t lh = a_lo * b_hi;
+    const thrust::detail::uint64_t hl = a_hi * b_lo;
+    const thrust::detail::uint64_t hh = a_hi * b_hi;
+
+    const thrust::detail::uint64_t middle = (ll >> 32) + (lh & mask) + (hl & mask);
+
+    hi = static_cast<T>(hh + (lh >> 32) + (hl >> 32) + (middle >> 32));
+    lo = static_cast<T>((middle << 32) | (ll & mask));
+#endif
+  }
+}; // end mulhilo
+
+} // end detail
+
+} // end random
+
+THRUST_NAMESPACE_END
+
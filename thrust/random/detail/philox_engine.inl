@@ -0,0 +1,296 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/random/philox_engine.h>
+#include <thrust/random/detail/mulhilo.h>
+#include <thrust/random/detail/random_core_access.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+
+template<typename UIntType, size_t w, size_t r,
+         UIntType m0, UIntType c0, UIntType m1, UIntType c1>
+  THRUST_HOST_DEVICE
+  philox_engine<UIntType,w,r,m0,c0,m1,c1>
+    ::philox_engine(result_type value)
+{
+  seed(value);
+} // end philox_engine::philox_engine()
+
+
+template<typename UIntType, size_t w, size_t r,
+         UIntType m0, UIntType c0, UIntType m1, UIntType c1>
+  THRUST_HOST_DEVICE
+  void philox_engine<UIntType,w,r,m0,c0,m1,c1>
+    ::seed(result_type value)
+{
+  m_key[0] = value & wordmask;
+  m_key[1] = 0;
+
+  for(size_t i = 0; i < word_count; ++i)
+  {
+    m_counter[i] = 0;
+    m_block[i]   = 0;
+  }
+
+  m_index = word_count;
+} // end philox_engine::seed()
+
+
+template<typename UIntType, size_t w, size_t r,
+         UIntType m0, UIntType c0, UIntType m1, UIntType c1>
+  THRUST_HOST_DEVICE
+  void philox_engine<UIntType,w,r,m0,c0,m1,c1>
+    ::generate(const result_type *key, const result_type *counter, result_type *block)
+{
+  result_type k0 = key[0], k1 = key[1];
+  result_type x0 = counter[0], x1 = counter[1], x2 = counter[2], x3 = counter[3];
+
+  for(size_t round = 0; round < r; ++round)
+  {
+    if(round > 0)
+    {
+      // bump the key
+      k0 = (k0 + c0) & wordmask;
+      k1 = (k1 + c1) & wordmask;
+    }
+
+    result_type hi0, lo0, hi1, lo1;
+    detail::mulhilo<result_type,w>::apply(m0, x2, hi0, lo0);
+    detail::mulhilo<result_type,w>::apply(m1, x0, hi1, lo1);
+
+    x0 = hi0 ^ x1 ^ k0;
+    x1 = lo0;
+    x2 = hi1 ^ x3 ^ k1;
+    x3 = lo1;
+  }
+
+  block[0] = x0;
+  block[1] = x1;
+  block[2] = x2;
+  block[3] = x3;
+} // end philox_engine::generate()
+
+
+template<typename UIntType, size_t w, size_t r,
+         UIntType m0, UIntType c0, UIntType m1, UIntType c1>
+  THRUST_HOST_DEVICE
+  void philox_engine<UIntType,w,r,m0,c0,m1,c1>
+    ::advance_counter(unsigned long long blocks)
+{
+  // add blocks to the 4w-bit counter, least significant word first
+  for(size_t i = 0; i < word_count && blocks > 0; ++i)
+  {
+    const result_type word = static_cast<result_type>(blocks & wordmask);
+    blocks = (w < 64) ? (blocks >> (w % 64)) : 0;
+
+    m_counter[i] = (m_counter[i] + word) & wordmask;
+    if(m_counter[i] < word)
+      ++blocks; // carry
+  }
+} // end philox_engine::advance_counter()
+
+
+template<typename UIntType, size_t w, size_t r,
+         UIntType m0, UIntType c0, UIntType m1, UIntType c1>
+  THRUST_HOST_DEVICE
+  typename philox_engine<UIntType,w,r,m0,c0,m1,c1>::result_type
+    philox_engine<UIntType,w,r,m0,c0,m1,c1>
+      ::operator()(void)
+{
+  if(m_index == word_count)
+  {
+    generate(m_key, m_counter, m_block);
+    advance_counter(1);
+    m_index = 0;
+  }
+
+  return m_block[m_index++];
+} // end philox_engine::operator()()
+
+
+template<typename UIntType, size_t w, size_t r,
+         UIntType m0, UIntType c0, UIntType m1, UIntType c1>
+  THRUST_HOST_DEVICE
+  void philox_engine<UIntType,w,r,m0,c0,m1,c1>
+    ::discard(unsigned long long z)
+{
+  const unsigned long long available = word_count - m_index;
+  if(z <= available)
+  {
+    m_index += static_cast<unsigned int>(z);
+    return;
+  }
+
+  // skip whole blocks by adding to the counter, then generate the block
+  // holding the next result
+  z -= available;
+  advance_counter(z / word_count);
+
+  m_index = word_count;
+  const unsigned int remainder = static_cast<unsigned int>(z % word_count);
+  if(remainder > 0)
+  {
+    this->operator()();
+    m_index = remainder;
+  }
+} // end philox_engine::discard()
+
+
+template<typename UIntType, size_t w, size_t r,
+         UIntType m0, UIntType c0, UIntType m1, UIntType c1>
+  template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& philox_engine<UIntType,w,r,m0,c0,m1,c1>
+      ::stream_out(std::basic_ostream<CharT,Traits> &os) const
+{
+  typedef std::basic_ostream<CharT,Traits> ostream_type;
+  typedef typename ostream_type::ios_base  ios_base;
+
+  // save old flags & fill character
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill = os.fill();
+
+  const CharT space = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  // output the key, the counter and the position in the block
+  for(size_t i = 0; i < 2; ++i)
+    os << m_key[i] << space;
+  for(size_t i = 0; i < word_count; ++i)
+    os << m_counter[i] << space;
+  os << m_index;
+
+  // restore flags & fill character
+  os.flags(flags);
+  os.fill(fill);
+
+  return os;
+}
+
+
+template<typename UIntType, size_t w, size_t r,
+         UIntType m0, UIntType c0, UIntType m1, UIntType c1>
+  template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& philox_engine<UIntType,w,r,m0,c0,m1,c1>
+      ::stream_in(std::basic_istream<CharT,Traits> &is)
+{
+  typedef std::basic_istream<CharT,Traits> istream_type;
+  typedef typename istream_type::ios_base     ios_base;
+
+  // save old flags
+  const typename ios_base::fmtflags flags = is.flags();
+
+  is.flags(ios_base::dec | ios_base::skipws);
+
+  // input the key, the counter and the position in the block
+  for(size_t i = 0; i < 2; ++i)
+    is >> m_key[i];
+  for(size_t i = 0; i < word_count; ++i)
+    is >> m_counter[i];
+  is >> m_index;
+
+  // regenerate the current block from the previous counter
+  if(m_index < word_count)
+  {
+    result_type counter[word_count];
+    bool borrow = true;
+    for(size_t i = 0; i < word_count; ++i)
+    {
+      counter[i] = (m_counter[i] - (borrow ? 1 : 0)) & wordmask;
+      borrow     = borrow && m_counter[i] == 0;
+    }
+
+    generate(m_key, counter, m_block);
+  }
+
+  // restore flags
+  is.flags(flags);
+
+  return is;
+}
+
+
+template<typename UIntType, size_t w, size_t r,
+         UIntType m0, UIntType c0, UIntType m1, UIntType c1>
+  THRUST_HOST_DEVICE
+  bool philox_engine<UIntType,w,r,m0,c0,m1,c1>
+    ::equal(const philox_engine<UIntType,w,r,m0,c0,m1,c1> &rhs) const
+{
+  bool result = (m_index == rhs.m_index);
+
+  for(size_t i = 0; i < 2; ++i)
+    result &= (m_key[i] == rhs.m_key[i]);
+  for(size_t i = 0; i < word_count; ++i)
+    result &= (m_counter[i] == rhs.m_counter[i]);
+
+  return result;
+}
+
+
+template<typename UIntType_, size_t w_, size_t r_,
+         UIntType_ m0_, UIntType_ c0_, UIntType_ m1_, UIntType_ c1_>
+THRUST_HOST_DEVICE
+bool operator==(const philox_engine<UIntType_,w_,r_,m0_,c0_,m1_,c1_> &lhs,
+                const philox_engine<UIntType_,w_,r_,m0_,c0_,m1_,c1_> &rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs,rhs);
+}
+
+
+template<typename UIntType_, size_t w_, size_t r_,
+         UIntType_ m0_, UIntType_ c0_, UIntType_ m1_, UIntType_ c1_>
+THRUST_HOST_DEVICE
+bool operator!=(const philox_engine<UIntType_,w_,r_,m0_,c0_,m1_,c1_> &lhs,
+                const philox_engine<UIntType_,w_,r_,m0_,c0_,m1_,c1_> &rhs)
+{
+  return !(lhs == rhs);
+}
+
+
+template<typename UIntType_, size_t w_, size_t r_,
+         UIntType_ m0_, UIntType_ c0_, UIntType_ m1_, UIntType_ c1_,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const philox_engine<UIntType_,w_,r_,m0_,c0_,m1_,c1_> &e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os,e);
+}
+
+
+template<typename UIntType_, size_t w_, size_t r_,
+         UIntType_ m0_, UIntType_ c0_, UIntType_ m1_, UIntType_ c1_,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           philox_engine<UIntType_,w_,r_,m0_,c0_,m1_,c1_> &e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is,e);
+}
+
+
+} // end random
+
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,398 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/random/simd_engine.h>
+#include <thrust/random/detail/random_core_access.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+
+template<typename Engine, size_t lanes>
+  THRUST_HOST_DEVICE
+  simd_engine<Engine,lanes>
+    ::simd_engine()
+      :m_stride(default_stride)
+{
+  seed();
+} // end simd_engine::simd_engine()
+
+
+template<typename Engine, size_t lanes>
+  THRUST_HOST_DEVICE
+  simd_engine<Engine,lanes>
+    ::simd_engine(const base_type &urng, unsigned long long stride)
+      :m_stride(stride)
+{
+  base_type e = urng;
+  for(size_t j = 0; j < lanes; ++j)
+  {
+    m_lanes[j] = e;
+    e.discard(m_stride);
+  }
+} // end simd_engine::simd_engine()
+
+
+template<typename Engine, size_t lanes>
+  THRUST_HOST_DEVICE
+  simd_engine<Engine,lanes>
+    ::simd_engine(result_type s)
+      :m_stride(default_stride)
+{
+  seed(s);
+} // end simd_engine::simd_engine()
+
+
+template<typename Engine, size_t lanes>
+  THRUST_HOST_DEVICE
+  void simd_engine<Engine,lanes>
+    ::seed(void)
+{
+  *this = simd_engine(base_type(), m_stride);
+} // end simd_engine::seed()
+
+
+template<typename Engine, size_t lanes>
+  THRUST_HOST_DEVICE
+  void simd_engine<Engine,lanes>
+    ::seed(result_type s)
+{
+  *this = simd_engine(base_type(s), m_stride);
+} // end simd_engine::seed()
+
+
+template<typename Engine, size_t lanes>
+  THRUST_HOST_DEVICE
+  void simd_engine<Engine,lanes>
+    ::operator()(result_type *result)
+{
+  // every iteration performs the same operations on its own lane
+  for(size_t j = 0; j < lanes; ++j)
+  {
+    result[j] = m_lanes[j]();
+  }
+} // end simd_engine::operator()()
+
+
+template<typename Engine, size_t lanes>
+  THRUST_HOST_DEVICE
+  void simd_engine<Engine,lanes>
+    ::discard(unsigned long long z)
+{
+  for(size_t j = 0; j < lanes; ++j)
+  {
+    m_lanes[j].discard(z);
+  }
+} // end simd_engine::discard()
+
+
+template<typename Engine, size_t lanes>
+  THRUST_HOST_DEVICE
+  typename simd_engine<Engine,lanes>::base_type
+    simd_engine<Engine,lanes>
+      ::lane(size_t j) const
+{
+  return m_lanes[j];
+} // end simd_engine::lane()
+
+
+template<typename Engine, size_t lanes>
+  THRUST_HOST_DEVICE
+  unsigned long long simd_engine<Engine,lanes>
+    ::stride(void) const
+{
+  return m_stride;
+} // end simd_engine::stride()
+
+
+template<typename Engine, size_t lanes>
+  template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& simd_engine<Engine,lanes>
+      ::stream_out(std::basic_ostream<CharT,Traits> &os) const
+{
+  typedef std::basic_ostream<CharT,Traits> ostream_type;
+  typedef typename ostream_type::ios_base  ios_base;
+
+  // save old flags & fill character
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill = os.fill();
+
+  const CharT space = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  // output the stride followed by each lane in turn
+  os << m_stride;
+  for(size_t j = 0; j < lanes; ++j)
+  {
+    os << space << m_lanes[j];
+  }
+
+  // restore flags & fill character
+  os.flags(flags);
+  os.fill(fill);
+
+  return os;
+}
+
+
+template<typename Engine, size_t lanes>
+  template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& simd_engine<Engine,lanes>
+      ::stream_in(std::basic_istream<CharT,Traits> &is)
+{
+  typedef std::basic_istream<CharT,Traits> istream_type;
+  typedef typename istream_type::ios_base  ios_base;
+
+  // save old flags
+  const typename ios_base::fmtflags flags = is.flags();
+
+  is.flags(ios_base::dec | ios_base::skipws);
+
+  // input the stride and then each lane, skipping the separators explicitly
+  // because some engines turn off skipws while reading their state
+  is >> m_stride;
+  for(size_t j = 0; j < lanes; ++j)
+  {
+    is >> std::ws >> m_lanes[j];
+  }
+
+  // restore old flags
+  is.flags(flags);
+  return is;
+}
+
+
+template<typename Engine, size_t lanes>
+  THRUST_HOST_DEVICE
+  bool simd_engine<Engine,lanes>
+    ::equal(const simd_engine<Engine,lanes> &rhs) const
+{
+  if(m_stride != rhs.m_stride)
+  {
+    return false;
+  }
+
+  for(size_t j = 0; j < lanes; ++j)
+  {
+    if(m_lanes[j] != rhs.m_lanes[j])
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+template<typename Engine1, size_t s1, typename Engine2, size_t s2, size_t lanes>
+  THRUST_HOST_DEVICE
+  simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>,lanes>
+    ::simd_engine()
+      :m_b1(),m_b2()
+{
+} // end simd_engine::simd_engine()
+
+
+template<typename Engine1, size_t s1, typename Engine2, size_t s2, size_t lanes>
+  THRUST_HOST_DEVICE
+  simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>,lanes>
+    ::simd_engine(const base_type &urng, unsigned long long stride)
+      :m_b1(urng.base1(), stride),m_b2(urng.base2(), stride)
+{
+} // end simd_engine::simd_engine()
+
+
+template<typename Engine1, size_t s1, typename Engine2, size_t s2, size_t lanes>
+  THRUST_HOST_DEVICE
+  simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>,lanes>
+    ::simd_engine(result_type s)
+{
+  seed(s);
+} // end simd_engine::simd_engine()
+
+
+template<typename Engine1, size_t s1, typename Engine2, size_t s2, size_t lanes>
+  THRUST_HOST_DEVICE
+  void simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>,lanes>
+    ::seed(void)
+{
+  *this = simd_engine(base_type(), stride());
+} // end simd_engine::seed()
+
+
+template<typename Engine1, size_t s1, typename Engine2, size_t s2, size_t lanes>
+  THRUST_HOST_DEVICE
+  void simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>,lanes>
+    ::seed(result_type s)
+{
+  *this = simd_engine(base_type(s), stride());
+} // end simd_engine::seed()
+
+
+template<typename Engine1, size_t s1, typename Engine2, size_t s2, size_t lanes>
+  THRUST_HOST_DEVICE
+  void simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>,lanes>
+    ::operator()(result_type *result)
+{
+  typename Engine1::result_type v1[lanes];
+  typename Engine2::result_type v2[lanes];
+
+  m_b1(v1);
+  m_b2(v2);
+
+  for(size_t j = 0; j < lanes; ++j)
+  {
+    result[j] = (result_type(v1[j] - Engine1::min) << s1) ^
+                (result_type(v2[j] - Engine2::min) << s2);
+  }
+} // end simd_engine::operator()()
+
+
+template<typename Engine1, size_t s1, typename Engine2, size_t s2, size_t lanes>
+  THRUST_HOST_DEVICE
+  void simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>,lanes>
+    ::discard(unsigned long long z)
+{
+  m_b1.discard(z);
+  m_b2.discard(z);
+} // end simd_engine::discard()
+
+
+template<typename Engine1, size_t s1, typename Engine2, size_t s2, size_t lanes>
+  THRUST_HOST_DEVICE
+  typename simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>,lanes>::base_type
+    simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>,lanes>
+      ::lane(size_t j) const
+{
+  return base_type(m_b1.lane(j), m_b2.lane(j));
+} // end simd_engine::lane()
+
+
+template<typename Engine1, size_t s1, typename Engine2, size_t s2, size_t lanes>
+  THRUST_HOST_DEVICE
+  unsigned long long simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>,lanes>
+    ::stride(void) const
+{
+  return m_b1.stride();
+} // end simd_engine::stride()
+
+
+template<typename Engine1, size_t s1, typename Engine2, size_t s2, size_t lanes>
+  template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>,lanes>
+      ::stream_out(std::basic_ostream<CharT,Traits> &os) const
+{
+  typedef std::basic_ostream<CharT,Traits> ostream_type;
+  typedef typename ostream_type::ios_base  ios_base;
+
+  // save old flags and fill character
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill = os.fill();
+
+  const CharT space = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  // output the lanes of each base engine in turn
+  os << m_b1 << space << m_b2;
+
+  // restore old flags and fill character
+  os.flags(flags);
+  os.fill(fill);
+  return os;
+}
+
+
+template<typename Engine1, size_t s1, typename Engine2, size_t s2, size_t lanes>
+  template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>,lanes>
+      ::stream_in(std::basic_istream<CharT,Traits> &is)
+{
+  typedef std::basic_istream<CharT,Traits> istream_type;
+  typedef typename istream_type::ios_base  ios_base;
+
+  // save old flags
+  const typename ios_base::fmtflags flags = is.flags();
+
+  is.flags(ios_base::skipws);
+
+  // input the lanes of each base engine in turn
+  is >> m_b1 >> std::ws >> m_b2;
+
+  // restore old flags
+  is.flags(flags);
+  return is;
+}
+
+
+template<typename Engine1, size_t s1, typename Engine2, size_t s2, size_t lanes>
+  THRUST_HOST_DEVICE
+  bool simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>,lanes>
+    ::equal(const simd_engine &rhs) const
+{
+  return (m_b1 == rhs.m_b1) && (m_b2 == rhs.m_b2);
+}
+
+
+template<typename Engine, size_t lanes>
+THRUST_HOST_DEVICE
+bool operator==(const simd_engine<Engine,lanes> &lhs,
+                const simd_engine<Engine,lanes> &rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs,rhs);
+}
+
+
+template<typename Engine, size_t lanes>
+THRUST_HOST_DEVICE
+bool operator!=(const simd_engine<Engine,lanes> &lhs,
+                const simd_engine<Engine,lanes> &rhs)
+{
+  return !(lhs == rhs);
+}
+
+
+template<typename Engine, size_t lanes,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const simd_engine<Engine,lanes> &e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os,e);
+}
+
+
+template<typename Engine, size_t lanes,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           simd_engine<Engine,lanes> &e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is,e);
+}
+
+
+} // end random
+
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,268 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/random/squares_engine.h>
+#include <thrust/random/detail/random_core_access.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// Squares needs a key whose hexadecimal digits are non-zero and distinct within
+// each 32-bit half, with an odd lowest digit, so that the squares mix well.
+// The digits are drawn with a splitmix64 stream of the seed.
+THRUST_HOST_DEVICE
+inline thrust::detail::uint64_t squares_key(thrust::detail::uint64_t seed)
+{
+  thrust::detail::uint64_t key = 0;
+
+  for(int half = 0; half < 2; ++half)
+  {
+    unsigned int used = 0;
+
+    for(int digit = 0; digit < 8; ++digit)
+    {
+      seed += 0x9E3779B97F4A7C15ull;
+      thrust::detail::uint64_t z = seed;
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+      z ^= z >> 31;
+
+      const bool odd = (half == 0 && digit == 0);
+
+      unsigned int count = 0;
+      for(unsigned int d = 1; d < 16; ++d)
+        count += !(used & (1u << d)) && (!odd || (d & 1));
+
+      // the (z mod count)th candidate
+      unsigned int n = static_cast<unsigned int>(z % count);
+      unsigned int d = 1;
+      for(;; ++d)
+      {
+        if(!(used & (1u << d)) && (!odd || (d & 1)))
+        {
+          if(n == 0)
+            break;
+          --n;
+        }
+      }
+
+      used |= 1u << d;
+      key  |= thrust::detail::uint64_t(d) << (32 * half + 4 * digit);
+    }
+  }
+
+  return key;
+} // end squares_key()
+
+// swaps the 32-bit halves of x * x + y
+THRUST_HOST_DEVICE
+inline thrust::detail::uint64_t squares_round(thrust::detail::uint64_t x, thrust::detail::uint64_t y)
+{
+  x = x * x + y;
+  return (x >> 32) | (x << 32);
+} // end squares_round()
+
+template<size_t w>
+  struct squares;
+
+template<>
+  struct squares<32>
+{
+  THRUST_HOST_DEVICE
+  static thrust::detail::uint64_t apply(thrust::detail::uint64_t counter, thrust::detail::uint64_t key)
+  {
+    const thrust::detail::uint64_t y = counter * key;
+    const thrust::detail::uint64_t z = y + key;
+
+    thrust::detail::uint64_t x = squares_round(y, y);
+    x = squares_round(x, z);
+    x = squares_round(x, y);
+
+    return (x * x + z) >> 32;
+  }
+}; // end squares
+
+template<>
+  struct squares<64>
+{
+  THRUST_HOST_DEVICE
+  static thrust::detail::uint64_t apply(thrust::detail::uint64_t counter, thrust::detail::uint64_t key)
+  {
+    const thrust::detail::uint64_t y = counter * key;
+    const thrust::detail::uint64_t z = y + key;
+
+    thrust::detail::uint64_t x = squares_round(y, y);
+    x = squares_round(x, z);
+    x = squares_round(x, y);
+
+    const thrust::detail::uint64_t t = x * x + z;
+    x = (t >> 32) | (t << 32);
+
+    return t ^ ((x * x + y) >> 32);
+  }
+}; // end squares
+
+} // end detail
+
+
+template<typename UIntType, size_t w>
+  THRUST_HOST_DEVICE
+  squares_engine<UIntType,w>
+    ::squares_engine(result_type value)
+{
+  seed(value);
+} // end squares_engine::squares_engine()
+
+
+template<typename UIntType, size_t w>
+  THRUST_HOST_DEVICE
+  void squares_engine<UIntType,w>
+    ::seed(result_type value)
+{
+  m_key     = detail::squares_key(value);
+  m_counter = 0;
+} // end squares_engine::seed()
+
+
+template<typename UIntType, size_t w>
+  THRUST_HOST_DEVICE
+  typename squares_engine<UIntType,w>::result_type
+    squares_engine<UIntType,w>
+      ::operator()(void)
+{
+  return static_cast<result_type>(detail::squares<w>::apply(m_counter++, m_key));
+} // end squares_engine::operator()()
+
+
+template<typename UIntType, size_t w>
+  THRUST_HOST_DEVICE
+  void squares_engine<UIntType,w>
+    ::discard(unsigned long long z)
+{
+  m_counter += z;
+} // end squares_engine::discard()
+
+
+template<typename UIntType, size_t w>
+  template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& squares_engine<UIntType,w>
+      ::stream_out(std::basic_ostream<CharT,Traits> &os) const
+{
+  typedef std::basic_ostream<CharT,Traits> ostream_type;
+  typedef typename ostream_type::ios_base  ios_base;
+
+  // save old flags & fill character
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill = os.fill();
+
+  const CharT space = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  // output the key and the counter
+  os << m_key << space << m_counter;
+
+  // restore flags & fill character
+  os.flags(flags);
+  os.fill(fill);
+
+  return os;
+}
+
+
+template<typename UIntType, size_t w>
+  template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& squares_engine<UIntType,w>
+      ::stream_in(std::basic_istream<CharT,Traits> &is)
+{
+  typedef std::basic_istream<CharT,Traits> istream_type;
+  typedef typename istream_type::ios_base     ios_base;
+
+  // save old flags
+  const typename ios_base::fmtflags flags = is.flags();
+
+  is.flags(ios_base::dec | ios_base::skipws);
+
+  // input the key and the counter
+  is >> m_key >> m_counter;
+
+  // restore flags
+  is.flags(flags);
+
+  return is;
+}
+
+
+template<typename UIntType, size_t w>
+  THRUST_HOST_DEVICE
+  bool squares_engine<UIntType,w>
+    ::equal(const squares_engine<UIntType,w> &rhs) const
+{
+  return (m_key == rhs.m_key) && (m_counter == rhs.m_counter);
+}
+
+
+template<typename UIntType_, size_t w_>
+THRUST_HOST_DEVICE
+bool operator==(const squares_engine<UIntType_,w_> &lhs,
+                const squares_engine<UIntType_,w_> &rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs,rhs);
+}
+
+
+template<typename UIntType_, size_t w_>
+THRUST_HOST_DEVICE
+bool operator!=(const squares_engine<UIntType_,w_> &lhs,
+                const squares_engine<UIntType_,w_> &rhs)
+{
+  return !(lhs == rhs);
+}
+
+
+template<typename UIntType_, size_t w_,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const squares_engine<UIntType_,w_> &e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os,e);
+}
+
+
+template<typename UIntType_, size_t w_,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           squares_engine<UIntType_,w_> &e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is,e);
+}
+
+
+} // end random
+
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,420 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/cstdint.h>
+#include <cstddef> // for size_t
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+
+// A subtract_with_carry_engine with word size w and lags s < r is equivalent
+// to a linear congruential generator with modulus m = b^r - b^s + 1, b = 2^w,
+// and multiplier b^-1 (mod m). The state (x_{n-r}, ..., x_{n-1}, carry) maps
+// to the congruential state
+//
+//   X = sum_{i<r} x_{n-r+i} b^i - sum_{i<s} x_{n-s+i} b^i + carry  (mod m),
+//
+// and each step multiplies X by b^-1. Going the other way, the words of the
+// state are the first r base b digits of X / m, newest word first.
+//
+// discard(z) therefore maps the state to X, multiplies it by b^-z in
+// O(log z) modular multiplications, and decodes the r newest words back.
+//
+// Arithmetic is done on little endian arrays of 32 bit limbs, so it works
+// on the device without 128 bit integers.
+template<size_t w, size_t s, size_t r>
+  struct subtract_with_carry_engine_modular_arithmetic
+{
+  typedef thrust::detail::uint32_t limb_type;
+  typedef thrust::detail::uint64_t wide_type;
+
+  // m < 2^bits
+  static const size_t bits = w * r;
+
+  // the number of limbs of an element of [0, 2m)
+  static const size_t limbs = bits / 32 + 1;
+
+  // the number of limbs of a product
+  static const size_t wide_limbs = 2 * limbs;
+
+  struct number
+  {
+    limb_type d[wide_limbs];
+  };
+
+  THRUST_HOST_DEVICE
+  static void zero(number &a)
+  {
+    for(size_t i = 0; i < wide_limbs; ++i)
+      a.d[i] = 0;
+  }
+
+  // a += v * 2^offset, for v of at most 64 bits
+  THRUST_HOST_DEVICE
+  static void add_at(number &a, wide_type v, size_t offset)
+  {
+    size_t i = offset / 32;
+    const size_t shift = offset % 32;
+
+    // spread v << shift over (up to) three limbs
+    limb_type parts[3];
+    parts[0] = static_cast<limb_type>(v << shift);
+    parts[1] = static_cast<limb_type>(shift == 0 ? (v >> 32) : (v >> (32 - shift)));
+    parts[2] = static_cast<limb_type>(shift == 0 ? 0 : (v >> (64 - shift)));
+
+    wide_type carry = 0;
+    for(size_t j = 0; i < wide_limbs && (j < 3 || carry != 0); ++i, ++j)
+    {
+      const wide_type sum = wide_type(a.d[i]) + (j < 3 ? parts[j] : 0) + carry;
+      a.d[i] = static_cast<limb_type>(sum);
+      carry  = sum >> 32;
+    }
+  }
+
+  // returns the count <= 64 bits of a starting at offset
+  THRUST_HOST_DEVICE
+  static wide_type get_bits(const number &a, size_t offset, size_t count)
+  {
+    const size_t i     = offset / 32;
+    const size_t shift = offset % 32;
+
+    wide_type result = 0;
+    for(size_t j = 0; j < 3 && i + j < wide_limbs; ++j)
+    {
+      const wide_type limb = wide_type(a.d[i + j]) >> (j == 0 ? shift : 0);
+      const size_t position = j == 0 ? 0 : 32 * j - shift;
+      if(position < 64)
+        result |= limb << position;
+    }
+
+    return count < 64 ? (result & ((wide_type(1) << count) - 1)) : result;
+  }
+
+  THRUST_HOST_DEVICE
+  static bool less(const number &a, const number &b)
+  {
+    for(size_t i = wide_limbs; i > 0; --i)
+    {
+      if(a.d[i-1] != b.d[i-1])
+        return a.d[i-1] < b.d[i-1];
+    }
+    return false;
+  }
+
+  THRUST_HOST_DEVICE
+  static bool equal(const number &a, const number &b)
+  {
+    bool result = true;
+    for(size_t i = 0; i < wide_limbs; ++i)
+      result &= (a.d[i] == b.d[i]);
+    return result;
+  }
+
+  // a += b
+  THRUST_HOST_DEVICE
+  static void add(number &a, const number &b)
+  {
+    wide_type carry = 0;
+    for(size_t i = 0; i < wide_limbs; ++i)
+    {
+      const wide_type sum = wide_type(a.d[i]) + b.d[i] + carry;
+      a.d[i] = static_cast<limb_type>(sum);
+      carry  = sum >> 32;
+    }
+  }
+
+  // a -= b, requires a >= b
+  THRUST_HOST_DEVICE
+  static void subtract(number &a, const number &b)
+  {
+    wide_type borrow = 0;
+    for(size_t i = 0; i < wide_limbs; ++i)
+    {
+      const wide_type difference = wide_type(a.d[i]) - b.d[i] - borrow;
+      a.d[i] = static_cast<limb_type>(difference);
+      borrow = (difference >> 32) & 1;
+    }
+  }
+
+  // result = a >> offset
+  THRUST_HOST_DEVICE
+  static void shift_right(const number &a, size_t offset, number &result)
+  {
+    const size_t limb_offset = offset / 32;
+    const size_t shift       = offset % 32;
+    for(size_t i = 0; i < wide_limbs; ++i)
+    {
+      const size_t j  = i + limb_offset;
+      const limb_type lo = j     < wide_limbs ? a.d[j]     : 0;
+      const limb_type hi = j + 1 < wide_limbs ? a.d[j + 1] : 0;
+      result.d[i] = static_cast<limb_type>(((wide_type(hi) << 32) | lo) >> shift);
+    }
+  }
+
+  // result = a << offset, truncated to wide_limbs
+  THRUST_HOST_DEVICE
+  static void shift_left(const number &a, size_t offset, number &result)
+  {
+    const size_t limb_offset = offset / 32;
+    const size_t shift       = offset % 32;
+    for(size_t i = wide_limbs; i > 0; --i)
+    {
+      const size_t j = i - 1;
+      const limb_type hi = j     >= limb_offset ? a.d[j - limb_offset]     : 0;
+      const limb_type lo = j     >  limb_offset ? a.d[j - limb_offset - 1] : 0;
+      result.d[j] = static_cast<limb_type>((((wide_type(hi) << 32) | lo) << shift) >> 32);
+    }
+  }
+
+  // a mod 2^offset, in place
+  THRUST_HOST_DEVICE
+  static void truncate(number &a, size_t offset)
+  {
+    for(size_t i = 0; i < wide_limbs; ++i)
+    {
+      if(32 * i >= offset)
+        a.d[i] = 0;
+      else if(32 * (i + 1) > offset)
+        a.d[i] &= (limb_type(1) << (offset - 32 * i)) - 1;
+    }
+  }
+
+  // m = 2^bits - 2^(w s) + 1, i.e. bits [w s, bits) and bit 0 set
+  THRUST_HOST_DEVICE
+  static void modulus(number &m)
+  {
+    zero(m);
+    for(size_t i = w * s; i < bits; ++i)
+      m.d[i / 32] |= limb_type(1) << (i % 32);
+    m.d[0] |= 1;
+  }
+
+  // b^-1 = m + b^(s-1) - b^(r-1) (mod m)
+  THRUST_HOST_DEVICE
+  static void inverse_base(number &a)
+  {
+    modulus(a);
+    add_at(a, 1, w * (s - 1));
+
+    number b_r_minus_1;
+    zero(b_r_minus_1);
+    add_at(b_r_minus_1, 1, w * (r - 1));
+    subtract(a, b_r_minus_1);
+  }
+
+  // a mod m, for any a < 2^(2 bits)
+  THRUST_HOST_DEVICE
+  static void reduce(number &a)
+  {
+    number high, shifted;
+
+    // fold 2^bits = 2^(w s) - 1 (mod m) until a < 2^bits
+    shift_right(a, bits, high);
+    for(bool nonzero = true; nonzero; )
+    {
+      nonzero = false;
+      for(size_t i = 0; i < wide_limbs; ++i)
+        nonzero |= (high.d[i] != 0);
+
+      if(nonzero)
+      {
+        truncate(a, bits);
+
+        // a += high << (w s), then a -= high
+        shift_left(high, w * s, shifted);
+        add(a, shifted);
+        subtract(a, high);
+
+        shift_right(a, bits, high);
+      }
+    }
+
+    number m;
+    modulus(m);
+    while(!less(a, m))
+      subtract(a, m);
+  }
+
+  // a = a * b (mod m), for a, b < m
+  THRUST_HOST_DEVICE
+  static void multiply(number &a, const number &b)
+  {
+    number product;
+    zero(product);
+
+    for(size_t i = 0; i < limbs; ++i)
+    {
+      wide_type carry = 0;
+      for(size_t j = 0; j < limbs; ++j)
+      {
+        const wide_type t = wide_type(a.d[i]) * b.d[j] + product.d[i + j] + carry;
+        product.d[i + j] = static_cast<limb_type>(t);
+        carry = t >> 32;
+      }
+      product.d[i + limbs] = static_cast<limb_type>(carry);
+    }
+
+    reduce(product);
+    a = product;
+  }
+
+  // a = a * b^-z (mod m)
+  THRUST_HOST_DEVICE
+  static void jump(number &a, unsigned long long z)
+  {
+    number multiplier;
+    inverse_base(multiplier);
+
+    // see http://en.wikipedia.org/wiki/Modular_exponentiation
+    while(z > 0)
+    {
+      if(z & 1)
+        multiply(a, multiplier);
+
+      z >>= 1;
+      if(z > 0)
+        multiply(multiplier, multiplier);
+    }
+  }
+
+  // result = floor(a 2^bits / m), for a < m
+  THRUST_HOST_DEVICE
+  static void leading_digits(const number &a, number &result)
+  {
+    number m;
+    modulus(m);
+
+    // 2^bits / m = 1 + (2^(w s) - 1) / m, so a + floor(a (2^(w s) - 1) / 2^bits)
+    // underestimates the result by at most two
+    number t, e;
+    shift_left(a, w * s, t);
+    subtract(t, a);
+    shift_right(t, bits, e);
+
+    result = a;
+    add(result, e);
+
+    // the remainder a 2^bits - result m = result (2^(w s) - 1) - e 2^bits
+    number remainder;
+    shift_left(result, w * s, remainder);
+    subtract(remainder, result);
+    shift_left(e, bits, t);
+    subtract(remainder, t);
+
+    while(!less(remainder, m))
+    {
+      subtract(remainder, m);
+      add_at(result, 1, 0);
+    }
+  }
+}; // end subtract_with_carry_engine_modular_arithmetic
+
+
+struct subtract_with_carry_engine_discard
+{
+  template<typename SubtractWithCarryEngine>
+  THRUST_HOST_DEVICE
+  static void discard(SubtractWithCarryEngine &e, unsigned long long z)
+  {
+    typedef typename SubtractWithCarryEngine::result_type result_type;
+    const size_t w = SubtractWithCarryEngine::word_size;
+    const size_t s = SubtractWithCarryEngine::short_lag;
+    const size_t r = SubtractWithCarryEngine::long_lag;
+
+    typedef subtract_with_carry_engine_modular_arithmetic<w,s,r> arithmetic;
+    typedef typename arithmetic::number number;
+
+    // a jump costs about 2 log2(z) products of (w r)-bit numbers, which is
+    // only worth it for a few thousand steps or more. The decoding below also
+    // assumes every word of the new state was generated rather than seeded.
+    if(z < 4096 + r)
+    {
+      for(; z > 0; --z)
+      {
+        e();
+      } // end for
+      return;
+    }
+
+    // encode the state, oldest word first
+    number x, newest;
+    arithmetic::zero(x);
+    arithmetic::zero(newest);
+    for(size_t i = 0; i < r; ++i)
+    {
+      const result_type xi = e.m_x[(e.m_k + i) % r];
+      arithmetic::add_at(x, xi, w * i);
+      if(i >= r - s)
+        arithmetic::add_at(newest, xi, w * (i - (r - s)));
+    }
+    arithmetic::add_at(x, static_cast<unsigned int>(e.m_carry), 0);
+
+    number m;
+    arithmetic::modulus(m);
+    if(!arithmetic::less(x, m))
+      arithmetic::subtract(x, m);
+    arithmetic::add(x, m);
+    arithmetic::subtract(x, newest);
+    arithmetic::reduce(x);
+
+    // the all zero and all b-1 (with carry) states are fixed points
+    number zero;
+    arithmetic::zero(zero);
+    if(arithmetic::equal(x, zero))
+      return;
+
+    arithmetic::jump(x, z);
+
+    // the words are the leading base b digits of x / m, oldest word last
+    number words;
+    arithmetic::leading_digits(x, words);
+    for(size_t i = 0; i < r; ++i)
+    {
+      e.m_x[i] = static_cast<result_type>(arithmetic::get_bits(words, w * i, w));
+    }
+    e.m_k = 0;
+
+    // x = words - newest + carry (mod m) determines the carry
+    arithmetic::zero(newest);
+    for(size_t i = r - s; i < r; ++i)
+      arithmetic::add_at(newest, e.m_x[i], w * (i - (r - s)));
+    arithmetic::add(x, newest);
+    if(!arithmetic::less(x, m))
+      arithmetic::subtract(x, m);
+    if(!arithmetic::less(words, m))
+      arithmetic::subtract(words, m);
+
+    e.m_carry = arithmetic::equal(x, words) ? 0 : 1;
+  }
+}; // end subtract_with_carry_engine_discard
+
+
+} // end detail
+
+} // end random
+
+THRUST_NAMESPACE_END
+
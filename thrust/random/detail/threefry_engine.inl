@@ -0,0 +1,370 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/random/threefry_engine.h>
+#include <thrust/random/detail/random_core_access.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// the rotation constants of Threefry4x32 and Threefry4x64, from Random123
+template<size_t w>
+  struct threefry_rotation;
+
+template<>
+  struct threefry_rotation<32>
+{
+  THRUST_HOST_DEVICE
+  static size_t get(size_t round, size_t i)
+  {
+    switch(round)
+    {
+      case 0:  return i == 0 ? 10 : 26;
+      case 1:  return i == 0 ? 11 : 21;
+      case 2:  return i == 0 ? 13 : 27;
+      case 3:  return i == 0 ? 23 :  5;
+      case 4:  return i == 0 ?  6 : 20;
+      case 5:  return i == 0 ? 17 : 11;
+      case 6:  return i == 0 ? 25 : 10;
+      default: return i == 0 ? 18 : 20;
+    }
+  }
+}; // end threefry_rotation
+
+template<>
+  struct threefry_rotation<64>
+{
+  THRUST_HOST_DEVICE
+  static size_t get(size_t round, size_t i)
+  {
+    switch(round)
+    {
+      case 0:  return i == 0 ? 14 : 16;
+      case 1:  return i == 0 ? 52 : 57;
+      case 2:  return i == 0 ? 23 : 40;
+      case 3:  return i == 0 ?  5 : 37;
+      case 4:  return i == 0 ? 25 : 33;
+      case 5:  return i == 0 ? 46 : 12;
+      case 6:  return i == 0 ? 58 : 22;
+      default: return i == 0 ? 32 : 32;
+    }
+  }
+}; // end threefry_rotation
+
+// the Skein key schedule parity constant
+template<size_t w>
+  struct threefry_parity;
+
+template<>
+  struct threefry_parity<32>
+{
+  static const thrust::detail::uint64_t value = 0x1BD11BDAull;
+}; // end threefry_parity
+
+template<>
+  struct threefry_parity<64>
+{
+  static const thrust::detail::uint64_t value = 0x1BD11BDAA9FC1A22ull;
+}; // end threefry_parity
+
+template<typename T, size_t w>
+THRUST_HOST_DEVICE
+  T threefry_rotate_left(T x, size_t n)
+{
+  const T mask = static_cast<T>(~static_cast<T>(0)) >> (8 * sizeof(T) - w);
+  return ((x << n) | (x >> (w - n))) & mask;
+} // end threefry_rotate_left
+
+} // end detail
+
+
+
+template<typename UIntType, size_t w, size_t r>
+  THRUST_HOST_DEVICE
+  threefry_engine<UIntType,w,r>
+    ::threefry_engine(result_type value)
+{
+  seed(value);
+} // end threefry_engine::threefry_engine()
+
+
+template<typename UIntType, size_t w, size_t r>
+  THRUST_HOST_DEVICE
+  void threefry_engine<UIntType,w,r>
+    ::seed(result_type value)
+{
+  m_key[0] = value & wordmask;
+  for(size_t i = 1; i < word_count; ++i)
+    m_key[i] = 0;
+
+  for(size_t i = 0; i < word_count; ++i)
+  {
+    m_counter[i] = 0;
+    m_block[i]   = 0;
+  }
+
+  m_index = word_count;
+} // end threefry_engine::seed()
+
+
+template<typename UIntType, size_t w, size_t r>
+  THRUST_HOST_DEVICE
+  void threefry_engine<UIntType,w,r>
+    ::generate(const result_type *key, const result_type *counter, result_type *block)
+{
+  // the key schedule is the key followed by its parity word
+  result_type ks[5];
+  ks[4] = detail::threefry_parity<w>::value & wordmask;
+  for(size_t i = 0; i < word_count; ++i)
+  {
+    ks[i]  = key[i];
+    ks[4] ^= key[i];
+  }
+
+  result_type x[4];
+  for(size_t i = 0; i < word_count; ++i)
+    x[i] = (counter[i] + ks[i]) & wordmask;
+
+  for(size_t round = 0; round < r; ++round)
+  {
+    const size_t rot0 = detail::threefry_rotation<w>::get(round % 8, 0);
+    const size_t rot1 = detail::threefry_rotation<w>::get(round % 8, 1);
+
+    // even rounds mix words (0,1) and (2,3), odd rounds (0,3) and (2,1)
+    const size_t a = (round % 2 == 0) ? 1 : 3;
+    const size_t b = 4 - a;
+
+    x[0] = (x[0] + x[a]) & wordmask;
+    x[a] = detail::threefry_rotate_left<result_type,w>(x[a], rot0) ^ x[0];
+    x[2] = (x[2] + x[b]) & wordmask;
+    x[b] = detail::threefry_rotate_left<result_type,w>(x[b], rot1) ^ x[2];
+
+    // inject the key every four rounds
+    if(round % 4 == 3)
+    {
+      const size_t s = (round + 1) / 4;
+      for(size_t i = 0; i < word_count; ++i)
+        x[i] = (x[i] + ks[(s + i) % 5]) & wordmask;
+      x[3] = (x[3] + s) & wordmask;
+    }
+  }
+
+  for(size_t i = 0; i < word_count; ++i)
+    block[i] = x[i];
+} // end threefry_engine::generate()
+
+
+template<typename UIntType, size_t w, size_t r>
+  THRUST_HOST_DEVICE
+  void threefry_engine<UIntType,w,r>
+    ::advance_counter(unsigned long long blocks)
+{
+  // add blocks to the 4w-bit counter, least significant word first
+  for(size_t i = 0; i < word_count && blocks > 0; ++i)
+  {
+    const result_type word = static_cast<result_type>(blocks & wordmask);
+    blocks = (w < 64) ? (blocks >> (w % 64)) : 0;
+
+    m_counter[i] = (m_counter[i] + word) & wordmask;
+    if(m_counter[i] < word)
+      ++blocks; // carry
+  }
+} // end threefry_engine::advance_counter()
+
+
+template<typename UIntType, size_t w, size_t r>
+  THRUST_HOST_DEVICE
+  typename threefry_engine<UIntType,w,r>::result_type
+    threefry_engine<UIntType,w,r>
+      ::operator()(void)
+{
+  if(m_index == word_count)
+  {
+    generate(m_key, m_counter, m_block);
+    advance_counter(1);
+    m_index = 0;
+  }
+
+  return m_block[m_index++];
+} // end threefry_engine::operator()()
+
+
+template<typename UIntType, size_t w, size_t r>
+  THRUST_HOST_DEVICE
+  void threefry_engine<UIntType,w,r>
+    ::discard(unsigned long long z)
+{
+  const unsigned long long available = word_count - m_index;
+  if(z <= available)
+  {
+    m_index += static_cast<unsigned int>(z);
+    return;
+  }
+
+  // skip whole blocks by adding to the counter, then generate the block
+  // holding the next result
+  z -= available;
+  advance_counter(z / word_count);
+
+  m_index = word_count;
+  const unsigned int remainder = static_cast<unsigned int>(z % word_count);
+  if(remainder > 0)
+  {
+    this->operator()();
+    m_index = remainder;
+  }
+} // end threefry_engine::discard()
+
+
+template<typename UIntType, size_t w, size_t r>
+  template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& threefry_engine<UIntType,w,r>
+      ::stream_out(std::basic_ostream<CharT,Traits> &os) const
+{
+  typedef std::basic_ostream<CharT,Traits> ostream_type;
+  typedef typename ostream_type::ios_base  ios_base;
+
+  // save old flags & fill character
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill = os.fill();
+
+  const CharT space = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  // output the key, the counter and the position in the block
+  for(size_t i = 0; i < word_count; ++i)
+    os << m_key[i] << space;
+  for(size_t i = 0; i < word_count; ++i)
+    os << m_counter[i] << space;
+  os << m_index;
+
+  // restore flags & fill character
+  os.flags(flags);
+  os.fill(fill);
+
+  return os;
+}
+
+
+template<typename UIntType, size_t w, size_t r>
+  template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& threefry_engine<UIntType,w,r>
+      ::stream_in(std::basic_istream<CharT,Traits> &is)
+{
+  typedef std::basic_istream<CharT,Traits> istream_type;
+  typedef typename istream_type::ios_base     ios_base;
+
+  // save old flags
+  const typename ios_base::fmtflags flags = is.flags();
+
+  is.flags(ios_base::dec | ios_base::skipws);
+
+  // input the key, the counter and the position in the block
+  for(size_t i = 0; i < word_count; ++i)
+    is >> m_key[i];
+  for(size_t i = 0; i < word_count; ++i)
+    is >> m_counter[i];
+  is >> m_index;
+
+  // regenerate the current block from the previous counter
+  if(m_index < word_count)
+  {
+    result_type counter[word_count];
+    bool borrow = true;
+    for(size_t i = 0; i < word_count; ++i)
+    {
+      counter[i] = (m_counter[i] - (borrow ? 1 : 0)) & wordmask;
+      borrow     = borrow && m_counter[i] == 0;
+    }
+
+    generate(m_key, counter, m_block);
+  }
+
+  // restore flags
+  is.flags(flags);
+
+  return is;
+}
+
+
+template<typename UIntType, size_t w, size_t r>
+  THRUST_HOST_DEVICE
+  bool threefry_engine<UIntType,w,r>
+    ::equal(const threefry_engine<UIntType,w,r> &rhs) const
+{
+  bool result = (m_index == rhs.m_index);
+
+  for(size_t i = 0; i < word_count; ++i)
+    result &= (m_key[i] == rhs.m_key[i]);
+  for(size_t i = 0; i < word_count; ++i)
+    result &= (m_counter[i] == rhs.m_counter[i]);
+
+  return result;
+}
+
+
+template<typename UIntType_, size_t w_, size_t r_>
+THRUST_HOST_DEVICE
+bool operator==(const threefry_engine<UIntType_,w_,r_> &lhs,
+                const threefry_engine<UIntType_,w_,r_> &rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs,rhs);
+}
+
+
+template<typename UIntType_, size_t w_, size_t r_>
+THRUST_HOST_DEVICE
+bool operator!=(const threefry_engine<UIntType_,w_,r_> &lhs,
+                const threefry_engine<UIntType_,w_,r_> &rhs)
+{
+  return !(lhs == rhs);
+}
+
+
+template<typename UIntType_, size_t w_, size_t r_,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const threefry_engine<UIntType_,w_,r_> &e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os,e);
+}
+
+
+template<typename UIntType_, size_t w_, size_t r_,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           threefry_engine<UIntType_,w_,r_> &e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is,e);
+}
+
+
+} // end random
+
+THRUST_NAMESPACE_END
+
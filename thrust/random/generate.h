@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file thrust/random/generate.h
+ *  \brief Fills a range with random numbers drawn from a distribution in parallel.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random_number_distributions
+ *  \{
+ */
+
+/*! \p generate fills the range <tt>[first, last)</tt> with random numbers drawn from
+ *  \p dist, using the stream of random numbers produced by \p engine.
+ *
+ *  The range is split into chunks that are generated in parallel, as determined by
+ *  \p exec. Each chunk positions a copy of \p engine with \p discard, draws its engine
+ *  values in batches, and then converts each batch into results. The result therefore
+ *  does not depend on the execution policy or the number of threads, and \p engine is
+ *  left as if it had been called once per element.
+ *
+ *  \p uniform_int_distribution and \p uniform_real_distribution produce exactly the
+ *  values of <tt>for(i ...) first[i] = dist(engine);</tt>. \p normal_distribution uses the
+ *  Box-Muller transform on every system and keeps both values of each pair, so it
+ *  consumes one engine value per result.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the range to fill.
+ *  \param last The end of the range to fill.
+ *  \param engine The random number engine. It is advanced past the values used.
+ *  \param dist The distribution of the results.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and is mutable.
+ *  \tparam Engine is a random number engine. Engines with a fast \p discard, such as
+ *          \p philox4x32 or \p minstd_rand, parallelize best.
+ *  \tparam Distribution is a random number distribution which draws exactly one value
+ *          from its engine per result, such as \p uniform_int_distribution,
+ *          \p uniform_real_distribution or \p normal_distribution.
+ *
+ *  The following code snippet demonstrates how to fill a \p device_vector with Normally
+ *  distributed numbers:
+ *
+ *  \code
+ *  #include <thrust/random.h>
+ *  #include <thrust/random/generate.h>
+ *  #include <thrust/device_vector.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  thrust::device_vector<float> v(1 << 20);
+ *  thrust::philox4x32 rng(13);
+ *  thrust::random::normal_distribution<float> dist(0.0f, 1.0f);
+ *
+ *  thrust::random::generate(thrust::device, v.begin(), v.end(), rng, dist);
+ *  \endcode
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator, typename Engine, typename Distribution>
+THRUST_HOST_DEVICE
+  void generate(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                Engine &engine,
+                const Distribution &dist);
+
+
+/*! \p generate fills the range <tt>[first, last)</tt> with random numbers drawn from
+ *  \p dist, using the stream of random numbers produced by \p engine. The system is
+ *  selected from the iterator.
+ *
+ *  \param first The beginning of the range to fill.
+ *  \param last The end of the range to fill.
+ *  \param engine The random number engine. It is advanced past the values used.
+ *  \param dist The distribution of the results.
+ *
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and is mutable.
+ *  \tparam Engine is a random number engine.
+ *  \tparam Distribution is a random number distribution which draws exactly one value
+ *          from its engine per result.
+ */
+template<typename RandomAccessIterator, typename Engine, typename Distribution>
+  void generate(RandomAccessIterator first,
+                RandomAccessIterator last,
+                Engine &engine,
+                const Distribution &dist);
+
+/*! \} // end random_number_distributions
+ */
+
+} // end random
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/generate.inl>
+
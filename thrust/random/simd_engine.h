@@ -0,0 +1,329 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file simd_engine.h
+ *  \brief A random number engine adaptor which steps several copies
+ *         of a base engine at once.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <iostream>
+#include <cstddef> // for size_t
+#include <thrust/random/xor_combine_engine.h>
+#include <thrust/random/detail/random_core_access.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random_number_engine_adaptors
+ *  \{
+ */
+
+/*! \class simd_engine
+ *  \brief A \p simd_engine adapts an existing base random number engine and steps
+ *         \p lanes copies of it, one per lane, with each call.
+ *
+ *         Lane \c j starts where the base engine would be after <tt>j * stride</tt>
+ *         calls, so each lane produces exactly the values of a scalar engine seeded the
+ *         same way and advanced with <tt>discard(j * stride)</tt>. The lanes are stored
+ *         so that one call performs the same operations on every lane, which lets the
+ *         compiler keep the state of \p linear_congruential_engine,
+ *         \p linear_feedback_shift_engine and \p xor_combine_engine combinations of them
+ *         (such as \p minstd_rand and \p taus88) in vector registers.
+ *
+ *  \tparam Engine The type of the base random number engine to adapt.
+ *  \tparam lanes The number of copies of \p Engine which are stepped together.
+ *
+ *  The following code snippet shows an example of use of a \p simd_engine instance:
+ *
+ *  \code
+ *  #include <thrust/random/linear_congruential_engine.h>
+ *  #include <thrust/random/simd_engine.h>
+ *  #include <iostream>
+ *
+ *  int main(void)
+ *  {
+ *    // eight lanes of minstd_rand, 1000 values apart
+ *    thrust::simd_engine<thrust::minstd_rand, 8> rng(thrust::minstd_rand(13), 1000);
+ *
+ *    // produce the 0th, 1000th, ..., 7000th value of the stream of minstd_rand(13)
+ *    thrust::minstd_rand::result_type values[8];
+ *    rng(values);
+ *
+ *    std::cout << values[7] << std::endl;
+ *
+ *    return 0;
+ *  }
+ *  \endcode
+ */
+template<typename Engine, size_t lanes>
+  class simd_engine
+{
+  public:
+    // types
+
+    /*! \typedef base_type
+     *  \brief The type of the adapted base random number engine.
+     */
+    typedef Engine base_type;
+
+    /*! \typedef result_type
+     *  \brief The type of the unsigned integer produced by this \p simd_engine.
+     */
+    typedef typename base_type::result_type result_type;
+
+    // engine characteristics
+
+    /*! The number of values produced by each call.
+     */
+    static const size_t lane_count = lanes;
+
+    /*! The distance between the streams of consecutive lanes when none is given.
+     */
+    static const unsigned long long default_stride = 1ull << 24;
+
+    /*! The smallest value this \p simd_engine may potentially produce.
+     */
+    static const result_type min = base_type::min;
+
+    /*! The largest value this \p simd_engine may potentially produce.
+     */
+    static const result_type max = base_type::max;
+
+    // constructors and seeding functions
+
+    /*! This constructor constructs a new \p simd_engine whose lanes follow a
+     *  \p base_type engine constructed with its null constructor.
+     */
+    THRUST_HOST_DEVICE
+    simd_engine();
+
+    /*! This constructor constructs a new \p simd_engine whose lanes follow a
+     *  given \p base_type engine.
+     *
+     *  \param urng The \p base_type engine followed by lane \c 0.
+     *  \param stride The number of values between the starts of consecutive lanes.
+     */
+    THRUST_HOST_DEVICE
+    explicit simd_engine(const base_type &urng, unsigned long long stride = default_stride);
+
+    /*! This constructor constructs a new \p simd_engine whose lanes follow a
+     *  \p base_type engine constructed from a seed.
+     *
+     *  \param s The seed used to construct the \p base_type engine followed by lane \c 0.
+     */
+    THRUST_HOST_DEVICE
+    explicit simd_engine(result_type s);
+
+    /*! This method reinitializes the lanes of this \p simd_engine from a
+     *  \p base_type engine constructed with its null constructor, keeping the stride.
+     */
+    THRUST_HOST_DEVICE
+    void seed(void);
+
+    /*! This method reinitializes the lanes of this \p simd_engine from a
+     *  \p base_type engine constructed from a seed, keeping the stride.
+     *
+     *  \param s The seed used to construct the \p base_type engine followed by lane \c 0.
+     */
+    THRUST_HOST_DEVICE
+    void seed(result_type s);
+
+    // generating functions
+
+    /*! This member function produces the next value of every lane and updates this
+     *  \p simd_engine's state.
+     *
+     *  \param result An array of \p lanes values, which receives the value of lane \c j
+     *         in <tt>result[j]</tt>.
+     */
+    THRUST_HOST_DEVICE
+    void operator()(result_type *result);
+
+    /*! This member function advances every lane of this \p simd_engine a given number
+     *  of times and discards the results.
+     *
+     *  \param z The number of random values to discard in each lane.
+     */
+    THRUST_HOST_DEVICE
+    void discard(unsigned long long z);
+
+    // property functions
+
+    /*! This member function returns a scalar engine in the state of one lane of this
+     *  \p simd_engine.
+     *
+     *  \param j The index of the lane.
+     *  \return A \p base_type which produces the remaining values of lane \p j.
+     */
+    THRUST_HOST_DEVICE
+    base_type lane(size_t j) const;
+
+    /*! This member function returns the number of values between the starts of
+     *  consecutive lanes of this \p simd_engine.
+     */
+    THRUST_HOST_DEVICE
+    unsigned long long stride(void) const;
+
+    /*! \cond
+     */
+  private:
+    base_type m_lanes[lanes];
+    unsigned long long m_stride;
+
+    friend struct thrust::random::detail::random_core_access;
+
+    THRUST_HOST_DEVICE
+    bool equal(const simd_engine &rhs) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& stream_out(std::basic_ostream<CharT,Traits> &os) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& stream_in(std::basic_istream<CharT,Traits> &is);
+    /*! \endcond
+     */
+}; // end simd_engine
+
+
+/*! \cond
+ */
+
+// The lanes of each base engine of an xor_combine_engine are kept together, so
+// that taus88 steps three arrays of words rather than an array of triples
+template<typename Engine1, size_t s1, typename Engine2, size_t s2, size_t lanes>
+  class simd_engine<xor_combine_engine<Engine1,s1,Engine2,s2>, lanes>
+{
+  public:
+    typedef xor_combine_engine<Engine1,s1,Engine2,s2> base_type;
+    typedef typename base_type::result_type result_type;
+
+    static const size_t lane_count = lanes;
+    static const unsigned long long default_stride = 1ull << 24;
+    static const result_type min = base_type::min;
+    static const result_type max = base_type::max;
+
+    THRUST_HOST_DEVICE
+    simd_engine();
+
+    THRUST_HOST_DEVICE
+    explicit simd_engine(const base_type &urng, unsigned long long stride = default_stride);
+
+    THRUST_HOST_DEVICE
+    explicit simd_engine(result_type s);
+
+    THRUST_HOST_DEVICE
+    void seed(void);
+
+    THRUST_HOST_DEVICE
+    void seed(result_type s);
+
+    THRUST_HOST_DEVICE
+    void operator()(result_type *result);
+
+    THRUST_HOST_DEVICE
+    void discard(unsigned long long z);
+
+    THRUST_HOST_DEVICE
+    base_type lane(size_t j) const;
+
+    THRUST_HOST_DEVICE
+    unsigned long long stride(void) const;
+
+  private:
+    simd_engine<Engine1,lanes> m_b1;
+    simd_engine<Engine2,lanes> m_b2;
+
+    friend struct thrust::random::detail::random_core_access;
+
+    THRUST_HOST_DEVICE
+    bool equal(const simd_engine &rhs) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& stream_out(std::basic_ostream<CharT,Traits> &os) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& stream_in(std::basic_istream<CharT,Traits> &is);
+}; // end simd_engine
+
+/*! \endcond
+ */
+
+
+/*! This function checks two \p simd_engines for equality.
+ *  \param lhs The first \p simd_engine to test.
+ *  \param rhs The second \p simd_engine to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template<typename Engine, size_t lanes>
+THRUST_HOST_DEVICE
+bool operator==(const simd_engine<Engine,lanes> &lhs,
+                const simd_engine<Engine,lanes> &rhs);
+
+
+/*! This function checks two \p simd_engines for inequality.
+ *  \param lhs The first \p simd_engine to test.
+ *  \param rhs The second \p simd_engine to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template<typename Engine, size_t lanes>
+THRUST_HOST_DEVICE
+bool operator!=(const simd_engine<Engine,lanes> &lhs,
+                const simd_engine<Engine,lanes> &rhs);
+
+
+/*! This function streams a simd_engine to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param e The \p simd_engine to stream out.
+ *  \return \p os
+ */
+template<typename Engine, size_t lanes,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const simd_engine<Engine,lanes> &e);
+
+
+/*! This function streams a simd_engine in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param e The \p simd_engine to stream in.
+ *  \return \p is
+ */
+template<typename Engine, size_t lanes,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           simd_engine<Engine,lanes> &e);
+
+
+/*! \} // end random_number_engine_adaptors
+ */
+
+} // end random
+
+// import names into thrust::
+using random::simd_engine;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/simd_engine.inl>
+
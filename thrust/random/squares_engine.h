@@ -0,0 +1,258 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file squares_engine.h
+ *  \brief A counter-based pseudorandom number engine
+ *         using Widynski's Squares algorithm.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <iostream>
+#include <cstddef> // for size_t
+#include <thrust/detail/cstdint.h>
+#include <thrust/random/detail/random_core_access.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random_number_engine_templates
+ *  \{
+ */
+
+/*! \class squares_engine
+ *  \brief A \p squares_engine random number engine produces unsigned integer
+ *         random numbers using Widynski's Squares counter-based algorithm.
+ *
+ *         The <tt>i</tt>th result is computed from a 64-bit key and the 64-bit
+ *         counter \c i with a few rounds of squaring and swapping the halves of a
+ *         64-bit word, which makes it one of the cheapest counter-based generators.
+ *         The key is derived from the seed so that its hexadecimal digits have the
+ *         structure the algorithm requires. \p discard runs in constant time, and
+ *         <tt>e.discard(i); e();</tt> is a cheap way to compute the <tt>i</tt>th
+ *         result of a stream in parallel. Host and device produce identical results.
+ *
+ *  \tparam UIntType The type of unsigned integer to produce.
+ *  \tparam w The word size of the produced values. \c 32 uses four rounds and
+ *          \c 64 uses five.
+ *
+ *  \note Inexperienced users should not use this class template directly.  Instead, use
+ *  \p squares32 or \p squares64.
+ *
+ *  The following code snippet shows an example of use of a \p squares_engine instance:
+ *
+ *  \code
+ *  #include <thrust/random/squares_engine.h>
+ *  #include <iostream>
+ *
+ *  int main(void)
+ *  {
+ *    // create a squares32 object, which is an instance of squares_engine
+ *    thrust::squares32 rng(13);
+ *
+ *    // jump directly to the 1000000th value of the stream
+ *    rng.discard(999999);
+ *
+ *    // output the value
+ *    std::cout << rng() << std::endl;
+ *
+ *    return 0;
+ *  }
+ *  \endcode
+ *
+ *  \see thrust::random::squares32
+ *  \see thrust::random::squares64
+ */
+template<typename UIntType, size_t w>
+  class squares_engine
+{
+  public:
+    // types
+
+    /*! \typedef result_type
+     *  \brief The type of the unsigned integer produced by this \p squares_engine.
+     */
+    typedef UIntType result_type;
+
+    // engine characteristics
+
+    /*! The word size of the produced values.
+     */
+    static const size_t word_size = w;
+
+    /*! The smallest value this \p squares_engine may potentially produce.
+     */
+    static const result_type min = 0;
+
+    /*! The largest value this \p squares_engine may potentially produce.
+     */
+    static const result_type max =
+      static_cast<result_type>(~static_cast<result_type>(0)) >> (8 * sizeof(result_type) - w);
+
+    /*! The default seed of this \p squares_engine.
+     */
+    static const result_type default_seed = 20111115u;
+
+    // constructors and seeding functions
+
+    /*! This constructor, which optionally accepts a seed, initializes a new
+     *  \p squares_engine.
+     *
+     *  \param value The seed used to intialize this \p squares_engine's key.
+     *         The counter starts at zero.
+     */
+    THRUST_HOST_DEVICE
+    explicit squares_engine(result_type value = default_seed);
+
+    /*! This method initializes this \p squares_engine's state, and optionally accepts
+     *  a seed value.
+     *
+     *  \param value The seed used to initializes this \p squares_engine's key.
+     *         The counter is reset to zero.
+     */
+    THRUST_HOST_DEVICE
+    void seed(result_type value = default_seed);
+
+    // generating functions
+
+    /*! This member function produces a new random value and updates this \p squares_engine's state.
+     *  \return A new random number.
+     */
+    THRUST_HOST_DEVICE
+    result_type operator()(void);
+
+    /*! This member function advances this \p squares_engine's state a given number of times
+     *  and discards the results.
+     *
+     *  \param z The number of random values to discard.
+     *  \note This function runs in constant time.
+     */
+    THRUST_HOST_DEVICE
+    void discard(unsigned long long z);
+
+    /*! \cond
+     */
+  private:
+    thrust::detail::uint64_t m_key;
+    thrust::detail::uint64_t m_counter;
+
+    friend struct thrust::random::detail::random_core_access;
+
+    THRUST_HOST_DEVICE
+    bool equal(const squares_engine &rhs) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& stream_out(std::basic_ostream<CharT,Traits> &os) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& stream_in(std::basic_istream<CharT,Traits> &is);
+
+    /*! \endcond
+     */
+}; // end squares_engine
+
+
+/*! This function checks two \p squares_engines for equality.
+ *  \param lhs The first \p squares_engine to test.
+ *  \param rhs The second \p squares_engine to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template<typename UIntType_, size_t w_>
+THRUST_HOST_DEVICE
+bool operator==(const squares_engine<UIntType_,w_> &lhs,
+                const squares_engine<UIntType_,w_> &rhs);
+
+
+/*! This function checks two \p squares_engines for inequality.
+ *  \param lhs The first \p squares_engine to test.
+ *  \param rhs The second \p squares_engine to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template<typename UIntType_, size_t w_>
+THRUST_HOST_DEVICE
+bool operator!=(const squares_engine<UIntType_,w_> &lhs,
+                const squares_engine<UIntType_,w_> &rhs);
+
+
+/*! This function streams a squares_engine to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param e The \p squares_engine to stream out.
+ *  \return \p os
+ */
+template<typename UIntType_, size_t w_,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const squares_engine<UIntType_,w_> &e);
+
+
+/*! This function streams a squares_engine in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param e The \p squares_engine to stream in.
+ *  \return \p is
+ */
+template<typename UIntType_, size_t w_,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           squares_engine<UIntType_,w_> &e);
+
+
+/*! \} // end random_number_engine_templates
+ */
+
+
+/*! \addtogroup predefined_random
+ *  \{
+ */
+
+/*! \typedef squares32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         four round, 32-bit output variant of the Squares counter-based random
+ *         number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p squares32
+ *        shall produce the value \c 941856950 .
+ */
+typedef squares_engine<thrust::detail::uint32_t, 32> squares32;
+
+
+/*! \typedef squares64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         five round, 64-bit output variant of the Squares counter-based random
+ *         number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p squares64
+ *        shall produce the value \c 4045244800961042677 .
+ */
+typedef squares_engine<thrust::detail::uint64_t, 64> squares64;
+
+/*! \} // end predefined_random
+ */
+
+} // end random
+
+// import names into thrust::
+using random::squares_engine;
+using random::squares32;
+using random::squares64;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/squares_engine.inl>
+
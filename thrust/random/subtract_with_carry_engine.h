@@ -23,6 +23,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/random/detail/random_core_access.h>
+#include <thrust/random/detail/subtract_with_carry_engine_discard.h>
 
 #include <thrust/detail/cstdint.h>
 #include <cstddef> // for size_t
@@ -150,6 +151,8 @@ template<typename UIntType, size_t w, size_t s, size_t r>
 
     friend struct thrust::random::detail::random_core_access;
 
+    friend struct thrust::random::detail::subtract_with_carry_engine_discard;
+
     THRUST_HOST_DEVICE
     bool equal(const subtract_with_carry_engine &rhs) const;
 
@@ -0,0 +1,278 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file threefry_engine.h
+ *  \brief A counter-based pseudorandom number engine
+ *         using the Threefry algorithm.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <iostream>
+#include <cstddef> // for size_t
+#include <thrust/detail/cstdint.h>
+#include <thrust/random/detail/random_core_access.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random_number_engine_templates
+ *  \{
+ */
+
+/*! \class threefry_engine
+ *  \brief A \p threefry_engine random number engine produces unsigned integer
+ *         random numbers using the four-word Threefry counter-based algorithm
+ *         of Salmon et al., a reduced round variant of the Threefish block cipher.
+ *
+ *         Each block of four results is a bijective function of a 4-word key and
+ *         a 4-word counter, computed with \c r rounds of additions, rotations and
+ *         xors. The key is derived from the seed, and the counter is incremented
+ *         once per block. Because the <tt>i</tt>th result depends only on the seed
+ *         and \c i, \p discard runs in constant time, and
+ *         <tt>e.discard(i); e();</tt> is a cheap way to compute the <tt>i</tt>th
+ *         result of a stream in parallel. Unlike \p threefry_engine it needs no wide
+ *         multiplications. Host and device produce identical results.
+ *
+ *  \tparam UIntType The type of unsigned integer to produce.
+ *  \tparam w The word size of the produced values. Must be \c 32 or \c 64.
+ *  \tparam r The number of rounds.
+ *
+ *  \note Inexperienced users should not use this class template directly.  Instead, use
+ *  \p threefry4x32 or \p threefry4x64.
+ *
+ *  The following code snippet shows an example of use of a \p threefry_engine instance:
+ *
+ *  \code
+ *  #include <thrust/random/threefry_engine.h>
+ *  #include <iostream>
+ *
+ *  int main(void)
+ *  {
+ *    // create a threefry4x64 object, which is an instance of threefry_engine
+ *    thrust::threefry4x64 rng(13);
+ *
+ *    // jump directly to the 1000000th value of the stream
+ *    rng.discard(999999);
+ *
+ *    // output the value
+ *    std::cout << rng() << std::endl;
+ *
+ *    return 0;
+ *  }
+ *  \endcode
+ *
+ *  \see thrust::random::threefry4x32
+ *  \see thrust::random::threefry4x64
+ */
+template<typename UIntType, size_t w, size_t r>
+  class threefry_engine
+{
+  public:
+    // types
+
+    /*! \typedef result_type
+     *  \brief The type of the unsigned integer produced by this \p threefry_engine.
+     */
+    typedef UIntType result_type;
+
+    // engine characteristics
+
+    /*! The word size of the produced values.
+     */
+    static const size_t word_size = w;
+
+    /*! The number of words produced from each counter value.
+     */
+    static const size_t word_count = 4;
+
+    /*! The number of rounds applied to each counter value.
+     */
+    static const size_t round_count = r;
+
+    /*! The smallest value this \p threefry_engine may potentially produce.
+     */
+    static const result_type min = 0;
+
+    /*! The largest value this \p threefry_engine may potentially produce.
+     */
+    static const result_type max =
+      static_cast<result_type>(~static_cast<result_type>(0)) >> (8 * sizeof(result_type) - w);
+
+    /*! The default seed of this \p threefry_engine.
+     */
+    static const result_type default_seed = 20111115u;
+
+    // constructors and seeding functions
+
+    /*! This constructor, which optionally accepts a seed, initializes a new
+     *  \p threefry_engine.
+     *
+     *  \param value The seed used to intialize this \p threefry_engine's key.
+     *         The counter starts at zero.
+     */
+    THRUST_HOST_DEVICE
+    explicit threefry_engine(result_type value = default_seed);
+
+    /*! This method initializes this \p threefry_engine's state, and optionally accepts
+     *  a seed value.
+     *
+     *  \param value The seed used to initializes this \p threefry_engine's key.
+     *         The counter is reset to zero.
+     */
+    THRUST_HOST_DEVICE
+    void seed(result_type value = default_seed);
+
+    // generating functions
+
+    /*! This member function produces a new random value and updates this \p threefry_engine's state.
+     *  \return A new random number.
+     */
+    THRUST_HOST_DEVICE
+    result_type operator()(void);
+
+    /*! This member function advances this \p threefry_engine's state a given number of times
+     *  and discards the results.
+     *
+     *  \param z The number of random values to discard.
+     *  \note This function runs in constant time.
+     */
+    THRUST_HOST_DEVICE
+    void discard(unsigned long long z);
+
+    /*! \cond
+     */
+  private:
+    static const result_type wordmask = max;
+
+    // the key, the counter of the next block, the current block
+    // and the position of the next result in it
+    result_type m_key[4];
+    result_type m_counter[4];
+    result_type m_block[4];
+    unsigned int m_index;
+
+    THRUST_HOST_DEVICE
+    static void generate(const result_type *key, const result_type *counter, result_type *block);
+
+    THRUST_HOST_DEVICE
+    void advance_counter(unsigned long long blocks);
+
+    friend struct thrust::random::detail::random_core_access;
+
+    THRUST_HOST_DEVICE
+    bool equal(const threefry_engine &rhs) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_ostream<CharT,Traits>& stream_out(std::basic_ostream<CharT,Traits> &os) const;
+
+    template<typename CharT, typename Traits>
+    std::basic_istream<CharT,Traits>& stream_in(std::basic_istream<CharT,Traits> &is);
+
+    /*! \endcond
+     */
+}; // end threefry_engine
+
+
+/*! This function checks two \p threefry_engines for equality.
+ *  \param lhs The first \p threefry_engine to test.
+ *  \param rhs The second \p threefry_engine to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template<typename UIntType_, size_t w_, size_t r_>
+THRUST_HOST_DEVICE
+bool operator==(const threefry_engine<UIntType_,w_,r_> &lhs,
+                const threefry_engine<UIntType_,w_,r_> &rhs);
+
+
+/*! This function checks two \p threefry_engines for inequality.
+ *  \param lhs The first \p threefry_engine to test.
+ *  \param rhs The second \p threefry_engine to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template<typename UIntType_, size_t w_, size_t r_>
+THRUST_HOST_DEVICE
+bool operator!=(const threefry_engine<UIntType_,w_,r_> &lhs,
+                const threefry_engine<UIntType_,w_,r_> &rhs);
+
+
+/*! This function streams a threefry_engine to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param e The \p threefry_engine to stream out.
+ *  \return \p os
+ */
+template<typename UIntType_, size_t w_, size_t r_,
+         typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits> &os,
+           const threefry_engine<UIntType_,w_,r_> &e);
+
+
+/*! This function streams a threefry_engine in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param e The \p threefry_engine to stream in.
+ *  \return \p is
+ */
+template<typename UIntType_, size_t w_, size_t r_,
+         typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits> &is,
+           threefry_engine<UIntType_,w_,r_> &e);
+
+
+/*! \} // end random_number_engine_templates
+ */
+
+
+/*! \addtogroup predefined_random
+ *  \{
+ */
+
+/*! \typedef threefry4x32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry4x32-20 counter-based random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry4x32
+ *        shall produce the value \c 112810865 .
+ */
+typedef threefry_engine<thrust::detail::uint32_t, 32, 20> threefry4x32;
+
+
+/*! \typedef threefry4x64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry4x64-20 counter-based random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry4x64
+ *        shall produce the value \c 9253438642465275567 .
+ */
+typedef threefry_engine<thrust::detail::uint64_t, 64, 20> threefry4x64;
+
+/*! \} // end predefined_random
+ */
+
+} // end random
+
+// import names into thrust::
+using random::threefry_engine;
+using random::threefry4x32;
+using random::threefry4x64;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/threefry_engine.inl>
+
@@ -82,6 +82,24 @@ using universal_allocator = thrust::mr::stateless_resource_allocator<
   T, thrust::system::cpp::universal_memory_resource
 >;
 
+/*! \p cpp::huge_page_allocator allocates memory for large arrays of the
+ *  \p cpp system, backed by transparent huge pages where it is supported.
+ *  Small allocations are served like those of \p cpp::allocator.
+ */
+template<typename T>
+using huge_page_allocator = thrust::mr::stateless_resource_allocator<
+  T, thrust::system::cpp::huge_page_memory_resource
+>;
+
+/*! \p cpp::numa_allocator allocates memory for large arrays of the \p cpp
+ *  system, with pages interleaved across NUMA nodes where it is supported.
+ *  Small allocations are served like those of \p cpp::allocator.
+ */
+template<typename T>
+using numa_allocator = thrust::mr::stateless_resource_allocator<
+  T, thrust::system::cpp::numa_memory_resource
+>;
+
 }} // namespace system::cpp
 
 /*! \namespace thrust::cpp
@@ -92,6 +110,8 @@ namespace cpp
 using thrust::system::cpp::malloc;
 using thrust::system::cpp::free;
 using thrust::system::cpp::allocator;
+using thrust::system::cpp::huge_page_allocator;
+using thrust::system::cpp::numa_allocator;
 } // namespace cpp
 
 THRUST_NAMESPACE_END
@@ -0,0 +1,173 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file deterministic_reduce.h
+ *  \brief Thread count independent reduction shared by the parallel host systems.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// Policies of the host systems allow nondeterministic results unless they
+// declare a friend overload returning false_type, like par_det does.
+template <typename DerivedPolicy>
+THRUST_HOST_DEVICE thrust::detail::true_type
+allows_nondeterminism(const thrust::execution_policy<DerivedPolicy>&)
+{
+  return {};
+}
+
+template <typename DerivedPolicy>
+struct is_deterministic_policy
+    : thrust::detail::integral_constant<
+        bool,
+        !decltype(allows_nondeterminism(std::declval<const DerivedPolicy&>()))::value>
+{};
+
+namespace deterministic_reduce_detail
+{
+
+// The input is split into chunks of a fixed size, each chunk is folded from
+// left to right by a single thread, and the partial sums are reduced again in
+// the same way until a single chunk is left. The shape of this tree is a pure
+// function of the input size, so floating point results are bitwise identical
+// for any number of threads.
+
+// Large enough to amortize the dispatch of a chunk, small enough that inputs
+// of a few chunks still run in parallel
+constexpr std::size_t chunk_size = 4096;
+
+template <typename Size, typename InputIterator, typename OutputType, typename BinaryFunction>
+struct reduce_chunk
+{
+  InputIterator first;
+  Size n;
+  OutputType* partials;
+  thrust::detail::wrapped_function<BinaryFunction, OutputType> binary_op;
+
+  THRUST_EXEC_CHECK_DISABLE
+  THRUST_HOST_DEVICE void operator()(Size chunk) const
+  {
+    const Size begin = chunk * static_cast<Size>(chunk_size);
+    const Size end   = (thrust::min<Size>)(n, begin + static_cast<Size>(chunk_size));
+
+    InputIterator iter = first + begin;
+
+    // note: we only initialize sum with the first element to avoid calling OutputType's default constructor
+    OutputType sum = thrust::raw_reference_cast(*iter);
+
+    ++iter;
+
+    for(Size i = begin + 1; i < end; ++i, ++iter)
+    {
+      sum = binary_op(sum, *iter);
+    }
+
+    partials[chunk] = sum;
+  }
+};
+
+template <typename Size>
+THRUST_HOST_DEVICE Size num_chunks(Size n)
+{
+  return (n + static_cast<Size>(chunk_size) - 1) / static_cast<Size>(chunk_size);
+}
+
+} // end namespace deterministic_reduce_detail
+
+// Reduces [first, last) with a tree of fixed size chunks. The parallel passes
+// are dispatched through thrust::for_each_n on exec.
+template <typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction>
+OutputType deterministic_reduce(thrust::execution_policy<DerivedPolicy>& exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputType init,
+                                BinaryFunction binary_op)
+{
+  using namespace deterministic_reduce_detail;
+  typedef typename thrust::iterator_difference<InputIterator>::type Size;
+
+  const Size n = last - first;
+  if(n <= 0)
+  {
+    return init;
+  }
+
+  thrust::counting_iterator<Size> chunk_it(0);
+
+  Size count = num_chunks(n);
+  thrust::detail::temporary_array<OutputType, DerivedPolicy> partials(exec, count);
+  OutputType* partials_ptr = thrust::raw_pointer_cast(partials.data());
+
+  thrust::for_each_n(exec, chunk_it, count,
+                     reduce_chunk<Size, InputIterator, OutputType, BinaryFunction>{
+                       first, n, partials_ptr, binary_op});
+
+  // Only inputs of more than chunk_size^2 elements need more than one level
+  thrust::detail::temporary_array<OutputType, DerivedPolicy> next(
+    exec, count > static_cast<Size>(chunk_size) ? num_chunks(count) : Size(0));
+  OutputType* next_ptr = thrust::raw_pointer_cast(next.data());
+
+  while(count > static_cast<Size>(chunk_size))
+  {
+    const Size next_count = num_chunks(count);
+    thrust::for_each_n(exec, chunk_it, next_count,
+                       reduce_chunk<Size, OutputType*, OutputType, BinaryFunction>{
+                         partials_ptr, count, next_ptr, binary_op});
+
+    OutputType* tmp = partials_ptr;
+    partials_ptr    = next_ptr;
+    next_ptr        = tmp;
+    count           = next_count;
+  }
+
+  // The last level holds at most chunk_size partial sums
+  thrust::detail::wrapped_function<BinaryFunction, OutputType> wrapped_binary_op(binary_op);
+
+  OutputType sum = partials_ptr[0];
+  for(Size i = 1; i < count; ++i)
+  {
+    sum = wrapped_binary_op(sum, partials_ptr[i]);
+  }
+
+  return wrapped_binary_op(init, sum);
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
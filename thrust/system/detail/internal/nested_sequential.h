@@ -0,0 +1,98 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file nested_sequential.h
+ *  \brief Sequential policy for the per-thread work of the parallel host systems.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execute_with_allocator.h>
+#include <thrust/detail/execute_with_temporary_memory_limit.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/pointer.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/adl/temporary_buffer.h>
+#include <thrust/system/detail/generic/temporary_buffer.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// Algorithms dispatched on this policy run sequentially like with thrust::seq,
+// but allocate their temporary storage through the policy of the enclosing
+// parallel call. This way the allocator and the temporary memory limit passed
+// to that call also apply to the tiles sorted by its threads.
+template <typename Policy>
+struct nested_sequential_policy
+    : thrust::system::detail::sequential::execution_policy<nested_sequential_policy<Policy>>
+{
+  THRUST_HOST_DEVICE explicit nested_sequential_policy(Policy& exec_)
+      : exec(exec_)
+  {}
+
+  Policy& exec;
+};
+
+template <typename DerivedPolicy>
+THRUST_HOST_DEVICE nested_sequential_policy<DerivedPolicy>
+nested_sequential(thrust::execution_policy<DerivedPolicy>& exec)
+{
+  return nested_sequential_policy<DerivedPolicy>(thrust::detail::derived_cast(exec));
+}
+
+// The accounting of thrust::get_temporary_buffer already counts the storage
+// once, so these call the customization points of the enclosing policy
+// directly rather than the interface functions.
+THRUST_EXEC_CHECK_DISABLE
+template <typename T, typename Policy>
+THRUST_HOST_DEVICE
+thrust::pair<thrust::pointer<T, Policy>, typename thrust::pointer<T, Policy>::difference_type>
+get_temporary_buffer(nested_sequential_policy<Policy>& system, std::ptrdiff_t n)
+{
+  using thrust::detail::get_temporary_buffer;
+  using thrust::system::detail::generic::get_temporary_buffer;
+
+  return get_temporary_buffer<T>(system.exec, n);
+}
+
+THRUST_EXEC_CHECK_DISABLE
+template <typename Policy, typename Pointer>
+THRUST_HOST_DEVICE void
+return_temporary_buffer(nested_sequential_policy<Policy>& system, Pointer p, std::ptrdiff_t n)
+{
+  using thrust::detail::return_temporary_buffer;
+  using thrust::system::detail::generic::return_temporary_buffer;
+
+  typedef typename thrust::detail::pointer_traits<Pointer>::element_type T;
+
+  return_temporary_buffer(system.exec, thrust::pointer<T, Policy>(thrust::raw_pointer_cast(p)), n);
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,297 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file scatter_shuffle.h
+ *  \brief Bucket-based scatter shuffle shared by the parallel host systems.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace scatter_shuffle_detail
+{
+
+// Every element is sent to a random bucket, and then each bucket is permuted
+// by a single thread with Fisher-Yates. Since the elements are assigned to
+// buckets independently of one another and with the same distribution, the
+// resulting permutation is uniform.
+//
+// The bucket of an element is a pure function of (seed, index), and the
+// Fisher-Yates stream of a bucket is a pure function of (seed, bucket), so the
+// result does not depend on the number of threads or on the way the input is
+// split into chunks.
+
+// Buckets are permuted in place by one thread, keep them cache resident
+constexpr std::uint64_t bucket_size = 1ull << 16;
+
+// Upper bound on the number of chunks used by the counting and scatter passes.
+// Each chunk holds one counter per bucket.
+constexpr std::uint64_t max_chunks = 128;
+
+constexpr std::uint64_t golden_gamma = UINT64_C(0x9E3779B97F4A7C15);
+
+// The splitmix64 finalizer
+THRUST_HOST_DEVICE inline std::uint64_t mix(std::uint64_t x)
+{
+  x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+  x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+  return x ^ (x >> 31);
+}
+
+// Requires num_buckets <= 2^32, i.e. at most 2^48 elements
+THRUST_HOST_DEVICE inline std::uint64_t
+bucket_of(std::uint64_t seed, std::uint64_t i, std::uint64_t num_buckets)
+{
+  const std::uint64_t h = mix(seed + golden_gamma * (i + 1)) >> 32;
+  return (h * num_buckets) >> 32;
+}
+
+// A splitmix64 stream used to permute a single bucket
+class bucket_engine
+{
+public:
+  THRUST_HOST_DEVICE bucket_engine(std::uint64_t seed, std::uint64_t bucket)
+      : m_state(mix(seed ^ mix(bucket + golden_gamma)))
+  {}
+
+  THRUST_HOST_DEVICE std::uint64_t operator()()
+  {
+    m_state += golden_gamma;
+    return mix(m_state);
+  }
+
+  // Returns an unbiased integer in [0, bound)
+  THRUST_HOST_DEVICE std::uint64_t operator()(std::uint64_t bound)
+  {
+    if(bound <= UINT64_C(0xFFFFFFFF))
+    {
+      // Lemire's multiply-shift with rejection
+      std::uint64_t m = ((*this)() >> 32) * bound;
+      std::uint32_t l = static_cast<std::uint32_t>(m);
+      if(l < bound)
+      {
+        const std::uint32_t t = static_cast<std::uint32_t>(-static_cast<std::uint32_t>(bound)) % static_cast<std::uint32_t>(bound);
+        while(l < t)
+        {
+          m = ((*this)() >> 32) * bound;
+          l = static_cast<std::uint32_t>(m);
+        }
+      }
+      return m >> 32;
+    }
+
+    const std::uint64_t t = (0 - bound) % bound;
+    std::uint64_t r = (*this)();
+    while(r < t)
+    {
+      r = (*this)();
+    }
+    return r % bound;
+  }
+
+private:
+  std::uint64_t m_state;
+};
+
+template <typename Size>
+struct count_chunk
+{
+  std::uint64_t seed;
+  Size n;
+  Size num_buckets;
+  Size chunk_size;
+  Size* counts;
+
+  THRUST_HOST_DEVICE void operator()(Size chunk) const
+  {
+    Size* my_counts = counts + chunk * num_buckets;
+    for(Size b = 0; b < num_buckets; ++b)
+    {
+      my_counts[b] = 0;
+    }
+
+    const Size begin = chunk * chunk_size;
+    const Size end   = (thrust::min<Size>)(n, begin + chunk_size);
+    for(Size i = begin; i < end; ++i)
+    {
+      ++my_counts[bucket_of(seed, i, num_buckets)];
+    }
+  }
+};
+
+// Turns the per-chunk counts of a bucket into per-chunk write offsets
+template <typename Size>
+struct offset_bucket
+{
+  Size num_chunks;
+  Size num_buckets;
+  Size* counts;
+  const Size* bucket_begin;
+
+  THRUST_HOST_DEVICE void operator()(Size bucket) const
+  {
+    Size offset = bucket_begin[bucket];
+    for(Size c = 0; c < num_chunks; ++c)
+    {
+      const Size count = counts[c * num_buckets + bucket];
+      counts[c * num_buckets + bucket] = offset;
+      offset += count;
+    }
+  }
+};
+
+template <typename Size>
+struct scatter_chunk
+{
+  std::uint64_t seed;
+  Size n;
+  Size num_buckets;
+  Size chunk_size;
+  Size* offsets;
+  Size* indices;
+
+  THRUST_HOST_DEVICE void operator()(Size chunk) const
+  {
+    Size* my_offsets = offsets + chunk * num_buckets;
+
+    const Size begin = chunk * chunk_size;
+    const Size end   = (thrust::min<Size>)(n, begin + chunk_size);
+    for(Size i = begin; i < end; ++i)
+    {
+      indices[my_offsets[bucket_of(seed, i, num_buckets)]++] = i;
+    }
+  }
+};
+
+template <typename Size, typename RandomIterator, typename OutputIterator>
+struct permute_bucket
+{
+  std::uint64_t seed;
+  const Size* bucket_begin;
+  Size* indices;
+  RandomIterator first;
+  OutputIterator result;
+
+  THRUST_EXEC_CHECK_DISABLE
+  THRUST_HOST_DEVICE void operator()(Size bucket) const
+  {
+    const Size begin = bucket_begin[bucket];
+    const Size end   = bucket_begin[bucket + 1];
+
+    bucket_engine engine(seed, static_cast<std::uint64_t>(bucket));
+    for(Size i = end - begin; i > 1; --i)
+    {
+      const Size j = static_cast<Size>(engine(static_cast<std::uint64_t>(i)));
+      const Size tmp          = indices[begin + i - 1];
+      indices[begin + i - 1]  = indices[begin + j];
+      indices[begin + j]      = tmp;
+    }
+
+    for(Size i = begin; i < end; ++i)
+    {
+      result[i] = first[indices[i]];
+    }
+  }
+};
+
+} // end namespace scatter_shuffle_detail
+
+// Shuffles [first, last) into result using only O(n) work and a single
+// index per element of temporary storage. The parallel passes are dispatched
+// through thrust::for_each_n on exec.
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void scatter_shuffle_copy(thrust::execution_policy<DerivedPolicy>& exec,
+                          RandomIterator first,
+                          RandomIterator last,
+                          OutputIterator result,
+                          URBG&& g)
+{
+  using namespace scatter_shuffle_detail;
+  typedef typename thrust::iterator_difference<RandomIterator>::type Size;
+
+  // Consume the generator the same way regardless of the input size
+  const std::uint64_t hi          = static_cast<std::uint64_t>(g());
+  const std::uint64_t lo          = static_cast<std::uint64_t>(g());
+  const std::uint64_t bucket_seed = mix((hi << 32) ^ lo);
+  const std::uint64_t permute_seed = mix(bucket_seed ^ golden_gamma);
+
+  const Size n = last - first;
+  if(n <= 0)
+  {
+    return;
+  }
+
+  const Size num_buckets = static_cast<Size>((static_cast<std::uint64_t>(n) + bucket_size - 1) / bucket_size);
+  const Size num_chunks  = (thrust::min<Size>)(num_buckets, static_cast<Size>(max_chunks));
+  const Size chunk_size  = (n + num_chunks - 1) / num_chunks;
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> counts(exec, num_chunks * num_buckets);
+  thrust::detail::temporary_array<Size, DerivedPolicy> bucket_begin(exec, num_buckets + 1);
+  thrust::detail::temporary_array<Size, DerivedPolicy> indices(exec, n);
+
+  Size* counts_ptr       = thrust::raw_pointer_cast(counts.data());
+  Size* bucket_begin_ptr = thrust::raw_pointer_cast(bucket_begin.data());
+  Size* indices_ptr      = thrust::raw_pointer_cast(indices.data());
+
+  thrust::counting_iterator<Size> chunk_it(0);
+  thrust::counting_iterator<Size> bucket_it(0);
+
+  thrust::for_each_n(exec, chunk_it, num_chunks,
+                     count_chunk<Size>{bucket_seed, n, num_buckets, chunk_size, counts_ptr});
+
+  // There are at most n / bucket_size buckets, a serial scan is cheap
+  Size offset = 0;
+  for(Size b = 0; b < num_buckets; ++b)
+  {
+    bucket_begin_ptr[b] = offset;
+    for(Size c = 0; c < num_chunks; ++c)
+    {
+      offset += counts_ptr[c * num_buckets + b];
+    }
+  }
+  bucket_begin_ptr[num_buckets] = offset;
+
+  thrust::for_each_n(exec, bucket_it, num_buckets,
+                     offset_bucket<Size>{num_chunks, num_buckets, counts_ptr, bucket_begin_ptr});
+
+  thrust::for_each_n(exec, chunk_it, num_chunks,
+                     scatter_chunk<Size>{bucket_seed, n, num_buckets, chunk_size, counts_ptr, indices_ptr});
+
+  thrust::for_each_n(exec, bucket_it, num_buckets,
+                     permute_bucket<Size, RandomIterator, OutputIterator>{
+                       permute_seed, bucket_begin_ptr, indices_ptr, first, result});
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
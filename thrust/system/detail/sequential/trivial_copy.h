@@ -52,7 +52,9 @@ THRUST_HOST_DEVICE
   T* return_value = NULL;
 
   NV_IF_TARGET(NV_IS_HOST, (
-    std::memmove(result, first, n * sizeof(T));
+    // types proclaimed trivially relocatable need not be trivially copyable;
+    // copying through void pointers tells the compiler the bitwise copy is intended
+    std::memmove(static_cast<void*>(result), static_cast<const void*>(first), n * sizeof(T));
     return_value = result + n;
   ), ( // NV_IS_DEVICE:
     return_value = thrust::system::detail::sequential::general_copy_n(first, n, result);
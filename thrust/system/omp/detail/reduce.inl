@@ -24,6 +24,7 @@
 #include <thrust/system/omp/detail/reduce.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
+#include <thrust/system/detail/internal/deterministic_reduce.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -44,6 +45,13 @@ template<typename DerivedPolicy,
                     OutputType init,
                     BinaryFunction binary_op)
 {
+  // the decomposition below depends on the number of threads, par_det reduces
+  // with a tree whose shape only depends on the input size
+  if(thrust::system::detail::internal::is_deterministic_policy<DerivedPolicy>::value)
+  {
+    return thrust::system::detail::internal::deterministic_reduce(exec, first, last, init, binary_op);
+  }
+
   typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
 
   const difference_type n = thrust::distance(first,last);
@@ -30,6 +30,10 @@
 #include <thrust/merge.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/nested_sequential.h>
+
+#include <atomic>
+#include <exception>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -42,6 +46,45 @@ namespace sort_detail
 {
 
 
+// Exceptions must not escape a parallel region. The first exception thrown by
+// a thread is kept and rethrown after the region; the other threads skip their
+// remaining work, but still reach every barrier.
+class parallel_exception
+{
+public:
+  parallel_exception() : m_failed(false) {}
+
+  bool failed() const
+  {
+    return m_failed.load(std::memory_order_relaxed);
+  }
+
+  void capture()
+  {
+    THRUST_PRAGMA_OMP(critical)
+    {
+      if(!m_exception)
+      {
+        m_exception = std::current_exception();
+      }
+    }
+    m_failed.store(true, std::memory_order_relaxed);
+  }
+
+  void rethrow() const
+  {
+    if(m_exception)
+    {
+      std::rethrow_exception(m_exception);
+    }
+  }
+
+private:
+  std::atomic<bool> m_failed;
+  std::exception_ptr m_exception;
+};
+
+
 template<typename DerivedPolicy,
          typename RandomAccessIterator,
          typename StrictWeakOrdering>
@@ -121,6 +164,8 @@ void stable_sort(execution_policy<DerivedPolicy> &exec,
   if(first == last)
     return;
 
+  sort_detail::parallel_exception error;
+
   THRUST_PRAGMA_OMP(parallel)
   {
     thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
@@ -128,13 +173,21 @@ void stable_sort(execution_policy<DerivedPolicy> &exec,
     // process id
     IndexType p_i = omp_get_thread_num();
 
-    // every thread sorts its own tile
+    // every thread sorts its own tile, allocating through exec so that its
+    // allocator and temporary memory limit apply
     if(p_i < decomp.size())
     {
-      thrust::stable_sort(thrust::seq,
-                          first + decomp[p_i].begin(),
-                          first + decomp[p_i].end(),
-                          comp);
+      try
+      {
+        thrust::stable_sort(thrust::system::detail::internal::nested_sequential(exec),
+                            first + decomp[p_i].begin(),
+                            first + decomp[p_i].end(),
+                            comp);
+      }
+      catch(...)
+      {
+        error.capture();
+      }
     }
 
     THRUST_PRAGMA_OMP(barrier)
@@ -155,11 +208,21 @@ void stable_sort(execution_policy<DerivedPolicy> &exec,
 
       if((p_i % h) == 0 && c > b)
       {
-        sort_detail::inplace_merge(exec,
-                                   first + decomp[a].begin(),
-                                   first + decomp[b].end(),
-                                   first + decomp[c].end(),
-                                   comp);
+        if(!error.failed())
+        {
+          try
+          {
+            sort_detail::inplace_merge(exec,
+                                       first + decomp[a].begin(),
+                                       first + decomp[b].end(),
+                                       first + decomp[c].end(),
+                                       comp);
+          }
+          catch(...)
+          {
+            error.capture();
+          }
+        }
 
         b = c;
         c += h;
@@ -171,6 +234,8 @@ void stable_sort(execution_policy<DerivedPolicy> &exec,
       THRUST_PRAGMA_OMP(barrier)
     }
   }
+
+  error.rethrow();
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
@@ -204,6 +269,8 @@ void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
   if(keys_first == keys_last)
     return;
 
+  sort_detail::parallel_exception error;
+
   THRUST_PRAGMA_OMP(parallel)
   {
     thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(keys_last - keys_first, 1, omp_get_num_threads());
@@ -211,14 +278,22 @@ void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
     // process id
     IndexType p_i = omp_get_thread_num();
 
-    // every thread sorts its own tile
+    // every thread sorts its own tile, allocating through exec so that its
+    // allocator and temporary memory limit apply
     if(p_i < decomp.size())
     {
-      thrust::stable_sort_by_key(thrust::seq,
-                                 keys_first + decomp[p_i].begin(),
-                                 keys_first + decomp[p_i].end(),
-                                 values_first + decomp[p_i].begin(),
-                                 comp);
+      try
+      {
+        thrust::stable_sort_by_key(thrust::system::detail::internal::nested_sequential(exec),
+                                   keys_first + decomp[p_i].begin(),
+                                   keys_first + decomp[p_i].end(),
+                                   values_first + decomp[p_i].begin(),
+                                   comp);
+      }
+      catch(...)
+      {
+        error.capture();
+      }
     }
 
     THRUST_PRAGMA_OMP(barrier)
@@ -239,12 +314,22 @@ void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
 
       if((p_i % h) == 0 && c > b)
       {
-        sort_detail::inplace_merge_by_key(exec,
-                                          keys_first + decomp[a].begin(),
-                                          keys_first + decomp[b].end(),
-                                          keys_first + decomp[c].end(),
-                                          values_first + decomp[a].begin(),
-                                          comp);
+        if(!error.failed())
+        {
+          try
+          {
+            sort_detail::inplace_merge_by_key(exec,
+                                              keys_first + decomp[a].begin(),
+                                              keys_first + decomp[b].end(),
+                                              keys_first + decomp[c].end(),
+                                              values_first + decomp[a].begin(),
+                                              comp);
+          }
+          catch(...)
+          {
+            error.capture();
+          }
+        }
 
         b = c;
         c += h;
@@ -256,6 +341,8 @@ void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
       THRUST_PRAGMA_OMP(barrier)
     }
   }
+
+  error.rethrow();
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
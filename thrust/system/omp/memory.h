@@ -82,6 +82,24 @@ using universal_allocator = thrust::mr::stateless_resource_allocator<
   T, thrust::system::omp::universal_memory_resource
 >;
 
+/*! \p omp::huge_page_allocator allocates memory for large arrays of the
+ *  \p omp system, backed by transparent huge pages where it is supported.
+ *  Small allocations are served like those of \p omp::allocator.
+ */
+template<typename T>
+using huge_page_allocator = thrust::mr::stateless_resource_allocator<
+  T, thrust::system::omp::huge_page_memory_resource
+>;
+
+/*! \p omp::numa_allocator allocates memory for large arrays of the \p omp
+ *  system, with pages interleaved across NUMA nodes where it is supported.
+ *  Small allocations are served like those of \p omp::allocator.
+ */
+template<typename T>
+using numa_allocator = thrust::mr::stateless_resource_allocator<
+  T, thrust::system::omp::numa_memory_resource
+>;
+
 }} // namespace system::omp
 
 /*! \namespace thrust::omp
@@ -93,6 +111,8 @@ using thrust::system::omp::malloc;
 using thrust::system::omp::free;
 using thrust::system::omp::allocator;
 using thrust::system::omp::universal_allocator;
+using thrust::system::omp::huge_page_allocator;
+using thrust::system::omp::numa_allocator;
 } // namespace omp
 
 THRUST_NAMESPACE_END
@@ -18,6 +18,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/type_traits.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -38,10 +39,37 @@ struct par_t : thrust::system::tbb::detail::execution_policy<par_t>,
 };
 
 
+// Policies deriving from this one reduce with a tree of fixed size chunks,
+// which gives the same floating point results for any number of threads.
+template<typename Derived>
+struct deterministic_execution_policy : thrust::system::tbb::detail::execution_policy<Derived>
+{
+  THRUST_HOST_DEVICE
+  constexpr deterministic_execution_policy() : thrust::system::tbb::detail::execution_policy<Derived>() {}
+
+private:
+  friend THRUST_HOST_DEVICE thrust::detail::integral_constant<bool, false>
+  allows_nondeterminism(const deterministic_execution_policy&)
+  {
+    return {};
+  }
+};
+
+
+struct par_det_t : thrust::system::tbb::detail::deterministic_execution_policy<par_det_t>,
+  thrust::detail::allocator_aware_execution_policy<
+    thrust::system::tbb::detail::deterministic_execution_policy>
+{
+  THRUST_HOST_DEVICE
+  constexpr par_det_t() : thrust::system::tbb::detail::deterministic_execution_policy<par_det_t>() {}
+};
+
+
 } // end detail
 
 
 static const detail::par_t par;
+static const detail::par_det_t par_det;
 
 
 } // end tbb
@@ -54,6 +82,7 @@ namespace tbb
 
 
 using thrust::system::tbb::par;
+using thrust::system::tbb::par_det;
 
 
 } // end tbb
@@ -23,6 +23,7 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
 #include <thrust/reduce.h>
+#include <thrust/system/detail/internal/deterministic_reduce.h>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_reduce.h>
 
@@ -99,12 +100,20 @@ template<typename DerivedPolicy,
          typename InputIterator, 
          typename OutputType,
          typename BinaryFunction>
-  OutputType reduce(execution_policy<DerivedPolicy> &,
+  OutputType reduce(execution_policy<DerivedPolicy> &exec,
                     InputIterator begin,
                     InputIterator end,
                     OutputType init,
                     BinaryFunction binary_op)
 {
+  // the auto partitioner splits the range depending on the number of threads
+  // and on work stealing, par_det reduces with a tree whose shape only depends
+  // on the input size
+  if (thrust::system::detail::internal::is_deterministic_policy<DerivedPolicy>::value)
+  {
+    return thrust::system::detail::internal::deterministic_reduce(exec, begin, end, init, binary_op);
+  }
+
   typedef typename thrust::iterator_difference<InputIterator>::type Size; 
 
   Size n = thrust::distance(begin, end);
@@ -24,6 +24,7 @@
 #include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/detail/seq.h>
+#include <thrust/system/detail/internal/nested_sequential.h>
 #include <tbb/parallel_invoke.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -74,7 +75,8 @@ void merge_sort(execution_policy<DerivedPolicy> &exec, Iterator1 first1, Iterato
 
   if (n < threshold)
   {
-    thrust::stable_sort(thrust::seq, first1, last1, comp);
+    // allocate through exec, so that its allocator and temporary memory limit apply
+    thrust::stable_sort(thrust::system::detail::internal::nested_sequential(exec), first1, last1, comp);
 
     if(!inplace)
     {
@@ -189,7 +191,8 @@ void merge_sort_by_key(execution_policy<DerivedPolicy> &exec,
 
   if (n < threshold)
   {
-    thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
+    // allocate through exec, so that its allocator and temporary memory limit apply
+    thrust::stable_sort_by_key(thrust::system::detail::internal::nested_sequential(exec), first1, last1, first2, comp);
 
     if(!inplace)
     {
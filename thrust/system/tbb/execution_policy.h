@@ -143,6 +143,27 @@ struct tag : thrust::system::tbb::execution_policy<tag> { unspecified };
 static const unspecified par;
 
 
+/*! \p thrust::tbb::par_det is a parallel execution policy of Thrust's TBB backend system
+ *  whose reductions give bitwise identical results regardless of the number of threads.
+ *
+ *  \p thrust::reduce called with \p thrust::tbb::par_det splits its input into chunks of a
+ *  fixed number of elements, folds each chunk from left to right, and reduces the partial sums in
+ *  the same way, so the order in which a floating point sum is evaluated only depends on the size of
+ *  the input. This is slightly slower than \p thrust::tbb::par on small inputs. Other
+ *  algorithms behave as with \p thrust::tbb::par.
+ *
+ *  Like \p thrust::tbb::par, it accepts an allocator for its temporary storage.
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/system/tbb/execution_policy.h>
+ *  ...
+ *  float sum = thrust::reduce(thrust::tbb::par_det, vec.begin(), vec.end());
+ *  \endcode
+ */
+static const unspecified par_det;
+
+
 /*! \}
  */
 
@@ -84,6 +84,24 @@ using universal_allocator = thrust::mr::stateless_resource_allocator<
   T, thrust::system::tbb::universal_memory_resource
 >;
 
+/*! \p tbb::huge_page_allocator allocates memory for large arrays of the
+ *  \p tbb system, backed by transparent huge pages where it is supported.
+ *  Small allocations are served like those of \p tbb::allocator.
+ */
+template<typename T>
+using huge_page_allocator = thrust::mr::stateless_resource_allocator<
+  T, thrust::system::tbb::huge_page_memory_resource
+>;
+
+/*! \p tbb::numa_allocator allocates memory for large arrays of the \p tbb
+ *  system, with pages interleaved across NUMA nodes where it is supported.
+ *  Small allocations are served like those of \p tbb::allocator.
+ */
+template<typename T>
+using numa_allocator = thrust::mr::stateless_resource_allocator<
+  T, thrust::system::tbb::numa_memory_resource
+>;
+
 }} // namespace system::tbb
 
 /*! \namespace thrust::tbb
@@ -95,6 +113,8 @@ using thrust::system::tbb::malloc;
 using thrust::system::tbb::free;
 using thrust::system::tbb::allocator;
 using thrust::system::tbb::universal_allocator;
+using thrust::system::tbb::huge_page_allocator;
+using thrust::system::tbb::numa_allocator;
 } // namsespace tbb
 
 THRUST_NAMESPACE_END
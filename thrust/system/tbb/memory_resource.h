@@ -22,6 +22,8 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/mr/new.h>
+#include <thrust/mr/huge_page.h>
+#include <thrust/mr/numa.h>
 #include <thrust/mr/fancy_pointer_resource.h>
 
 #include <thrust/system/tbb/pointer.h>
@@ -42,6 +44,16 @@ namespace detail
         thrust::mr::new_delete_resource,
         thrust::tbb::universal_pointer<void>
     > universal_native_resource;
+
+    typedef thrust::mr::fancy_pointer_resource<
+        thrust::mr::huge_page_resource,
+        thrust::tbb::pointer<void>
+    > huge_page_native_resource;
+
+    typedef thrust::mr::fancy_pointer_resource<
+        thrust::mr::numa_resource,
+        thrust::tbb::pointer<void>
+    > numa_native_resource;
 } // namespace detail
 //! \endcond
 
@@ -60,6 +72,16 @@ typedef detail::native_resource memory_resource;
 typedef detail::universal_native_resource universal_memory_resource;
 /*! An alias for \p tbb::universal_memory_resource. */
 typedef detail::native_resource universal_host_pinned_memory_resource;
+/*! The memory resource for the TBB system for large arrays. Uses
+ *  \p mr::huge_page_resource with transparent huge pages and tags it with
+ *  \p tbb::pointer.
+ */
+typedef detail::huge_page_native_resource huge_page_memory_resource;
+/*! The memory resource for the TBB system for large arrays used by many
+ *  threads. Uses \p mr::numa_resource, which interleaves the pages across
+ *  NUMA nodes, and tags it with \p tbb::pointer.
+ */
+typedef detail::numa_native_resource numa_memory_resource;
 
 /*! \} // memory_resources
  */
@@ -23,6 +23,9 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/tbb/memory.h>
+// So that the vector is constructed and filled by the algorithms of its system,
+// which may be neither the host nor the device system
+#include <thrust/system/tbb/execution_policy.h>
 #include <thrust/detail/vector_base.h>
 #include <vector>
 
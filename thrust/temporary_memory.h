@@ -0,0 +1,121 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/temporary_memory.h
+ *  \brief Accounting of the temporary storage allocated by the algorithms, and a limit on it.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup memory_management Memory Management
+ *  \{
+ */
+
+/*! The temporary storage allocated with \p get_temporary_buffer on the calling thread, returned by
+ *      \p get_temporary_memory_stats(). This includes the scratch space of every algorithm, except for the allocations
+ *      made through an allocator or memory resource passed with the execution policy.
+ *
+ *  Storage returned by a different thread than the one that allocated it is subtracted from the thread returning it,
+ *      whose count of bytes in use does not go below 0.
+ */
+struct temporary_memory_stats
+{
+  /*! The number of bytes of temporary storage currently allocated.
+   */
+  std::size_t current_bytes;
+  /*! The largest number of bytes of temporary storage allocated at once since the last call to
+   *      \p reset_temporary_memory_stats().
+   */
+  std::size_t peak_bytes;
+  /*! The total number of bytes of temporary storage allocated since the last call to
+   *      \p reset_temporary_memory_stats().
+   */
+  std::size_t cumulative_bytes;
+  /*! The number of allocations of temporary storage since the last call to \p reset_temporary_memory_stats().
+   */
+  std::size_t allocations;
+};
+
+/*! Returns the accounting of the temporary storage of the calling thread.
+ *
+ *  The peak of a single algorithm call is obtained by calling \p reset_temporary_memory_stats() before it, or from the
+ *      \p peak_temporary_bytes of its end event when tracing is enabled (see \p thrust/trace.h).
+ *
+ *  \code
+ *  #include <thrust/temporary_memory.h>
+ *  ...
+ *  thrust::reset_temporary_memory_stats();
+ *  thrust::reduce_by_key(thrust::device, keys.begin(), keys.end(), values.begin(), keys_out.begin(), values_out.begin());
+ *  std::size_t peak = thrust::get_temporary_memory_stats().peak_bytes;
+ *  \endcode
+ */
+inline temporary_memory_stats get_temporary_memory_stats();
+
+/*! Resets the peak of the temporary storage of the calling thread to the storage currently allocated, and the
+ *      cumulative bytes and allocations to 0.
+ */
+inline void reset_temporary_memory_stats();
+
+/*! An option capping the temporary storage an execution policy may allocate, passed to the policy in the same way as
+ *      an allocator.
+ *
+ *  An algorithm called with the resulting policy throws \p thrust::system_error with the error code
+ *      \p errc::not_enough_memory, instead of allocating temporary storage that would bring the temporary storage in use
+ *      through the policy above \p bytes. The temporary storage is otherwise allocated as with the original policy.
+ *
+ *  The storage in use is counted by the policy and its copies, not per thread: the allocations made by the worker
+ *      threads of the OMP and TBB systems on behalf of the algorithm are charged to the same limit.
+ *
+ *  \code
+ *  #include <thrust/temporary_memory.h>
+ *  ...
+ *  try
+ *  {
+ *    thrust::sort(thrust::device(thrust::temporary_memory_limit(1 << 30)), keys.begin(), keys.end());
+ *  }
+ *  catch(thrust::system_error &e)
+ *  {
+ *    // e.what() tells the size of the allocation and the limit
+ *  }
+ *  \endcode
+ */
+struct temporary_memory_limit
+{
+  /*! Constructor.
+   *
+   *  \param bytes_ the largest number of bytes of temporary storage in use at once
+   */
+  explicit temporary_memory_limit(std::size_t bytes_)
+    : bytes(bytes_)
+  {}
+
+  /*! The largest number of bytes of temporary storage in use at once.
+   */
+  std::size_t bytes;
+};
+
+/*! \} // memory_management
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/temporary_memory.inl>
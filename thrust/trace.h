@@ -0,0 +1,208 @@
+/*
+ *  Copyright 2025 Advanced Micro Devices, Inc.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/trace.h
+ *  \brief Hooks reporting the beginning and the end of each algorithm call, and a writer of Chrome trace files.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup utility
+ *  \{
+ */
+
+/*! \namespace thrust::trace
+ *  \brief \p thrust::trace contains the hooks that report the algorithms called by a program.
+ *
+ *  Algorithms only report their calls when the program is compiled with \p THRUST_ENABLE_TRACING defined before any Thrust
+ *  header is included. Otherwise the hooks compile to nothing, and the callback set with \p set_callback() is never
+ *  called.
+ *
+ *  When tracing is enabled, each algorithm called with an execution policy, or with iterators from which one is deduced,
+ *  emits a \p begin event before it runs and an \p end event after it returns or throws. Algorithms implemented with other
+ *  algorithms emit nested events for them.
+ */
+namespace trace
+{
+
+/*! The kind of a trace event.
+ */
+enum class phase
+{
+  /*! An algorithm is about to run.
+   */
+  begin,
+  /*! An algorithm has returned, or has thrown an exception.
+   */
+  end
+};
+
+/*! An event reported to the trace callback.
+ */
+struct event
+{
+  /*! Whether the algorithm begins or ends.
+   */
+  trace::phase phase;
+  /*! The name of the algorithm, such as \c "reduce_by_key".
+   */
+  const char * algorithm;
+  /*! The system the algorithm runs on: \c "cpp", \c "omp", \c "tbb", \c "hip", \c "cuda", \c "seq", or \c "unknown"
+   *      for a user defined system.
+   */
+  const char * backend;
+  /*! The number of elements in the first input range, or 0 when it can only be counted by walking it.
+   */
+  std::size_t count;
+  /*! The size of the value type of the first input range.
+   */
+  std::size_t value_size;
+  /*! The number of bytes of temporary storage the algorithm allocated, including the storage allocated by the nested
+   *      algorithms it called. Always 0 in \p begin events.
+   */
+  std::size_t temporary_bytes;
+  /*! The largest number of bytes of temporary storage the algorithm, and the nested algorithms it called, had allocated
+   *      at once, not counting the storage already allocated on the thread when it began. Always 0 in \p begin events.
+   *      See also \p thrust::get_temporary_memory_stats().
+   */
+  std::size_t peak_temporary_bytes;
+  /*! The time of the event in nanoseconds, measured by \p std::chrono::steady_clock.
+   */
+  std::uint64_t timestamp;
+  /*! A small number identifying the host thread that called the algorithm, 1 for the first thread that emitted an event.
+   */
+  std::uint64_t thread;
+};
+
+/*! The type of the function that receives the trace events, set with \p set_callback().
+ *
+ *  \param e the event
+ *  \param user_data the pointer passed to \p set_callback()
+ */
+typedef void (*callback)(const event & e, void * user_data);
+
+/*! Returns whether this translation unit was compiled with \p THRUST_ENABLE_TRACING, and its algorithms therefore report
+ *      their calls.
+ */
+inline constexpr bool enabled()
+{
+#if defined(THRUST_ENABLE_TRACING)
+  return true;
+#else
+  return false;
+#endif
+}
+
+/*! Sets the function receiving the trace events of every thread, or unsets it if \p cb is null.
+ *
+ *  The callback is never called by two threads at once, and once \p set_callback() returns the previous callback is no
+ *      longer being called. Events emitted from within the callback, if it calls Thrust algorithms itself, are dropped.
+ *
+ *  \param cb the function to call for every event
+ *  \param user_data a pointer passed to each call of \p cb
+ */
+inline void set_callback(callback cb, void * user_data = NULL);
+
+/*! Returns the function currently receiving the trace events, or null if there is none.
+ */
+inline callback get_callback();
+
+/*! Writes the trace events to a file in the Chrome trace event format, which can be opened in \c chrome://tracing or
+ *      in Perfetto. Each algorithm call becomes a slice on the timeline of its thread, with its backend as the category
+ *      and its element count, value size, and temporary and peak temporary bytes as arguments.
+ *
+ *  The file is complete once the writer is destroyed or \p close() is called.
+ *
+ *  \code
+ *  #define THRUST_ENABLE_TRACING
+ *  #include <thrust/trace.h>
+ *  ...
+ *  thrust::trace::chrome_trace_writer writer("thrust.json");
+ *  writer.install();
+ *  thrust::sort(thrust::omp::par, keys.begin(), keys.end());
+ *  \endcode
+ */
+class chrome_trace_writer
+{
+public:
+  /*! Opens the file \p path for writing. Check \p is_open() for failure.
+   *
+   *  \param path the path of the trace file
+   */
+  explicit chrome_trace_writer(const char * path);
+
+  /*! Uninstalls this writer if it is installed, and completes the file.
+   */
+  ~chrome_trace_writer();
+
+  chrome_trace_writer(const chrome_trace_writer &) = delete;
+  chrome_trace_writer & operator=(const chrome_trace_writer &) = delete;
+
+  /*! Returns whether the file was opened and has not been closed yet.
+   */
+  bool is_open() const
+  {
+    return m_file != NULL;
+  }
+
+  /*! Makes this writer the trace callback, replacing any previous one.
+   */
+  void install();
+
+  /*! Unsets the trace callback if it is this writer, then completes and closes the file. The algorithm calls that
+   *      are still running are ended at the time of the call, so that every slice in the file is closed.
+   */
+  void close();
+
+  /*! Writes \p e to the file. This is called by the trace callback once the writer is installed, and can also be
+   *      called directly to forward events from another callback. An \p end event whose \p begin event was not
+   *      written, because the writer was installed while the algorithm was running, is dropped.
+   *
+   *  \param e the event to write
+   */
+  void write(const event & e);
+
+private:
+  static void dispatch(const event & e, void * user_data);
+
+  void write_locked(const event & e);
+
+  std::mutex m_mutex;
+  std::FILE * m_file;
+  std::uint64_t m_start;
+  bool m_first;
+  // the begin events written without their end event yet
+  std::vector<event> m_open;
+};
+
+} // end trace
+
+/*! \} // end utility
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/trace.inl>